@@ -0,0 +1,84 @@
+#include <chrono>
+
+#include "ecole/none.hpp"
+
+#include "bench-coroutine.hpp"
+#include "csv.hpp"
+
+namespace ecole::benchmark {
+
+namespace {
+
+using Coroutine = utility::Coroutine<std::size_t, NoneType>;
+using Executor = Coroutine::Executor;
+
+auto backend_name(utility::CoroutineBackend backend) -> std::string {
+	switch (backend) {
+	case utility::CoroutineBackend::thread:
+		return "thread";
+	case utility::CoroutineBackend::spin_thread:
+		return "spin_thread";
+	case utility::CoroutineBackend::fiber:
+		return "fiber";
+	default:
+		return "unknown";
+	}
+}
+
+/** Executor yielding values until being stopped, similar to a solver calling callbacks until interrupted. */
+void yield_until_stopped(Executor& executor) {
+	for (std::size_t i = 0;; ++i) {
+		if (Executor::is_stop(executor.yield(i))) {
+			return;
+		}
+	}
+}
+
+template <typename Func> auto time_per_iteration(Func&& func, std::size_t n_iterations) -> std::chrono::duration<double> {
+	auto const time_before = std::chrono::steady_clock::now();
+	for (std::size_t i = 0; i < n_iterations; ++i) {
+		func();
+	}
+	auto const time_after = std::chrono::steady_clock::now();
+	return (time_after - time_before) / static_cast<double>(n_iterations);
+}
+
+}  // namespace
+
+auto CoroutineResult::csv_title() -> std::string {
+	return make_csv("backend", "use_thread_pool", "n_coroutines", "n_yields", "creation_time_us", "yield_latency_ns");
+}
+
+auto CoroutineResult::csv() -> std::string {
+	return make_csv(backend, use_thread_pool, n_coroutines, n_yields, creation_time_us, yield_latency_ns);
+}
+
+auto benchmark_coroutine(utility::CoroutineOptions const& options, std::size_t n_coroutines, std::size_t n_yields)
+	-> CoroutineResult {
+	auto const creation_time = time_per_iteration(
+		[&options] {
+			auto co = Coroutine{options, yield_until_stopped};
+			co.wait();
+		},
+		n_coroutines);
+
+	auto co = Coroutine{options, yield_until_stopped};
+	co.wait();
+	auto const yield_time = time_per_iteration(
+		[&co] {
+			co.resume(None);
+			co.wait();
+		},
+		n_yields);
+
+	return {
+		backend_name(options.backend),
+		options.use_thread_pool,
+		n_coroutines,
+		n_yields,
+		std::chrono::duration<double, std::micro>(creation_time).count(),
+		std::chrono::duration<double, std::nano>(yield_time).count(),
+	};
+}
+
+}  // namespace ecole::benchmark
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "ecole/utility/coroutine.hpp"
+
+namespace ecole::benchmark {
+
+struct CoroutineResult {
+	std::string backend;
+	bool use_thread_pool = false;
+	std::size_t n_coroutines = 0;
+	std::size_t n_yields = 0;
+	double creation_time_us = 0.;
+	double yield_latency_ns = 0.;
+
+	static auto csv_title() -> std::string;
+	auto csv() -> std::string;
+};
+
+/**
+ * Benchmark the overhead of coroutines.
+ *
+ * Measure the average time to create and terminate a coroutine, and the average time of a round trip (``resume``,
+ * ``yield``, and ``wait``) between the coroutine and its executor.
+ */
+auto benchmark_coroutine(utility::CoroutineOptions const& options, std::size_t n_coroutines, std::size_t n_yields)
+	-> CoroutineResult;
+
+}  // namespace ecole::benchmark
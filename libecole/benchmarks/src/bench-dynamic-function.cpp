@@ -0,0 +1,145 @@
+#include <chrono>
+#include <memory>
+#include <utility>
+
+#include "ecole/data/dynamic.hpp"
+#include "ecole/reward/constant.hpp"
+#include "ecole/reward/is-done.hpp"
+#include "ecole/reward/lp-iterations.hpp"
+#include "ecole/scip/model.hpp"
+
+#include "bench-dynamic-function.hpp"
+#include "csv.hpp"
+
+namespace ecole::benchmark {
+
+namespace {
+
+/** The former implementation of data::DynamicFunction, with one heap allocation per wrapped function. */
+template <typename Data> class VirtualDynamicFunction {
+public:
+	template <typename DataFunction>
+	explicit VirtualDynamicFunction(DataFunction data_function) :
+		m_pimpl{std::make_unique<DataFunctionWrapper<DataFunction>>(std::move(data_function))} {}
+
+	VirtualDynamicFunction(VirtualDynamicFunction&&) noexcept = default;
+	VirtualDynamicFunction(VirtualDynamicFunction const& other) : m_pimpl{other.m_pimpl->clone()} {}
+
+	VirtualDynamicFunction& operator=(VirtualDynamicFunction&&) noexcept = default;
+	VirtualDynamicFunction& operator=(VirtualDynamicFunction const& other) {
+		if (this != &other) {
+			m_pimpl = other.m_pimpl->clone();
+		}
+		return *this;
+	}
+
+	auto before_reset(scip::Model& model) -> void { return m_pimpl->before_reset(model); }
+	auto extract(scip::Model& model, bool done) -> Data { return m_pimpl->extract(model, done); }
+
+private:
+	struct DataFunctionAbstract {
+		virtual ~DataFunctionAbstract() = default;
+		virtual auto clone() -> std::unique_ptr<DataFunctionAbstract> = 0;
+		virtual auto before_reset(scip::Model& model) -> void = 0;
+		virtual auto extract(scip::Model& model, bool done) -> Data = 0;
+	};
+
+	template <typename DataFunction> struct DataFunctionWrapper final : DataFunctionAbstract {
+		explicit DataFunctionWrapper(DataFunction data_function) : m_data_function{std::move(data_function)} {}
+		auto clone() -> std::unique_ptr<DataFunctionAbstract> override {
+			return std::make_unique<DataFunctionWrapper>(*this);
+		}
+		auto before_reset(scip::Model& model) -> void override { return m_data_function.before_reset(model); }
+		auto extract(scip::Model& model, bool done) -> Data override { return m_data_function.extract(model, done); }
+
+		DataFunction m_data_function;
+	};
+
+	std::unique_ptr<DataFunctionAbstract> m_pimpl;
+};
+
+template <typename Dynamic> auto make_function(std::size_t idx) -> Dynamic {
+	switch (idx % 3) {
+	case 0:
+		return Dynamic{reward::Constant{1.}};
+	case 1:
+		return Dynamic{reward::IsDone{}};
+	default:
+		return Dynamic{reward::LpIterations{}};
+	}
+}
+
+template <typename Func> auto measure(Func&& func) -> std::chrono::duration<double> {
+	auto const time_before = std::chrono::steady_clock::now();
+	func();
+	auto const time_after = std::chrono::steady_clock::now();
+	return time_after - time_before;
+}
+
+template <typename Dynamic>
+auto benchmark_implementation(std::string implementation, std::size_t n_environments, std::size_t n_functions)
+	-> DynamicFunctionResult {
+	using Environments = std::vector<std::vector<Dynamic>>;
+	auto model = scip::Model::prob_basic();
+	auto environments = Environments{};
+
+	auto const creation_time = measure([&] {
+		environments.reserve(n_environments);
+		for (std::size_t i = 0; i < n_environments; ++i) {
+			auto& functions = environments.emplace_back();
+			functions.reserve(n_functions);
+			for (std::size_t j = 0; j < n_functions; ++j) {
+				functions.push_back(make_function<Dynamic>(j));
+			}
+		}
+	});
+
+	auto copy = Environments{};
+	auto const copy_time = measure([&] { copy = environments; });
+
+	for (auto& functions : environments) {
+		for (auto& func : functions) {
+			func.before_reset(model);
+		}
+	}
+	// Volatile to prevent the compiler from optimizing the extraction away
+	auto volatile total = reward::Reward{0.};
+	auto const extraction_time = measure([&] {
+		for (auto& functions : environments) {
+			for (auto& func : functions) {
+				total = total + func.extract(model, false);
+			}
+		}
+	});
+
+	auto const n_total = static_cast<double>(n_environments * n_functions);
+	return {
+		std::move(implementation),
+		n_environments,
+		n_functions,
+		std::chrono::duration<double, std::nano>(creation_time).count() / n_total,
+		std::chrono::duration<double, std::nano>(copy_time).count() / n_total,
+		std::chrono::duration<double, std::nano>(extraction_time).count() / n_total,
+	};
+}
+
+}  // namespace
+
+auto DynamicFunctionResult::csv_title() -> std::string {
+	return make_csv(
+		"implementation", "n_environments", "n_functions", "creation_time_ns", "copy_time_ns", "extraction_time_ns");
+}
+
+auto DynamicFunctionResult::csv() -> std::string {
+	return make_csv(implementation, n_environments, n_functions, creation_time_ns, copy_time_ns, extraction_time_ns);
+}
+
+auto benchmark_dynamic_function(std::size_t n_environments, std::size_t n_functions)
+	-> std::vector<DynamicFunctionResult> {
+	return {
+		benchmark_implementation<VirtualDynamicFunction<reward::Reward>>("virtual", n_environments, n_functions),
+		benchmark_implementation<data::DynamicFunction<reward::Reward>>("small_buffer", n_environments, n_functions),
+	};
+}
+
+}  // namespace ecole::benchmark
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ecole::benchmark {
+
+struct DynamicFunctionResult {
+	std::string implementation;
+	std::size_t n_environments = 0;
+	std::size_t n_functions = 0;
+	double creation_time_ns = 0.;
+	double copy_time_ns = 0.;
+	double extraction_time_ns = 0.;
+
+	static auto csv_title() -> std::string;
+	auto csv() -> std::string;
+};
+
+/**
+ * Compare data::DynamicFunction with a type erasure based on virtual inheritance and heap allocation.
+ *
+ * Every environment holds a vector of reward functions wrapped in a dynamic function.
+ * Measure the average time to create, copy, and extract data from a single wrapped function.
+ */
+auto benchmark_dynamic_function(std::size_t n_environments, std::size_t n_functions)
+	-> std::vector<DynamicFunctionResult>;
+
+}  // namespace ecole::benchmark
@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <chrono>
+#include <tuple>
+#include <utility>
+
+#include "ecole/dynamics/branching.hpp"
+#include "ecole/observation/khalil-2016.hpp"
+
+#include "bench-khalil-2016.hpp"
+#include "csv.hpp"
+
+namespace ecole::benchmark {
+
+auto Khalil2016Result::csv_title() -> std::string {
+	return make_csv("name", "n_threads", "n_nodes", "n_candidates", "extraction_time_us");
+}
+
+auto Khalil2016Result::csv() -> std::string {
+	return make_csv(name, n_threads, n_nodes, n_candidates, extraction_time_us);
+}
+
+auto benchmark_khalil_2016(scip::Model const& model, std::vector<std::size_t> const& n_threads)
+	-> std::vector<Khalil2016Result> {
+	auto obs_funcs = std::vector<observation::Khalil2016>{};
+	auto times = std::vector<std::chrono::duration<double>>(n_threads.size(), std::chrono::duration<double>{0});
+	for (auto const n : n_threads) {
+		obs_funcs.emplace_back(false, true, n);
+	}
+
+	auto m = model.copy_orig();
+	for (auto& obs_func : obs_funcs) {
+		obs_func.before_reset(m);
+	}
+	auto n_nodes = std::size_t{0};
+	auto n_candidates = std::size_t{0};
+	auto dyn = dynamics::BranchingDynamics{};
+	auto [done, action_set] = dyn.reset_dynamics(m);
+	while (!done) {
+		for (std::size_t i = 0; i < obs_funcs.size(); ++i) {
+			auto const time_before = std::chrono::steady_clock::now();
+			auto obs = obs_funcs[i].extract(m, false);
+			auto const time_after = std::chrono::steady_clock::now();
+			times[i] += time_after - time_before;
+		}
+		n_nodes++;
+		n_candidates += action_set.value().size();
+		std::tie(done, action_set) = dyn.step_dynamics(m, action_set.value()[0]);
+	}
+
+	auto results = std::vector<Khalil2016Result>{};
+	auto const n_nodes_div = static_cast<double>(std::max(n_nodes, std::size_t{1}));
+	for (std::size_t i = 0; i < obs_funcs.size(); ++i) {
+		results.push_back({
+			model.name(),
+			n_threads[i],
+			n_nodes,
+			static_cast<double>(n_candidates) / n_nodes_div,
+			std::chrono::duration<double, std::micro>(times[i]).count() / n_nodes_div,
+		});
+	}
+	return results;
+}
+
+}  // namespace ecole::benchmark
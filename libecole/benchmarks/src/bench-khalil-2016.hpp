@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ecole/scip/model.hpp"
+
+namespace ecole::benchmark {
+
+struct Khalil2016Result {
+	std::string name;
+	std::size_t n_threads = 0;
+	std::size_t n_nodes = 0;
+	double n_candidates = 0.;
+	double extraction_time_us = 0.;
+
+	static auto csv_title() -> std::string;
+	auto csv() -> std::string;
+};
+
+/**
+ * Benchmark the Khalil2016 observation function with different number of threads.
+ *
+ * All observation functions extract an observation on every node visited by the branching dynamics.
+ * Return the average number of candidates and extraction time per node for each number of threads.
+ */
+auto benchmark_khalil_2016(scip::Model const& model, std::vector<std::size_t> const& n_threads)
+	-> std::vector<Khalil2016Result>;
+
+}  // namespace ecole::benchmark
@@ -0,0 +1,88 @@
+#include <array>
+#include <chrono>
+#include <map>
+#include <tuple>
+#include <utility>
+
+#include <scip/scip.h>
+
+#include "ecole/dynamics/branching.hpp"
+#include "ecole/observation/node-bipartite.hpp"
+
+#include "bench-node-bipartite.hpp"
+#include "csv.hpp"
+
+namespace ecole::benchmark {
+
+namespace {
+
+struct Mode {
+	char const* name;
+	observation::NodeBipartite obs_func;
+};
+
+/** The modes compared, caching is not included as it does not support cutting planes. */
+auto make_modes() {
+	return std::array{
+		Mode{"full", observation::NodeBipartite{false, false, false}},
+		Mode{"incremental", observation::NodeBipartite{false, true, false}},
+		Mode{"incremental_track_columns", observation::NodeBipartite{false, true, true}},
+	};
+}
+
+/** Accumulated extraction time on the nodes of a given depth. */
+struct DepthTime {
+	std::chrono::duration<double> total_time{0};
+	std::size_t n_nodes = 0;
+};
+
+}  // namespace
+
+auto NodeBipartiteResult::csv_title() -> std::string {
+	return make_csv("name", "mode", "depth", "n_nodes", "extraction_time_us");
+}
+
+auto NodeBipartiteResult::csv() -> std::string {
+	return make_csv(name, mode, depth, n_nodes, extraction_time_us);
+}
+
+auto benchmark_node_bipartite(scip::Model const& model) -> std::vector<NodeBipartiteResult> {
+	auto modes = make_modes();
+	auto times = std::array<std::map<std::size_t, DepthTime>, std::tuple_size_v<decltype(modes)>>{};
+
+	auto m = model.copy_orig();
+	for (auto& mode : modes) {
+		mode.obs_func.before_reset(m);
+	}
+	auto dyn = dynamics::BranchingDynamics{};
+	auto [done, action_set] = dyn.reset_dynamics(m);
+	while (!done) {
+		auto const depth = static_cast<std::size_t>(SCIPgetDepth(m.get_scip_ptr()));
+		for (std::size_t i = 0; i < modes.size(); ++i) {
+			auto const time_before = std::chrono::steady_clock::now();
+			auto obs = modes[i].obs_func.extract(m, false);
+			auto const time_after = std::chrono::steady_clock::now();
+			auto& depth_time = times[i][depth];
+			depth_time.total_time += time_after - time_before;
+			depth_time.n_nodes++;
+		}
+		std::tie(done, action_set) = dyn.step_dynamics(m, action_set.value()[0]);
+	}
+
+	auto results = std::vector<NodeBipartiteResult>{};
+	for (std::size_t i = 0; i < modes.size(); ++i) {
+		for (auto const& [depth, depth_time] : times[i]) {
+			results.push_back({
+				model.name(),
+				modes[i].name,
+				depth,
+				depth_time.n_nodes,
+				std::chrono::duration<double, std::micro>(depth_time.total_time).count() /
+					static_cast<double>(depth_time.n_nodes),
+			});
+		}
+	}
+	return results;
+}
+
+}  // namespace ecole::benchmark
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ecole/scip/model.hpp"
+
+namespace ecole::benchmark {
+
+struct NodeBipartiteResult {
+	std::string name;
+	std::string mode;
+	std::size_t depth = 0;
+	std::size_t n_nodes = 0;
+	double extraction_time_us = 0.;
+
+	static auto csv_title() -> std::string;
+	auto csv() -> std::string;
+};
+
+/**
+ * Benchmark the extraction modes of the NodeBipartite observation function.
+ *
+ * All modes extract an observation on every node visited by the branching dynamics.
+ * Return the average extraction time per tree depth for each mode.
+ */
+auto benchmark_node_bipartite(scip::Model const& model) -> std::vector<NodeBipartiteResult>;
+
+}  // namespace ecole::benchmark
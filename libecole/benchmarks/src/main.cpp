@@ -2,6 +2,7 @@
 #include <iostream>
 #include <optional>
 #include <tuple>
+#include <vector>
 
 #include <CLI/CLI.hpp>
 
@@ -13,6 +14,10 @@
 #include "ecole/scip/seed.hpp"
 
 #include "bench-branching.hpp"
+#include "bench-coroutine.hpp"
+#include "bench-dynamic-function.hpp"
+#include "bench-khalil-2016.hpp"
+#include "bench-node-bipartite.hpp"
 #include "benchmark.hpp"
 
 using namespace ecole::benchmark;
@@ -69,6 +74,88 @@ auto benchmark_branching(std::size_t n_instances, std::size_t n_nodes) {
 	}
 }
 
+/** Compare the NodeBipartite extraction modes along the depth of the branch-and-bound tree. */
+auto benchmark_node_bipartite(std::size_t n_instances, std::size_t n_nodes) {
+	auto generators = std::tuple{
+		SetCoverGenerator{{500, 1000}},             // NOLINT(readability-magic-numbers)
+		CombinatorialAuctionGenerator{{100, 500}},  // NOLINT(readability-magic-numbers)
+	};
+	auto rng = ecole::spawn_random_generator();
+
+	std::cout << NodeBipartiteResult::csv_title() << '\n';
+	for (std::size_t i = 0; i < n_instances; ++i) {
+		auto benchmark_and_print = [&](auto& gen) noexcept {
+			try {
+				auto model = gen.next();
+				// Cutting planes are kept to exercise changes in the LP rows
+				model.disable_presolve();
+				model.set_param("limits/totalnodes", n_nodes);
+				seed_model(model, rng);
+				for (auto& result : benchmark_node_bipartite(model)) {
+					std::cout << result.csv() << '\n';
+				}
+			} catch (std::exception const& e) {
+				std::cerr << "Error when benchmarking an instance: " << e.what() << '\n';
+			}
+		};
+		for_each(generators, benchmark_and_print);
+	}
+}
+
+/** Measure the scaling of the Khalil2016 extraction time with the number of threads. */
+auto benchmark_khalil_2016(std::size_t n_instances, std::size_t n_nodes, std::vector<std::size_t> const& n_threads) {
+	auto generators = std::tuple{
+		SetCoverGenerator{{2000, 1000}},             // NOLINT(readability-magic-numbers)
+		CombinatorialAuctionGenerator{{300, 1500}},  // NOLINT(readability-magic-numbers)
+	};
+	auto rng = ecole::spawn_random_generator();
+
+	std::cout << Khalil2016Result::csv_title() << '\n';
+	for (std::size_t i = 0; i < n_instances; ++i) {
+		auto benchmark_and_print = [&](auto& gen) noexcept {
+			try {
+				auto model = gen.next();
+				model.disable_presolve();
+				model.disable_cuts();
+				model.set_param("limits/totalnodes", n_nodes);
+				seed_model(model, rng);
+				for (auto& result : benchmark_khalil_2016(model, n_threads)) {
+					std::cout << result.csv() << '\n';
+				}
+			} catch (std::exception const& e) {
+				std::cerr << "Error when benchmarking an instance: " << e.what() << '\n';
+			}
+		};
+		for_each(generators, benchmark_and_print);
+	}
+}
+
+/** Compare the overhead of the coroutine backends used to run the solver. */
+auto benchmark_coroutine(std::size_t n_coroutines, std::size_t n_yields) {
+	using ecole::utility::CoroutineBackend;
+	std::cout << CoroutineResult::csv_title() << '\n';
+	for (auto const backend : {CoroutineBackend::thread, CoroutineBackend::spin_thread, CoroutineBackend::fiber}) {
+		for (auto const use_thread_pool : {false, true}) {
+			auto options = ecole::utility::CoroutineOptions{};
+			options.backend = backend;
+			options.use_thread_pool = use_thread_pool;
+			try {
+				std::cout << benchmark_coroutine(options, n_coroutines, n_yields).csv() << '\n';
+			} catch (std::exception const& e) {
+				std::cerr << "Error when benchmarking a coroutine backend: " << e.what() << '\n';
+			}
+		}
+	}
+}
+
+/** Compare the type erasure of data functions when many environments hold many functions. */
+auto benchmark_dynamic_function(std::size_t n_environments, std::size_t n_functions) {
+	std::cout << DynamicFunctionResult::csv_title() << '\n';
+	for (auto& result : ecole::benchmark::benchmark_dynamic_function(n_environments, n_functions)) {
+		std::cout << result.csv() << '\n';
+	}
+}
+
 int main(int argc, char** argv) {
 	try {
 
@@ -81,12 +168,41 @@ int main(int argc, char** argv) {
 		app.add_option("--node-limit,--nl", n_nodes, "Limit the number of nodes in each run");
 		auto seed = std::optional<ecole::Seed>{};
 		app.add_option("--seed,-s", seed, "Global Ecole random seed");
+
+		auto* coroutine_app = app.add_subcommand("coroutine", "Benchmark the latency of the coroutine backends");
+		auto n_coroutines = std::size_t{1000};  // NOLINT(readability-magic-numbers)
+		coroutine_app->add_option("--n-coroutines", n_coroutines, "Number of coroutines created and terminated");
+		auto n_yields = std::size_t{100000};  // NOLINT(readability-magic-numbers)
+		coroutine_app->add_option("--n-yields", n_yields, "Number of round trips with the executor");
+
+		auto* dynamic_app = app.add_subcommand("dynamic-function", "Benchmark the overhead of type erased data functions");
+		auto n_environments = std::size_t{1000};  // NOLINT(readability-magic-numbers)
+		dynamic_app->add_option("--n-environments", n_environments, "Number of environments holding data functions");
+		auto n_functions = std::size_t{24};  // NOLINT(readability-magic-numbers)
+		dynamic_app->add_option("--n-functions", n_functions, "Number of data functions held by each environment");
+
+		auto* node_bipartite_app =
+			app.add_subcommand("node-bipartite", "Benchmark the NodeBipartite extraction time against the tree depth");
+		auto* khalil_app =
+			app.add_subcommand("khalil-2016", "Benchmark the Khalil2016 extraction time against the number of threads");
+		auto n_threads = std::vector<std::size_t>{1, 2, 4, 8, 16};  // NOLINT(readability-magic-numbers)
+		khalil_app->add_option("--n-threads", n_threads, "Number of threads used by the observation functions compared");
 		CLI11_PARSE(app, argc, argv);
 
 		if (seed.has_value()) {
 			ecole::seed(seed.value());
 		}
-		benchmark_branching(n_instances, n_nodes);
+		if (*coroutine_app) {
+			benchmark_coroutine(n_coroutines, n_yields);
+		} else if (*dynamic_app) {
+			benchmark_dynamic_function(n_environments, n_functions);
+		} else if (*node_bipartite_app) {
+			benchmark_node_bipartite(n_instances, n_nodes);
+		} else if (*khalil_app) {
+			benchmark_khalil_2016(n_instances, n_nodes, n_threads);
+		} else {
+			benchmark_branching(n_instances, n_nodes);
+		}
 
 	} catch (std::exception const& e) {
 		std::cerr << "An error occured: " << e.what() << '\n';
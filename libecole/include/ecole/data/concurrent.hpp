@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "ecole/scip/model.hpp"
+#include "ecole/traits.hpp"
+#include "ecole/utility/thread-pool.hpp"
+
+namespace ecole::data {
+
+namespace internal {
+
+/** Whether the calling thread is extracting a data function concurrently with others. */
+inline auto in_concurrent_extraction() noexcept -> bool& {
+	thread_local auto in_extraction = false;
+	return in_extraction;
+}
+
+/** Mark the calling thread as extracting concurrently for the lifetime of the object. */
+class ConcurrentExtractionScope {
+public:
+	ConcurrentExtractionScope() noexcept : m_was_in_extraction{std::exchange(in_concurrent_extraction(), true)} {}
+	ConcurrentExtractionScope(ConcurrentExtractionScope const&) = delete;
+	ConcurrentExtractionScope(ConcurrentExtractionScope&&) = delete;
+	~ConcurrentExtractionScope() { in_concurrent_extraction() = m_was_in_extraction; }
+
+	auto operator=(ConcurrentExtractionScope const&) -> ConcurrentExtractionScope& = delete;
+	auto operator=(ConcurrentExtractionScope&&) -> ConcurrentExtractionScope& = delete;
+
+private:
+	bool m_was_in_extraction;
+};
+
+}  // namespace internal
+
+/**
+ * Whether combinators can extract their read only functions concurrently.
+ *
+ * This is not the case inside a concurrent extraction, so that nested combinators extract their functions
+ * sequentially, without preparing the model again while it is being read.
+ */
+inline auto can_extract_concurrently(std::size_t n_threads) noexcept -> bool {
+	return (n_threads > 1) && !internal::in_concurrent_extraction();
+}
+
+/**
+ * Extract a data function, invalidating the statistics cached for the step if it may have modified the model.
+ *
+ * @see trait::is_model_modifying_data_function
+ */
+template <typename Function>
+auto extract_data(Function& function, scip::Model& model, bool done) -> trait::data_of_t<Function> {
+	auto data = function.extract(model, done);
+	if constexpr (trait::is_model_modifying_data_function_v<Function>) {
+		model.statistics().invalidate();
+	}
+	return data;
+}
+
+/**
+ * Call ``extract`` on all function indices in ``[0, n_functions)`` concurrently, all functions being read only.
+ *
+ * The functions are extracted on the global thread pool, using at most ``n_threads`` threads including the calling
+ * one, after the model has been prepared with scip::Model::prepare_concurrent_reads.
+ *
+ * @param extract Extract the function of the given index, it must be safe to call concurrently.
+ */
+template <typename Extract>
+auto extract_read_only_concurrently(
+	scip::Model& model,
+	std::size_t n_threads,
+	std::size_t n_functions,
+	Extract const& extract) -> void {
+	if (n_functions < 2) {
+		for (std::size_t i = 0; i < n_functions; ++i) {
+			extract(i);
+		}
+		return;
+	}
+	model.prepare_concurrent_reads();
+	utility::parallel_for(utility::ThreadPool::global(), n_threads, n_functions, [&](std::size_t i) {
+		auto const scope = internal::ConcurrentExtractionScope{};
+		extract(i);
+	});
+}
+
+/**
+ * Call ``extract`` on all function indices in ``[0, read_only.size())``, concurrently for the read only ones.
+ *
+ * Functions that are not read only are extracted first, sequentially and in order, with extract_data.
+ * The read only functions are then extracted concurrently, as in extract_read_only_concurrently.
+ *
+ * @param read_only Whether each function is read only, as given by trait::is_read_only_data_function.
+ * @param extract Extract the function of the given index, it must be safe to call concurrently on read only functions.
+ */
+template <typename Flags, typename Extract>
+auto extract_concurrently(scip::Model& model, std::size_t n_threads, Flags const& read_only, Extract const& extract)
+	-> void {
+	auto concurrent = std::vector<std::size_t>{};
+	for (std::size_t i = 0; i < read_only.size(); ++i) {
+		if (read_only[i]) {
+			concurrent.push_back(i);
+		} else {
+			extract(i);
+		}
+	}
+	extract_read_only_concurrently(model, n_threads, concurrent.size(), [&](std::size_t task) {
+		extract(concurrent[task]);
+	});
+}
+
+}  // namespace ecole::data
@@ -8,6 +8,9 @@ namespace ecole::data {
 
 template <typename Data> class ConstantFunction {
 public:
+	/** Extraction does not read the model, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = true;
+
 	ConstantFunction() = default;
 	ConstantFunction(Data data_) : data{std::move(data_)} {}
 
@@ -15,6 +18,8 @@ public:
 
 	[[nodiscard]] auto extract(scip::Model const& /* model */, bool /* done */) const -> Data { return data; };
 
+	[[nodiscard]] auto value() const noexcept -> Data const& { return data; }
+
 private:
 	Data data;
 };
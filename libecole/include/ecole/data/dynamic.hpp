@@ -1,9 +1,12 @@
 #pragma once
 
-#include <memory>
+#include <cstddef>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 #include "ecole/data/abstract.hpp"
+#include "ecole/data/concurrent.hpp"
 
 namespace ecole::data {
 
@@ -15,70 +18,157 @@ namespace ecole::data {
  * For instance, using ``DynamicFunction<Reward>``, one can store any other reward function inside a
  * container (``std::vector``, ``std::map``...).
  *
+ * Data functions that fit in ``BufferSize`` bytes, and can be moved without throwing, are stored inline rather than
+ * on the heap, so that creating, copying, and moving small data functions does not allocate memory.
+ * The wrapped function is called through a table of function pointers shared by all wrappers of the same type.
+ *
  * @tparam Data Type of data returned by this function. All wrapped functions must be able to extracc
  *         data convertible to this type.
  *         This can be achieved for instance by choosing ``Data`` to be ``std::variant``.
+ * @tparam BufferSize The size in bytes of the storage for data functions stored inline.
  */
-template <typename Data> class DynamicFunction {
+template <typename Data, std::size_t BufferSize = 4 * sizeof(void*)> class DynamicFunction {
 public:
-	/** Create a ``DynamicFunction`` from any compatible data function. */
+	/**
+	 * The statistics cached for the step are invalidated by the wrapped function, if it may modify the model.
+	 *
+	 * @see trait::is_model_modifying_data_function
+	 */
+	static constexpr bool modifies_model = false;
+
+	/** Whether a data function is stored inline, rather than on the heap. */
 	template <typename DataFunction>
-	explicit DynamicFunction(DataFunction data_function) :
-		m_pimpl{std::make_unique<DataFunctionWrapper<DataFunction>>(std::move(data_function))} {}
+	static constexpr bool is_stored_inline =
+		(sizeof(DataFunction) <= BufferSize) && (alignof(DataFunction) <= alignof(std::max_align_t)) &&
+		std::is_nothrow_move_constructible_v<DataFunction>;
 
-	/** Default move semantics. */
-	DynamicFunction(DynamicFunction&&) noexcept = default;
+	/** Create a ``DynamicFunction`` from any compatible data function. */
+	template <typename DataFunction, typename = std::enable_if_t<!std::is_same_v<DataFunction, DynamicFunction>>>
+	explicit DynamicFunction(DataFunction data_function) : m_vtable{vtable_of<DataFunction>()} {
+		construct<DataFunction>(m_storage, std::move(data_function));
+	}
+
+	/** Move the wrapped data function, leaving the other object empty. */
+	DynamicFunction(DynamicFunction&& other) noexcept { steal(other); }
 	/** Copy by copying the wrapped data function. */
-	DynamicFunction(DynamicFunction const& other) : DynamicFunction{other.m_pimpl->clone()} {}
+	DynamicFunction(DynamicFunction const& other) {
+		if (other.m_vtable != nullptr) {
+			other.m_vtable->copy(m_storage, other.m_storage);
+			m_vtable = other.m_vtable;
+		}
+	}
+
+	~DynamicFunction() { reset(); }
 
-	/** Default move assign semantics. */
-	DynamicFunction& operator=(DynamicFunction&&) noexcept = default;
+	/** Move assign the wrapped data function, leaving the other object empty. */
+	DynamicFunction& operator=(DynamicFunction&& other) noexcept {
+		if (this != &other) {
+			reset();
+			steal(other);
+		}
+		return *this;
+	}
 	/** Copy assign by copying the wrapped data function. */
 	DynamicFunction& operator=(DynamicFunction const& other) {
 		if (this != &other) {
-			m_pimpl = other.m_pimpl->clone();
+			*this = DynamicFunction{other};
 		}
 		return *this;
 	}
 
 	/** Call ``before_reset`` onto the wrapped item. */
-	auto before_reset(scip::Model& model) -> void { return m_pimpl->before_reset(model); }
+	auto before_reset(scip::Model& model) -> void { return m_vtable->before_reset(m_storage, model); }
 
 	/** Call ``extract`` onto the wrapped item. */
-	auto extract(scip::Model& model, bool done) -> Data { return m_pimpl->extract(model, done); }
+	auto extract(scip::Model& model, bool done) -> Data { return m_vtable->extract(m_storage, model, done); }
 
 private:
-	/**
-	 * Interface expected of a data function.
-	 *
-	 * This is used for dynamic polymorphism based on virtual inheritance.
-	 */
-	struct DataFunctionAbstract {
-		virtual ~DataFunctionAbstract() = default;
-		virtual auto clone() -> std::unique_ptr<DataFunctionAbstract> = 0;
-		virtual auto before_reset(scip::Model& model) -> void = 0;
-		virtual auto extract(scip::Model& model, bool done) -> Data = 0;
+	/** Memory holding either the data function itself, or a pointer to it. */
+	union Storage {
+		alignas(std::max_align_t) std::byte buffer[BufferSize];
+		void* pointer;
 	};
 
 	/**
-	 * Wrapper for any compatible data function.
+	 * Operations on the data function held in a storage.
 	 *
-	 * The wrapper implements the ``DataFunctionAbstract`` interface.
+	 * This replaces the virtual table of an abstract base class, without requiring the data function to be allocated
+	 * on its own.
 	 */
-	template <typename DataFunction> struct DataFunctionWrapper final : DataFunctionAbstract {
-		explicit DataFunctionWrapper(DataFunction data_function) : m_data_function{std::move(data_function)} {}
-		auto clone() -> std::unique_ptr<DataFunctionAbstract> override {
-			return std::make_unique<DataFunctionWrapper>(*this);
+	struct VTable {
+		auto (*copy)(Storage& dest, Storage const& src) -> void;
+		auto (*move)(Storage& dest, Storage& src) noexcept -> void;
+		auto (*destroy)(Storage& storage) noexcept -> void;
+		auto (*before_reset)(Storage& storage, scip::Model& model) -> void;
+		auto (*extract)(Storage& storage, scip::Model& model, bool done) -> Data;
+	};
+
+	VTable const* m_vtable = nullptr;
+	Storage m_storage;
+
+	template <typename DataFunction> static auto get(Storage& storage) noexcept -> DataFunction& {
+		if constexpr (is_stored_inline<DataFunction>) {
+			return *std::launder(reinterpret_cast<DataFunction*>(storage.buffer));
+		} else {
+			return *static_cast<DataFunction*>(storage.pointer);
 		}
-		auto before_reset(scip::Model& model) -> void override { return m_data_function.before_reset(model); }
-		auto extract(scip::Model& model, bool done) -> Data override { return m_data_function.extract(model, done); }
+	}
 
-		DataFunction m_data_function;
-	};
+	template <typename DataFunction> static auto get(Storage const& storage) noexcept -> DataFunction const& {
+		return get<DataFunction>(const_cast<Storage&>(storage));
+	}
+
+	template <typename DataFunction, typename... Args> static auto construct(Storage& storage, Args&&... args) -> void {
+		if constexpr (is_stored_inline<DataFunction>) {
+			new (storage.buffer) DataFunction(std::forward<Args>(args)...);
+		} else {
+			storage.pointer = new DataFunction(std::forward<Args>(args)...);  // NOLINT(cppcoreguidelines-owning-memory)
+		}
+	}
+
+	template <typename DataFunction> static auto destroy(Storage& storage) noexcept -> void {
+		if constexpr (is_stored_inline<DataFunction>) {
+			get<DataFunction>(storage).~DataFunction();
+		} else {
+			delete &get<DataFunction>(storage);  // NOLINT(cppcoreguidelines-owning-memory)
+		}
+	}
+
+	template <typename DataFunction> static auto move(Storage& dest, Storage& src) noexcept -> void {
+		if constexpr (is_stored_inline<DataFunction>) {
+			new (dest.buffer) DataFunction(std::move(get<DataFunction>(src)));
+			get<DataFunction>(src).~DataFunction();
+		} else {
+			dest.pointer = std::exchange(src.pointer, nullptr);
+		}
+	}
+
+	template <typename DataFunction> static auto vtable_of() noexcept -> VTable const* {
+		static constexpr auto vtable = VTable{
+			[](Storage& dest, Storage const& src) { construct<DataFunction>(dest, get<DataFunction>(src)); },
+			&move<DataFunction>,
+			&destroy<DataFunction>,
+			[](Storage& storage, scip::Model& model) { get<DataFunction>(storage).before_reset(model); },
+			[](Storage& storage, scip::Model& model, bool done) -> Data {
+				return extract_data(get<DataFunction>(storage), model, done);
+			},
+		};
+		return &vtable;
+	}
 
-	explicit DynamicFunction(std::unique_ptr<DataFunctionAbstract> ptr) : m_pimpl{std::move(ptr)} {};
+	auto steal(DynamicFunction& other) noexcept -> void {
+		if (other.m_vtable != nullptr) {
+			other.m_vtable->move(m_storage, other.m_storage);
+			m_vtable = std::exchange(other.m_vtable, nullptr);
+		}
+	}
 
-	std::unique_ptr<DataFunctionAbstract> m_pimpl;
+	auto reset() noexcept -> void {
+		if (m_vtable != nullptr) {
+			m_vtable->destroy(m_storage);
+			m_vtable = nullptr;
+		}
+	}
 };
 
 }  // namespace ecole::data
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <cstddef>
 #include <map>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include "ecole/data/abstract.hpp"
+#include "ecole/data/concurrent.hpp"
 #include "ecole/traits.hpp"
 
 namespace ecole::data {
@@ -13,11 +17,24 @@ template <typename Key, typename Function> class MapFunction {
 public:
 	using DataMap = std::map<Key, trait::data_of_t<Function>>;
 
+	/** Read only if all functions are, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = trait::is_read_only_data_function_v<Function>;
+	/** Modifies the model if any function does, see trait::is_model_modifying_data_function. */
+	static constexpr bool modifies_model = trait::is_model_modifying_data_function_v<Function>;
+
 	/** Default construct all functions. */
 	MapFunction() = default;
 
-	/** Store a copy of the functions. */
-	MapFunction(std::map<Key, Function> functions) : data_functions{std::move(functions)} {}
+	/**
+	 * Store a copy of the functions.
+	 *
+	 * @param functions The functions to extract data from.
+	 * @param n_threads_ The maximum number of threads used to extract read only functions concurrently, including
+	 *        the calling thread.
+	 * @see trait::is_read_only_data_function
+	 */
+	MapFunction(std::map<Key, Function> functions, std::size_t n_threads_ = 1) :
+		data_functions{std::move(functions)}, n_threads{n_threads_} {}
 
 	/** Call before_reset on all functions. */
 	void before_reset(scip::Model& model) {
@@ -28,15 +45,40 @@ public:
 
 	/** Return data extracted from all functions as a map. */
 	DataMap extract(scip::Model& model, bool done) {
+		if constexpr (read_only) {
+			if (can_extract_concurrently(n_threads)) {
+				return extract_concurrently(model, done);
+			}
+		}
 		auto data = DataMap{};
 		for (auto& [key, func] : data_functions) {
-			data.emplace_hint(data.end(), key, func.extract(model, done));
+			data.emplace_hint(data.end(), key, extract_data(func, model, done));
 		}
 		return data;
 	}
 
 private:
 	std::map<Key, Function> data_functions;
+	std::size_t n_threads = 1;
+
+	DataMap extract_concurrently(scip::Model& model, bool done) {
+		auto functions = std::vector<Function*>{};
+		functions.reserve(data_functions.size());
+		for (auto& [_, func] : data_functions) {
+			functions.push_back(&func);
+		}
+		auto values = std::vector<std::optional<trait::data_of_t<Function>>>(functions.size());
+		extract_read_only_concurrently(model, n_threads, functions.size(), [&](std::size_t i) {
+			values[i].emplace(functions[i]->extract(model, done));
+		});
+
+		auto data = DataMap{};
+		auto value_iter = values.begin();
+		for (auto const& [key, _] : data_functions) {
+			data.emplace_hint(data.end(), key, std::move(*value_iter++).value());
+		}
+		return data;
+	}
 };
 
 }  // namespace ecole::data
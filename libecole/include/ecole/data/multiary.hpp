@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "ecole/data/abstract.hpp"
+#include "ecole/data/concurrent.hpp"
 #include "ecole/traits.hpp"
 
 namespace ecole::data {
@@ -19,6 +20,11 @@ template <typename DataCombiner, typename... Functions> class MultiaryFunction {
 public:
 	using CombinedData = std::invoke_result_t<DataCombiner, trait::data_of_t<Functions>...>;
 
+	/** Read only if all functions are, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = (trait::is_read_only_data_function_v<Functions> && ...);
+	/** Modifies the model if any function does, see trait::is_model_modifying_data_function. */
+	static constexpr bool modifies_model = (trait::is_model_modifying_data_function_v<Functions> || ...);
+
 	/** Default construct all functions. */
 	MultiaryFunction() = default;
 
@@ -34,7 +40,7 @@ public:
 	/** Extract data from all functions and call the multiart operation on it. */
 	auto extract(scip::Model& model, bool done = false) -> CombinedData {
 		return std::apply(
-			[&](auto&... functions) { return data_combiner(functions.extract(model, done)...); }, data_functions);
+			[&](auto&... functions) { return data_combiner(extract_data(functions, model, done)...); }, data_functions);
 	}
 
 private:
@@ -7,6 +7,9 @@ namespace ecole::data {
 
 class NoneFunction {
 public:
+	/** Extraction does not read the model, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = true;
+
 	auto before_reset(scip::Model const& /*model*/) -> void {}
 
 	auto extract(scip::Model const& /*model*/, bool /*done*/) -> NoneType { return ecole::None; }
@@ -4,6 +4,7 @@
 #include <utility>
 
 #include "ecole/data/abstract.hpp"
+#include "ecole/traits.hpp"
 #include "ecole/utility/chrono.hpp"
 
 namespace ecole::data {
@@ -26,6 +27,11 @@ template <typename Clock, typename Func> auto time(Func&& func) -> double {
 
 template <typename Function> class TimedFunction {
 public:
+	/** Read only if the function is, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = trait::is_read_only_data_function_v<Function>;
+	/** Modifies the model if the function does, see trait::is_model_modifying_data_function. */
+	static constexpr bool modifies_model = trait::is_model_modifying_data_function_v<Function>;
+
 	TimedFunction(Function func_, bool wall_ = false) : func{std::move(func_)}, wall{wall_} {}
 	TimedFunction(bool wall_ = false) : wall{wall_} {}
 
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <optional>
 #include <tuple>
+#include <utility>
 
 #include "ecole/data/abstract.hpp"
+#include "ecole/data/concurrent.hpp"
 #include "ecole/traits.hpp"
 
 namespace ecole::data {
@@ -11,12 +16,27 @@ template <typename... Functions> class TupleFunction {
 public:
 	using DataTuple = std::tuple<trait::data_of_t<Functions>...>;
 
+	/** Read only if all functions are, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = (trait::is_read_only_data_function_v<Functions> && ...);
+	/** Modifies the model if any function does, see trait::is_model_modifying_data_function. */
+	static constexpr bool modifies_model = (trait::is_model_modifying_data_function_v<Functions> || ...);
+
 	/** Default construct all functions. */
 	TupleFunction() = default;
 
 	/** Store a copy of the functions. */
 	TupleFunction(Functions... functions) : data_functions{std::move(functions)...} {}
-	TupleFunction(std::tuple<Functions...> functions) : data_functions{std::move(functions)} {}
+
+	/**
+	 * Store a copy of the functions.
+	 *
+	 * @param functions The functions to extract data from.
+	 * @param n_threads_ The maximum number of threads used to extract read only functions concurrently, including
+	 *        the calling thread.
+	 * @see trait::is_read_only_data_function
+	 */
+	TupleFunction(std::tuple<Functions...> functions, std::size_t n_threads_ = 1) :
+		data_functions{std::move(functions)}, n_threads{n_threads_} {}
 
 	/** Call before_reset on all functions. */
 	auto before_reset(scip::Model& model) -> void {
@@ -25,12 +45,30 @@ public:
 
 	/** Return data from all functions as a tuple. */
 	auto extract(scip::Model& model, bool done) -> DataTuple {
+		if constexpr ((trait::is_read_only_data_function_v<Functions> || ...)) {
+			if (can_extract_concurrently(n_threads)) {
+				return extract_concurrently(model, done, std::index_sequence_for<Functions...>{});
+			}
+		}
 		return std::apply(
-			[&model, done](auto&... functions) { return std::tuple{functions.extract(model, done)...}; }, data_functions);
+			[&model, done](auto&... functions) { return DataTuple{extract_data(functions, model, done)...}; },
+			data_functions);
 	}
 
 private:
 	std::tuple<Functions...> data_functions;
+	std::size_t n_threads = 1;
+
+	template <std::size_t... I>
+	auto extract_concurrently(scip::Model& model, bool done, std::index_sequence<I...> /*indices*/) -> DataTuple {
+		auto data = std::tuple<std::optional<trait::data_of_t<Functions>>...>{};
+		auto const read_only_functions = std::array{trait::is_read_only_data_function_v<Functions>...};
+		data::extract_concurrently(model, n_threads, read_only_functions, [&](std::size_t i) {
+			((i == I ? (void)std::get<I>(data).emplace(extract_data(std::get<I>(data_functions), model, done)) : void()),
+			 ...);
+		});
+		return {std::move(std::get<I>(data)).value()...};
+	}
 };
 
 }  // namespace ecole::data
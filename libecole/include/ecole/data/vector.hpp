@@ -1,11 +1,14 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include "ecole/data/abstract.hpp"
+#include "ecole/data/concurrent.hpp"
 #include "ecole/traits.hpp"
 
 namespace ecole::data {
@@ -15,11 +18,24 @@ template <typename Function> class VectorFunction {
 public:
 	using DataVector = std::vector<trait::data_of_t<Function>>;
 
+	/** Read only if all functions are, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = trait::is_read_only_data_function_v<Function>;
+	/** Modifies the model if any function does, see trait::is_model_modifying_data_function. */
+	static constexpr bool modifies_model = trait::is_model_modifying_data_function_v<Function>;
+
 	/** Default construct all functions. */
 	VectorFunction() = default;
 
-	/** Store a copy of the functions. */
-	VectorFunction(std::vector<Function> functions) : data_functions{std::move(functions)} {}
+	/**
+	 * Store a copy of the functions.
+	 *
+	 * @param functions The functions to extract data from.
+	 * @param n_threads_ The maximum number of threads used to extract read only functions concurrently, including
+	 *        the calling thread.
+	 * @see trait::is_read_only_data_function
+	 */
+	VectorFunction(std::vector<Function> functions, std::size_t n_threads_ = 1) :
+		data_functions{std::move(functions)}, n_threads{n_threads_} {}
 
 	/** Call before_reset on all functions. */
 	auto before_reset(scip::Model& model) -> void {
@@ -30,16 +46,36 @@ public:
 
 	/** Return data extracted from all functions as a vector. */
 	auto extract(scip::Model& model, bool done) -> DataVector {
+		if constexpr (read_only) {
+			if (can_extract_concurrently(n_threads)) {
+				return extract_concurrently(model, done);
+			}
+		}
 		auto data = DataVector{};
 		data.reserve(data_functions.size());
 		std::transform(data_functions.begin(), data_functions.end(), std::back_inserter(data), [&model, done](auto& func) {
-			return func.extract(model, done);
+			return extract_data(func, model, done);
 		});
 		return data;
 	}
 
 private:
 	std::vector<Function> data_functions;
+	std::size_t n_threads = 1;
+
+	auto extract_concurrently(scip::Model& model, bool done) -> DataVector {
+		auto data = std::vector<std::optional<trait::data_of_t<Function>>>(data_functions.size());
+		extract_read_only_concurrently(model, n_threads, data_functions.size(), [&](std::size_t i) {
+			data[i].emplace(data_functions[i].extract(model, done));
+		});
+
+		auto data_vector = DataVector{};
+		data_vector.reserve(data.size());
+		std::transform(data.begin(), data.end(), std::back_inserter(data_vector), [](auto& maybe_data) {
+			return std::move(maybe_data).value();
+		});
+		return data_vector;
+	}
 };
 
 }  // namespace ecole::data
@@ -18,14 +18,34 @@ public:
 
 	using DefaultSetDynamicsRandomState::set_dynamics_random_state;
 
-	ECOLE_EXPORT BranchingDynamics(bool pseudo_candidates = false) noexcept;
+	/**
+	 * Create new dynamics.
+	 *
+	 * @param pseudo_candidates Whether the action set contains pseudo branching candidates rather than LP ones.
+	 * @param reuse_strong_branching Whether branching on a variable that was just scored by strong branching (for
+	 *        instance by observation::StrongBranchingScores) reuses its result, as SCIP strong branching rules do.
+	 *        The children lower bounds are set from the strong branching LPs, and a variable with an infeasible child
+	 *        has its bound tightened (or the node cut off) instead of being branched on.
+	 */
+	ECOLE_EXPORT BranchingDynamics(bool pseudo_candidates = false, bool reuse_strong_branching = false) noexcept;
 
 	ECOLE_EXPORT auto reset_dynamics(scip::Model& model) const -> std::tuple<bool, ActionSet>;
 
 	ECOLE_EXPORT auto step_dynamics(scip::Model& model, Action maybe_var_idx) const -> std::tuple<bool, ActionSet>;
 
+	/**
+	 * Apply the branching decision and let solving continue in the background.
+	 *
+	 * The transition must be completed with ``step_dynamics_wait`` before the model is used again.
+	 */
+	ECOLE_EXPORT auto step_dynamics_async(scip::Model& model, Action maybe_var_idx) const -> void;
+
+	/** Wait for solving resumed by ``step_dynamics_async`` to reach the next branching decision. */
+	ECOLE_EXPORT auto step_dynamics_wait(scip::Model& model) const -> std::tuple<bool, ActionSet>;
+
 private:
 	bool pseudo_candidates;
+	bool reuse_strong_branching;
 };
 
 }  // namespace ecole::dynamics
@@ -13,6 +13,7 @@
 #include "ecole/scip/model.hpp"
 #include "ecole/scip/seed.hpp"
 #include "ecole/traits.hpp"
+#include "ecole/utility/profiler.hpp"
 
 #include <optional>
 
@@ -104,6 +105,8 @@ public:
 	auto reset(scip::Model&& new_model, Args&&... args)
 		-> std::tuple<OptionalObservation, ActionSet, Reward, bool, InformationMap> {
 		can_transition = true;
+		awaiting_recv = false;
+		pending_action.reset();
 		try {
 			// Create clean new Model
 			model() = std::move(new_model);
@@ -166,9 +169,7 @@ public:
 	template <typename... Args>
 	auto step(Action const& action, Args&&... args)
 		-> std::tuple<OptionalObservation, ActionSet, Reward, bool, InformationMap> {
-		if (!can_transition) {
-			throw MarkovError{"Environment need to be reset."};
-		}
+		check_can_step();
 		try {
 			// Transition the environment to the next state
 			auto [done, action_set] = dynamics().step_dynamics(model(), action, std::forward<Args>(args)...);
@@ -190,6 +191,71 @@ public:
 		}
 	}
 
+	/**
+	 * Start a transition without waiting for it to complete.
+	 *
+	 * When the dynamics support it, the transition is computed in the background, letting the caller do other work,
+	 * such as computing the actions of other environments, until the result is received with recv.
+	 * Otherwise, the whole transition is computed in recv.
+	 * The environment must not be used until recv is called.
+	 *
+	 * @param action Passed to the EnvironmentDynamics.
+	 * @pre Same as for step.
+	 * @see recv
+	 */
+	auto step_async(Action const& action) -> void {
+		check_can_step();
+		try {
+			if constexpr (trait::has_async_step_dynamics_v<Dynamics>) {
+				dynamics().step_dynamics_async(model(), action);
+			} else {
+				pending_action = action;
+			}
+			awaiting_recv = true;
+		} catch (std::exception const&) {
+			can_transition = false;
+			throw;
+		}
+	}
+
+	/**
+	 * Complete the transition started with step_async.
+	 *
+	 * @return Same as step.
+	 * @pre A call to step_async must have been done prior to receiving.
+	 */
+	auto recv() -> std::tuple<OptionalObservation, ActionSet, Reward, bool, InformationMap> {
+		if (!awaiting_recv) {
+			throw MarkovError{"No transition started with step_async."};
+		}
+		awaiting_recv = false;
+		try {
+			auto [done, action_set] = [this] {
+				if constexpr (trait::has_async_step_dynamics_v<Dynamics>) {
+					return dynamics().step_dynamics_wait(model());
+				} else {
+					auto action = std::move(pending_action).value();
+					pending_action.reset();
+					return dynamics().step_dynamics(model(), action);
+				}
+			}();
+			can_transition = !done;
+
+			auto [reward, observation, information] = extract_reward_observation_information(done);
+
+			return {
+				std::move(observation),
+				std::move(action_set),
+				std::move(reward),
+				done,
+				std::move(information),
+			};
+		} catch (std::exception const&) {
+			can_transition = false;
+			throw;
+		}
+	}
+
 	auto& dynamics() { return the_dynamics; }
 	auto& model() { return the_model; }
 	auto& observation_function() { return the_observation_function; }
@@ -207,13 +273,45 @@ private:
 	std::map<std::string, scip::Param> the_scip_params;
 	RandomGenerator the_rng;
 	bool can_transition = false;
+	bool awaiting_recv = false;
+	// Action of step_async, for dynamics that cannot step asynchronously
+	std::optional<Action> pending_action;
+
+	auto check_can_step() const -> void {
+		if (!can_transition) {
+			throw MarkovError{"Environment need to be reset."};
+		}
+		if (awaiting_recv) {
+			throw MarkovError{"Environment is waiting for a call to recv."};
+		}
+	}
 
 	// extract reward, observation and information (in that order)
 	auto extract_reward_observation_information(bool done) -> std::tuple<Reward, OptionalObservation, InformationMap> {
-		auto reward = reward_function().extract(model(), done);
+		// Solver statistics are read at most once for all data functions that do not modify the model
+		auto const statistics_step = scip::StatisticsStep{model().statistics()};
+		auto reward = [&] {
+			auto const scope =
+				utility::ProfileScope{utility::profile_name<RewardFunction>(), utility::ProfileCategory::reward};
+			return reward_function().extract(model(), done);
+		}();
+		if constexpr (trait::is_model_modifying_data_function_v<RewardFunction>) {
+			model().statistics().invalidate();
+		}
 		// Don't extract observations in final states
-		auto observation = done ? OptionalObservation{} : observation_function().extract(model(), done);
-		auto information = information_function().extract(model(), done);
+		auto observation = [&] {
+			auto const scope =
+				utility::ProfileScope{utility::profile_name<ObservationFunction>(), utility::ProfileCategory::observation};
+			return done ? OptionalObservation{} : observation_function().extract(model(), done);
+		}();
+		if constexpr (trait::is_model_modifying_data_function_v<ObservationFunction>) {
+			model().statistics().invalidate();
+		}
+		auto information = [&] {
+			auto const scope =
+				utility::ProfileScope{utility::profile_name<InformationFunction>(), utility::ProfileCategory::information};
+			return information_function().extract(model(), done);
+		}();
 
 		return {std::move(reward), std::move(observation), std::move(information)};
 	}
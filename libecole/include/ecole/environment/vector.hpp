@@ -0,0 +1,251 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <xtensor/xbuilder.hpp>
+#include <xtensor/xtensor.hpp>
+
+#include "ecole/environment/environment.hpp"
+#include "ecole/random.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/utility/thread-pool.hpp"
+
+namespace ecole::environment {
+
+/**
+ * Multiple environments transitioned together in parallel.
+ *
+ * All environments are reset and stepped as a batch, the work being split among threads owned by the vector
+ * environment and the calling thread.
+ * Every environment is always transitioned on the same thread, as required by the fiber coroutine backend, the
+ * environment ``i`` running on the calling thread if ``i`` is a multiple of the number of threads.
+ * Environments that reach a terminal state are automatically reset on a new instance, so that every environment can
+ * always be stepped.
+ *
+ * The data functions of the environments are called concurrently and must therefore not share any state.
+ *
+ * @tparam Dynamics The ecole::environment::EnvironmentDynamics of every environment.
+ * @tparam ObservationFunction The ecole::observation::ObservationFunction of every environment.
+ * @tparam RewardFunction The ecole::reward::RewardFunction of every environment.
+ * @tparam InformationFunction The ecole::information::InformationFunction of every environment.
+ */
+template <typename Dynamics, typename ObservationFunction, typename RewardFunction, typename InformationFunction>
+class VectorEnvironment {
+public:
+	using Environment = environment::Environment<Dynamics, ObservationFunction, RewardFunction, InformationFunction>;
+	using Seed = ecole::Seed;
+	using OptionalObservation = typename Environment::OptionalObservation;
+	using Action = typename Environment::Action;
+	using ActionSet = typename Environment::ActionSet;
+	using Reward = typename Environment::Reward;
+	using InformationMap = typename Environment::InformationMap;
+	/** Called, always from the same thread, to get the instance on which to reset an environment. */
+	using InstanceSource = std::function<scip::Model()>;
+
+	/** Batched result of a transition, with one element per environment. */
+	struct Transition {
+		std::vector<OptionalObservation> observations;
+		std::vector<ActionSet> action_sets;
+		xt::xtensor<Reward, 1> rewards;
+		xt::xtensor<bool, 1> dones;
+		std::vector<InformationMap> informations;
+	};
+
+	/**
+	 * Create a vector environment from independent environments.
+	 *
+	 * @param environments The environments to transition in parallel.
+	 * @param instance_source Provide the instances on which environments are reset.
+	 * @param n_threads The maximum number of threads used to transition the environments, including the calling thread.
+	 */
+	VectorEnvironment(
+		std::vector<Environment> environments,
+		InstanceSource instance_source,
+		std::size_t n_threads = std::thread::hardware_concurrency()) :
+		m_environments{std::move(environments)},
+		m_instance_source{std::move(instance_source)},
+		m_n_threads{std::max<std::size_t>(n_threads, 1)} {
+		// Pools of a single worker always run their tasks on the same thread
+		m_workers.reserve(m_n_threads - 1);
+		for (std::size_t worker = 1; worker < m_n_threads; ++worker) {
+			m_workers.push_back(std::make_unique<utility::ThreadPool>(1));
+		}
+	}
+
+	[[nodiscard]] auto size() const noexcept -> std::size_t { return m_environments.size(); }
+	[[nodiscard]] auto n_threads() const noexcept -> std::size_t { return m_n_threads; }
+	auto& environments() noexcept { return m_environments; }
+	auto& instance_source() noexcept { return m_instance_source; }
+
+	/**
+	 * Seed every environment with a different seed derived from the one given.
+	 */
+	void seed(Seed new_seed) {
+		auto rng = RandomGenerator{new_seed};
+		auto seed_distrib = std::uniform_int_distribution<Seed>{};
+		for (auto& env : m_environments) {
+			env.seed(seed_distrib(rng));
+		}
+	}
+
+	/**
+	 * Reset all environments to the initial state of new instances.
+	 *
+	 * Environments whose initial state is terminal are reset again on the next instance until a non terminal one is
+	 * found.
+	 * The rewards are the reward offsets of the episodes started, and the done flags are all false.
+	 */
+	auto reset() -> Transition {
+		auto transition = make_transition();
+		auto indices = std::vector<std::size_t>(size());
+		std::iota(indices.begin(), indices.end(), std::size_t{0});
+		reset_until_not_done(std::move(indices), transition, true);
+		return transition;
+	}
+
+	/**
+	 * Step all environments with one action each.
+	 *
+	 * The environments that reach a terminal state are automatically reset.
+	 * For those, the observation and action set are the ones of the new episode, while the reward, done flag (true),
+	 * and information are the ones of the terminal transition.
+	 * The reward offset of the new episode is discarded.
+	 *
+	 * @param actions The actions to take, in the same order as the environments.
+	 * @throw std::invalid_argument if there is not exactly one action per environment.
+	 */
+	auto step(std::vector<Action> const& actions) -> Transition {
+		if (actions.size() != size()) {
+			throw std::invalid_argument{"Expected exactly one action per environment."};
+		}
+		auto transition = make_transition();
+		auto indices = std::vector<std::size_t>(size());
+		std::iota(indices.begin(), indices.end(), std::size_t{0});
+		for_each_environment(indices, [&](std::size_t env_idx) {
+			auto [obs, action_set, reward, done, info] = m_environments[env_idx].step(actions[env_idx]);
+			transition.observations[env_idx] = std::move(obs);
+			transition.action_sets[env_idx] = std::move(action_set);
+			transition.rewards(env_idx) = reward;
+			transition.dones(env_idx) = done;
+			transition.informations[env_idx] = std::move(info);
+		});
+
+		auto finished = std::vector<std::size_t>{};
+		for (std::size_t env_idx = 0; env_idx < size(); ++env_idx) {
+			if (transition.dones(env_idx)) {
+				finished.push_back(env_idx);
+			}
+		}
+		reset_until_not_done(std::move(finished), transition, false);
+		return transition;
+	}
+
+private:
+	std::vector<Environment> m_environments;
+	InstanceSource m_instance_source;
+	std::size_t m_n_threads;
+	/** The worker ``w`` runs the environments ``i`` with ``i % n_threads == w + 1``, behind pointers to be movable. */
+	std::vector<std::unique_ptr<utility::ThreadPool>> m_workers;
+
+	auto make_transition() const -> Transition {
+		return {
+			std::vector<OptionalObservation>(size()),
+			std::vector<ActionSet>(size()),
+			xt::zeros<Reward>({size()}),
+			xt::zeros<bool>({size()}),
+			std::vector<InformationMap>(size()),
+		};
+	}
+
+	/**
+	 * Reset the given environments until none of them is on a terminal state.
+	 *
+	 * Instances are drawn sequentially from the instance source, in the order of the environments, to keep the
+	 * assignment deterministic.
+	 */
+	auto reset_until_not_done(std::vector<std::size_t> indices, Transition& transition, bool record_transition)
+		-> void {
+		while (!indices.empty()) {
+			auto instances = std::vector<scip::Model>{};
+			instances.reserve(indices.size());
+			for ([[maybe_unused]] auto const env_idx : indices) {
+				instances.push_back(m_instance_source());
+			}
+
+			auto dones = std::vector<char>(indices.size(), false);  // Not vector<bool> for concurrent writes
+			for_each_environment(indices, [&](std::size_t i) {
+				auto const env_idx = indices[i];
+				auto [obs, action_set, reward, done, info] = m_environments[env_idx].reset(std::move(instances[i]));
+				transition.observations[env_idx] = std::move(obs);
+				transition.action_sets[env_idx] = std::move(action_set);
+				if (record_transition) {
+					transition.rewards(env_idx) = reward;
+					transition.informations[env_idx] = std::move(info);
+				}
+				dones[i] = done;
+			});
+
+			auto not_reset = std::vector<std::size_t>{};
+			for (std::size_t i = 0; i < indices.size(); ++i) {
+				if (dones[i]) {
+					not_reset.push_back(indices[i]);
+				}
+			}
+			indices = std::move(not_reset);
+		}
+	}
+
+	/**
+	 * Call the function on all positions ``i`` of the environment indices, on the thread of environment ``indices[i]``.
+	 *
+	 * All calls are waited for, even if one throws, after what the first exception is rethrown.
+	 */
+	template <typename Function>
+	auto for_each_environment(std::vector<std::size_t> const& indices, Function const& func) -> void {
+		auto const run_worker = [&indices, &func, n_threads = m_n_threads](std::size_t worker) {
+			for (std::size_t i = 0; i < indices.size(); ++i) {
+				if (indices[i] % n_threads == worker) {
+					func(i);
+				}
+			}
+		};
+
+		auto futures = std::vector<std::future<void>>{};
+		futures.reserve(m_workers.size());
+		for (std::size_t worker = 1; worker < std::min(m_n_threads, size()); ++worker) {
+			futures.push_back(m_workers[worker - 1]->submit([&run_worker, worker] { run_worker(worker); }));
+		}
+
+		auto exception = std::exception_ptr{};
+		try {
+			run_worker(0);
+		} catch (...) {
+			exception = std::current_exception();
+		}
+		for (auto& future : futures) {
+			try {
+				future.get();
+			} catch (...) {
+				if (!exception) {
+					exception = std::current_exception();
+				}
+			}
+		}
+		if (exception) {
+			std::rethrow_exception(exception);
+		}
+	}
+};
+
+}  // namespace ecole::environment
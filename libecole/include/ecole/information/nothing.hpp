@@ -13,6 +13,9 @@ namespace ecole::information {
  */
 class Nothing {
 public:
+	/** Extraction does not read the model, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = true;
+
 	auto before_reset(scip::Model& /*model*/) -> void {}
 
 	auto extract(scip::Model& /* model */, bool /* done */) -> InformationMap<NoneType> { return {}; }
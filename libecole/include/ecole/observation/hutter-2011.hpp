@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <tuple>
+#include <vector>
 
 #include <xtensor/xtensor.hpp>
 
@@ -69,8 +73,52 @@ struct ECOLE_EXPORT Hutter2011Obs {
 
 class ECOLE_EXPORT Hutter2011 {
 public:
-	auto before_reset(scip::Model& /*model*/) -> void {}
+	/**
+	 * Create the observation function.
+	 *
+	 * @param approximate_degrees Whether to estimate the node degrees of the variable graph rather than computing them
+	 *        exactly.
+	 *        The exact computation is quadratic in the size of the constraints, which is too slow on problems with
+	 *        dense constraints, while the estimation is linear.
+	 * @param degree_sketch_size The number of hashes kept to estimate the size of a neighborhood.
+	 *        Degrees smaller than the sketch size are exact, larger ones have a relative standard error of about
+	 *        ``1 / sqrt(degree_sketch_size - 2)``.
+	 * @param direct_lp_relaxation Whether to solve the LP relaxation directly with the LP interface, rather than
+	 *        solving a copy of the model where all variables are continuous.
+	 *        This skips the copy and the presolving of the model.
+	 */
+	Hutter2011(
+		bool approximate_degrees_ = false,
+		std::size_t degree_sketch_size_ = 256,
+		bool direct_lp_relaxation_ = false) noexcept :
+		approximate_degrees{approximate_degrees_},
+		degree_sketch_size{degree_sketch_size_},
+		direct_lp_relaxation{direct_lp_relaxation_} {}
+
+	/** Forget the LP relaxation of the previous model. */
+	auto before_reset(scip::Model& /*model*/) -> void { lp_relaxation.reset(); }
+
+	/**
+	 * Extract the features of the model.
+	 *
+	 * The LP relaxation is only solved on the first call for a given model, as identified by scip::Model::id, and
+	 * reused until the number of variables or constraints changes.
+	 */
 	ECOLE_EXPORT auto extract(scip::Model& model, bool done) -> std::optional<Hutter2011Obs>;
+
+private:
+	/** Solution and objective value of the LP relaxation of a model. */
+	struct LpRelaxation {
+		/** The model identifier, number of variables, and number of constraints for which the relaxation was solved. */
+		std::tuple<std::uint64_t, std::size_t, std::size_t> key;
+		std::vector<double> solution;
+		double objective;
+	};
+
+	bool approximate_degrees;
+	std::size_t degree_sketch_size;
+	bool direct_lp_relaxation;
+	std::optional<LpRelaxation> lp_relaxation;
 };
 
 }  // namespace ecole::observation
@@ -1,12 +1,14 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
 #include <optional>
 
 #include <xtensor/xtensor.hpp>
 
 #include "ecole/export.hpp"
 #include "ecole/observation/abstract.hpp"
+#include "ecole/utility/thread-pool.hpp"
 
 namespace ecole::observation {
 
@@ -104,20 +106,53 @@ struct ECOLE_EXPORT Khalil2016Obs {
 		active_coef_weight4_max,
 	};
 
+	/** One row per variable, or per candidate in compact mode. */
 	xt::xtensor<double, 2> features;
+	/** Problem index of the candidates, in the order of the branching action set. */
+	xt::xtensor<std::size_t, 1> candidates;
 };
 
 class ECOLE_EXPORT Khalil2016 {
 public:
-	ECOLE_EXPORT Khalil2016(bool pseudo_candidates = false) noexcept;
+	/** Extraction only reads the model, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = true;
+
+	/**
+	 * Create the observation function.
+	 *
+	 * @param pseudo_candidates Whether to observe the pseudo branching candidates rather than the LP ones.
+	 * @param compact Whether to only have one row of features per candidate, in the order of Khalil2016Obs::candidates,
+	 *        rather than one row per variable with NaN for the variables that are not candidates.
+	 * @param n_threads The number of threads, including the calling one, computing the dynamic features of the
+	 *        candidates.
+	 *        The SCIP data they need is copied beforehand, so that SCIP is never called concurrently.
+	 *        Copies of the observation function share the same threads.
+	 */
+	ECOLE_EXPORT Khalil2016(bool pseudo_candidates = false, bool compact = false, std::size_t n_threads = 1);
 
 	ECOLE_EXPORT auto before_reset(scip::Model& model) -> void;
 
 	ECOLE_EXPORT auto extract(scip::Model& model, bool done) -> std::optional<Khalil2016Obs>;
 
+	/**
+	 * Extract the observation in place in a previously allocated observation.
+	 *
+	 * The features are only reallocated when their number of rows changes, so that reusing the same output during
+	 * an episode avoids allocating memory on every extraction.
+	 *
+	 * @return Whether an observation was extracted, in which case the output was overwritten.
+	 */
+	ECOLE_EXPORT auto extract_into(scip::Model& model, bool done, Khalil2016Obs& obs) -> bool;
+
 private:
 	bool pseudo_candidates;
+	bool compact;
+	std::size_t n_threads;
+	/** Only created with more than one thread. */
+	std::shared_ptr<utility::ThreadPool> thread_pool;
 	xt::xtensor<double, 2> static_features;
+	/** Buffer for the weights of the LP rows, reused between extractions. */
+	xt::xtensor<double, 2> lp_rows_weights;
 };
 
 }  // namespace ecole::observation
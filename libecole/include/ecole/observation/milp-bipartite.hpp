@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 
 #include <xtensor/xtensor.hpp>
@@ -10,10 +12,8 @@
 
 namespace ecole::observation {
 
-class ECOLE_EXPORT MilpBipartiteObs {
-public:
-	using value_type = double;
-
+/** Features of the MilpBipartite observation, independently of the types used to store them. */
+struct ECOLE_EXPORT MilpBipartiteFeatures {
 	static inline std::size_t constexpr n_variable_features = 9;
 	enum struct ECOLE_EXPORT VariableFeatures : std::size_t {
 		objective = 0,
@@ -30,22 +30,68 @@ public:
 	enum struct ECOLE_EXPORT ConstraintFeatures : std::size_t {
 		bias = 0,
 	};
+};
+
+/**
+ * Bipartite graph observation of the whole problem.
+ *
+ * @tparam Value The type of the features.
+ * @tparam Index The type of the indices of the edges, extraction throws std::overflow_error if they do not fit.
+ * @tparam SparseMatrix The format of the edges, either utility::coo_matrix or utility::csr_matrix.
+ */
+template <typename Value, typename Index, template <typename, typename> typename SparseMatrix = utility::coo_matrix>
+class BasicMilpBipartiteObs : public MilpBipartiteFeatures {
+public:
+	using value_type = Value;
+	using index_type = Index;
 
 	xt::xtensor<value_type, 2> variable_features;
 	xt::xtensor<value_type, 2> constraint_features;
-	utility::coo_matrix<value_type> edge_features;
+	SparseMatrix<value_type, index_type> edge_features;
 };
 
-class ECOLE_EXPORT MilpBipartite {
+using MilpBipartiteObs = BasicMilpBipartiteObs<double, std::size_t>;
+/** Single precision features and 32 bits indices, using half the memory of the default observation. */
+using MilpBipartiteObs32 = BasicMilpBipartiteObs<float, std::int32_t>;
+/** Edges in the compressed sparse row format, with signed indices to be used without copy in Scipy and PyTorch. */
+using MilpBipartiteCsrObs = BasicMilpBipartiteObs<double, std::int64_t, utility::csr_matrix>;
+using MilpBipartiteCsrObs32 = BasicMilpBipartiteObs<float, std::int32_t, utility::csr_matrix>;
+
+/**
+ * Observation function for BasicMilpBipartiteObs.
+ *
+ * The function is explicitly instantiated for the value types ``double`` and ``float``, and the index types
+ * ``std::size_t`` and ``std::int32_t`` with utility::coo_matrix edges, as well as for the types of
+ * MilpBipartiteCsrObs and MilpBipartiteCsrObs32 with utility::csr_matrix edges.
+ */
+template <typename Value, typename Index, template <typename, typename> typename SparseMatrix = utility::coo_matrix>
+class ECOLE_EXPORT BasicMilpBipartite {
 public:
-	MilpBipartite(bool normalize_ = false) : normalize{normalize_} {}
+	/** Extraction only reads the model, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = true;
+
+	using Observation = BasicMilpBipartiteObs<Value, Index, SparseMatrix>;
+
+	BasicMilpBipartite(bool normalize_ = false) : normalize{normalize_} {}
 
 	auto before_reset(scip::Model& /*model*/) -> void {}
 
-	ECOLE_EXPORT auto extract(scip::Model& model, bool done) const -> std::optional<MilpBipartiteObs>;
+	ECOLE_EXPORT auto extract(scip::Model& model, bool done) const -> std::optional<Observation>;
 
 private:
 	bool normalize = false;
 };
 
+extern template class BasicMilpBipartite<double, std::size_t>;
+extern template class BasicMilpBipartite<double, std::int32_t>;
+extern template class BasicMilpBipartite<float, std::size_t>;
+extern template class BasicMilpBipartite<float, std::int32_t>;
+extern template class BasicMilpBipartite<double, std::int64_t, utility::csr_matrix>;
+extern template class BasicMilpBipartite<float, std::int32_t, utility::csr_matrix>;
+
+using MilpBipartite = BasicMilpBipartite<double, std::size_t>;
+using MilpBipartite32 = BasicMilpBipartite<float, std::int32_t>;
+using MilpBipartiteCsr = BasicMilpBipartite<double, std::int64_t, utility::csr_matrix>;
+using MilpBipartiteCsr32 = BasicMilpBipartite<float, std::int32_t, utility::csr_matrix>;
+
 }  // namespace ecole::observation
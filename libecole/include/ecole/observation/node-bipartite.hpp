@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <string>
+#include <vector>
 
 #include <xtensor/xtensor.hpp>
 
@@ -10,9 +14,8 @@
 
 namespace ecole::observation {
 
-struct ECOLE_EXPORT NodeBipartiteObs {
-	using value_type = double;
-
+/** Features of the NodeBipartite observation, independently of the types used to store them. */
+struct ECOLE_EXPORT NodeBipartiteFeatures {
 	static inline std::size_t constexpr n_static_variable_features = 5;
 	static inline std::size_t constexpr n_dynamic_variable_features = 14;
 	static inline std::size_t constexpr n_variable_features = n_static_variable_features + n_dynamic_variable_features;
@@ -54,24 +57,128 @@ struct ECOLE_EXPORT NodeBipartiteObs {
 		dual_solution_value,
 		scaled_age,
 	};
+};
+
+/**
+ * Bipartite graph observation for branch-and-bound nodes.
+ *
+ * @tparam Value The type of the features.
+ * @tparam Index The type of the indices of the edges, extraction throws std::overflow_error if they do not fit.
+ * @tparam SparseMatrix The format of the edges, either utility::coo_matrix or utility::csr_matrix.
+ */
+template <typename Value, typename Index, template <typename, typename> typename SparseMatrix = utility::coo_matrix>
+struct BasicNodeBipartiteObs : NodeBipartiteFeatures {
+	using value_type = Value;
+	using index_type = Index;
 
 	xt::xtensor<value_type, 2> variable_features;
 	xt::xtensor<value_type, 2> row_features;
-	utility::coo_matrix<value_type> edge_features;
+	SparseMatrix<value_type, index_type> edge_features;
 };
 
-class ECOLE_EXPORT NodeBipartite {
+using NodeBipartiteObs = BasicNodeBipartiteObs<double, std::size_t>;
+/** Single precision features and 32 bits indices, using half the memory of the default observation. */
+using NodeBipartiteObs32 = BasicNodeBipartiteObs<float, std::int32_t>;
+/** Edges in the compressed sparse row format, with signed indices to be used without copy in Scipy and PyTorch. */
+using NodeBipartiteCsrObs = BasicNodeBipartiteObs<double, std::int64_t, utility::csr_matrix>;
+using NodeBipartiteCsrObs32 = BasicNodeBipartiteObs<float, std::int32_t, utility::csr_matrix>;
+
+/**
+ * Observation function for BasicNodeBipartiteObs.
+ *
+ * Features are computed in double precision and written directly in the type and sparse format of the observation.
+ * The function is explicitly instantiated for the value types ``double`` and ``float``, and the index types
+ * ``std::size_t`` and ``std::int32_t`` with utility::coo_matrix edges, as well as for the types of
+ * NodeBipartiteCsrObs and NodeBipartiteCsrObs32 with utility::csr_matrix edges.
+ */
+template <typename Value, typename Index, template <typename, typename> typename SparseMatrix = utility::coo_matrix>
+class ECOLE_EXPORT BasicNodeBipartite {
 public:
-	NodeBipartite(bool cache = false) : use_cache{cache} {}
+	/** Extraction only reads the model, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = true;
+
+	using Observation = BasicNodeBipartiteObs<Value, Index, SparseMatrix>;
+
+	/**
+	 * Create the observation function.
+	 *
+	 * @param cache Whether to reuse the static features computed on the root node.
+	 * @param incremental Whether to keep the observation from one extraction to the next, and only recompute the edges
+	 *        and row features of the LP rows added, removed, or modified in between, as reported by SCIP row events.
+	 *        The rows that did not change keep their position in the observation.
+	 * @param track_columns Whether to only recompute the dynamic features of the variables whose column changed since
+	 *        the previous extraction, that is whose bounds, LP value, basis status, or dual values of its rows changed.
+	 *        Features depending on global solver state, such as the age and incumbent values, are still updated for
+	 *        all variables.
+	 *        This only applies when the observation is kept between extractions, that is with cache or incremental.
+	 */
+	ECOLE_EXPORT BasicNodeBipartite(bool cache = false, bool incremental = false, bool track_columns = false);
 
 	ECOLE_EXPORT auto before_reset(scip::Model& model) -> void;
 
-	ECOLE_EXPORT auto extract(scip::Model& model, bool done) -> std::optional<NodeBipartiteObs>;
+	ECOLE_EXPORT auto extract(scip::Model& model, bool done) -> std::optional<Observation>;
+
+	/**
+	 * Extract the observation in place in a previously allocated observation.
+	 *
+	 * The tensors of the output are only reallocated when their shape changes, so that reusing the same output during
+	 * an episode avoids allocating memory on every extraction.
+	 *
+	 * @return Whether an observation was extracted, in which case the output was overwritten.
+	 */
+	ECOLE_EXPORT auto extract_into(scip::Model& model, bool done, Observation& obs) -> bool;
 
 private:
-	NodeBipartiteObs the_cache;
+	/** Position of an LP row in the incrementally maintained observation. */
+	struct RowSlot {
+		int lp_row_index;
+		std::size_t feature_row;
+		std::size_t edge_offset;
+	};
+
+	/** LP state of a column when the features of its variable were last computed. */
+	struct ColumnState {
+		double lower_bound;
+		double upper_bound;
+		double primal_solution;
+		int basis_status;
+	};
+
+	/** Dual value of an LP row when the variable features were last computed. */
+	struct RowDual {
+		int lp_row_index;
+		double dual_solution;
+	};
+
+	Observation the_cache;
+	std::vector<RowSlot> row_slots;
+	/** SCIP indices of the LP columns when the row slots were last updated. */
+	std::vector<int> lp_column_indices;
+	std::vector<ColumnState> column_states;
+	std::vector<RowDual> row_duals;
+	long long n_sols_found = 0;
+	std::string event_handler_name;
 	bool use_cache = false;
+	bool use_incremental = false;
+	bool use_column_tracking = false;
 	bool cache_computed = false;
+
+	auto extract_incrementally(scip::Model& model) -> void;
+	auto update_row_slots(scip::Model& model, std::size_t first_slot) -> void;
+	auto update_variable_features(scip::Model& model, bool update_static) -> void;
+	auto update_changed_variable_features(scip::Model& model, bool update_static) -> void;
 };
 
+extern template class BasicNodeBipartite<double, std::size_t>;
+extern template class BasicNodeBipartite<double, std::int32_t>;
+extern template class BasicNodeBipartite<float, std::size_t>;
+extern template class BasicNodeBipartite<float, std::int32_t>;
+extern template class BasicNodeBipartite<double, std::int64_t, utility::csr_matrix>;
+extern template class BasicNodeBipartite<float, std::int32_t, utility::csr_matrix>;
+
+using NodeBipartite = BasicNodeBipartite<double, std::size_t>;
+using NodeBipartite32 = BasicNodeBipartite<float, std::int32_t>;
+using NodeBipartiteCsr = BasicNodeBipartite<double, std::int64_t, utility::csr_matrix>;
+using NodeBipartiteCsr32 = BasicNodeBipartite<float, std::int32_t, utility::csr_matrix>;
+
 }  // namespace ecole::observation
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <optional>
 
 #include <xtensor/xtensor.hpp>
@@ -11,9 +12,65 @@ namespace ecole::observation {
 
 class ECOLE_EXPORT Pseudocosts {
 public:
+	/** Extraction only reads the model, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = true;
+
 	auto before_reset(scip::Model& /*model*/) -> void {}
 
 	ECOLE_EXPORT auto extract(scip::Model& model, bool done) -> std::optional<xt::xtensor<double, 1>>;
 };
 
+struct ECOLE_EXPORT ExtendedPseudocostsObs {
+	static inline std::size_t constexpr n_features = 9;
+
+	enum struct ECOLE_EXPORT Features : std::size_t {
+		/** Predicted objective gain of the children, for the current distance to the closest integers (2) */
+		pseudocost_down = 0,
+		pseudocost_up,
+		/** Number of pseudocost updates (2) */
+		count_down,
+		count_up,
+		/** Empirical variance of the pseudocost per unit change (2) */
+		variance_down,
+		variance_up,
+		/**
+		 * Width of the one-sided 95% confidence bound of the pseudocost per unit change, i.e. the half width of the
+		 * two-sided 90% interval, as computed by SCIP with SCIP_CONFIDENCELEVEL_HIGH (2)
+		 */
+		confidence_down,
+		confidence_up,
+		/** SCIP pseudocost score, the same as the Pseudocosts observation (1) */
+		score,
+	};
+
+	/** One row per candidate, in the order of candidates. */
+	xt::xtensor<double, 2> features;
+	/** Problem index of the LP branching candidates, in the order of the branching action set. */
+	xt::xtensor<std::size_t, 1> candidates;
+};
+
+/**
+ * Pseudocosts and their statistics for all LP branching candidates.
+ *
+ * A cheaper alternative to Khalil2016 for policies that only need pseudocost information.
+ */
+class ECOLE_EXPORT ExtendedPseudocosts {
+public:
+	/** Extraction only reads the model, see trait::is_read_only_data_function. */
+	static constexpr bool read_only = true;
+
+	auto before_reset(scip::Model& /*model*/) -> void {}
+
+	ECOLE_EXPORT auto extract(scip::Model& model, bool done) -> std::optional<ExtendedPseudocostsObs>;
+
+	/**
+	 * Extract the observation in place in a previously allocated observation.
+	 *
+	 * The features are only reallocated when the number of candidates changes.
+	 *
+	 * @return Whether an observation was extracted, in which case the output was overwritten.
+	 */
+	ECOLE_EXPORT auto extract_into(scip::Model& model, bool done, ExtendedPseudocostsObs& obs) -> bool;
+};
+
 }  // namespace ecole::observation
@@ -1,26 +1,64 @@
 #pragma once
 
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <optional>
 
+#include <nonstd/span.hpp>
 #include <xtensor/xtensor.hpp>
 #include <xtensor/xview.hpp>
 
 #include "ecole/export.hpp"
 #include "ecole/observation/abstract.hpp"
+#include "ecole/random.hpp"
 
 namespace ecole::observation {
 
 class ECOLE_EXPORT StrongBranchingScores {
 public:
-	ECOLE_EXPORT StrongBranchingScores(bool pseudo_candidates = false);
+	/**
+	 * Create the observation function.
+	 *
+	 * @param pseudo_candidates Whether to score the pseudo branching candidates rather than the LP ones.
+	 * @param max_candidates The maximum number of candidates scored at every node, all of them if not given.
+	 *        The other candidates are given a NaN score, like variables that are not candidates.
+	 * @param sample_candidates Whether the candidates scored are sampled uniformly when there are more than
+	 *        ``max_candidates``, rather than being the ones with the best pseudocost score.
+	 * @param lp_iteration_limit The maximum number of LP iterations for solving each child LP.
+	 * @param n_threads If given, the candidates are scored concurrently on copies of the node LP, using at most this
+	 *        many threads (see scip::strong_branch_parallel).
+	 *        The scores do not depend on the number of threads, but can differ slightly from the ones computed
+	 *        by SCIP when it is not given.
+	 */
+	ECOLE_EXPORT StrongBranchingScores(
+		bool pseudo_candidates = false,
+		std::optional<std::size_t> max_candidates = {},
+		bool sample_candidates = false,
+		int lp_iteration_limit = std::numeric_limits<int>::max(),
+		std::optional<std::size_t> n_threads = {});
 
-	auto before_reset(scip::Model& /*model*/) -> void {}
+	/** Seed the candidate sampling from the seed of the model. */
+	ECOLE_EXPORT auto before_reset(scip::Model& model) -> void;
 
-	ECOLE_EXPORT auto extract(scip::Model& model, bool done) const -> std::optional<xt::xtensor<double, 1>>;
+	ECOLE_EXPORT auto extract(scip::Model& model, bool done) -> std::optional<xt::xtensor<double, 1>>;
+
+	/**
+	 * Extract the scores in place in a previously allocated buffer.
+	 *
+	 * @param out A buffer with one element per variable in the problem.
+	 * @return Whether an observation was extracted, in which case the buffer was overwritten.
+	 * @throw std::invalid_argument if the size of the buffer is not the number of variables.
+	 */
+	ECOLE_EXPORT auto extract_into(scip::Model& model, bool done, nonstd::span<double> out) -> bool;
 
 private:
 	bool pseudo_candidates;
+	std::optional<std::size_t> max_candidates;
+	bool sample_candidates;
+	int lp_iteration_limit;
+	std::optional<std::size_t> n_threads;
+	RandomGenerator rng;
 };
 
 }  // namespace ecole::observation
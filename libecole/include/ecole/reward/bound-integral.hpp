@@ -12,9 +12,22 @@ enum struct ECOLE_EXPORT Bound { primal, dual, primal_dual };
 
 template <Bound bound> class ECOLE_EXPORT BoundIntegral {
 public:
+	/** Extraction does not modify the model, see trait::is_model_modifying_data_function. */
+	static constexpr bool modifies_model = false;
+
 	using BoundFunction = std::function<std::tuple<Reward, Reward>(scip::Model& model)>;
 
-	ECOLE_EXPORT BoundIntegral(bool wall_ = false, const BoundFunction& bound_function_ = {});
+	/**
+	 * Create the reward function.
+	 *
+	 * @param wall_ Whether to integrate over wall time rather than process time.
+	 * @param bound_function_ Return the offset and initial bounds of the integral, see the Python documentation.
+	 * @param time_quantum_ If positive, the time in seconds under which consecutive bound changes are grouped, to
+	 *        read the clock at most once per quantum during solving.
+	 *        Bound changes are then accounted for from the first change of each group, so that only the changes within
+	 *        a group are attributed to its latest bounds.
+	 */
+	ECOLE_EXPORT BoundIntegral(bool wall_ = false, const BoundFunction& bound_function_ = {}, double time_quantum_ = 0.);
 
 	ECOLE_EXPORT auto before_reset(scip::Model& model) -> void;
 	ECOLE_EXPORT auto extract(scip::Model& model, bool done = false) -> Reward;
@@ -25,6 +38,7 @@ private:
 	Reward initial_primal_bound = 0.0;
 	Reward initial_dual_bound = 0.0;
 	Reward offset = 0.0;
+	double time_quantum = 0.0;
 	bool wall = false;
 };
 
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "ecole/export.hpp"
+#include "ecole/reward/abstract.hpp"
+#include "ecole/reward/bound-integral.hpp"
+#include "ecole/reward/is-done.hpp"
+#include "ecole/reward/lp-iterations.hpp"
+#include "ecole/reward/n-nodes.hpp"
+#include "ecole/reward/solving-time.hpp"
+
+namespace ecole::reward {
+
+/**
+ * Reward function computing a formula over the built-in reward functions.
+ *
+ * The formula is compiled once into a flat evaluation plan, a sequence of instructions in postfix order operating on
+ * a stack of values.
+ * Extracting the reward extracts every reward function of the formula once, in order of first appearance, then runs
+ * the plan without allocating memory.
+ * The same reward function appearing multiple times in the formula is only extracted once.
+ *
+ * A formula is made of:
+ *   - Numbers, such as ``3``, ``-0.1``, or ``1e-3``;
+ *   - Reward functions, such as ``LpIterations()`` or ``SolvingTime(wall=True)``;
+ *   - The binary operators ``+``, ``-``, ``*``, ``/``, and ``**``, with the same precedence as in Python;
+ *   - The functions ``abs``, ``exp``, ``log``, ``log2``, ``log10``, ``sqrt``, ``floor``, ``ceil``, ``cumsum``, which
+ *     are also available as methods (``LpIterations().cumsum()``), as well as ``min`` and ``max``;
+ *   - Parentheses.
+ *
+ * Operations follow floating point arithmetic, for instance a division by zero is infinite rather than an error.
+ */
+class ECOLE_EXPORT Expression {
+public:
+	/** Extraction does not modify the model, see trait::is_model_modifying_data_function. */
+	static constexpr bool modifies_model = false;
+
+	/** The reward functions that can be used in a formula. */
+	using Function =
+		std::variant<IsDone, LpIterations, NNodes, SolvingTime, DualIntegral, PrimalIntegral, PrimalDualIntegral>;
+
+	/** Operations applied on the values at the top of the stack. */
+	enum struct Operator : std::uint8_t {
+		// Binary
+		add,
+		subtract,
+		multiply,
+		divide,
+		power,
+		minimum,
+		maximum,
+		// Unary
+		negate,
+		absolute,
+		exp,
+		log,
+		log2,
+		log10,
+		sqrt,
+		floor,
+		ceil,
+		/** Sum of the values since the last reset. */
+		cumsum,
+	};
+
+	/** Number of operands of an operator. */
+	[[nodiscard]] static constexpr auto arity(Operator op) noexcept -> std::size_t {
+		return (op < Operator::negate) ? 2 : 1;
+	}
+
+private:
+	/** A step of the evaluation plan. */
+	struct Instruction {
+		enum struct Kind : std::uint8_t { constant, function, operation };
+
+		Kind kind;
+		Operator op = Operator::add;
+		/** The index of the function, or of the accumulator of ``cumsum``. */
+		std::size_t index = 0;
+		Reward value = 0.;
+	};
+
+public:
+	/**
+	 * Incrementally create an Expression from its plan.
+	 *
+	 * Operands are pushed before the operators applying to them, as in postfix notation.
+	 */
+	class ECOLE_EXPORT Builder {
+	public:
+		/**
+		 * Add a reward function to extract, without pushing it.
+		 *
+		 * @return The index of the function used in push_function.
+		 */
+		ECOLE_EXPORT auto add_function(Function function) -> std::size_t;
+
+		/** Push the reward extracted by a function previously added. */
+		ECOLE_EXPORT auto push_function(std::size_t index) -> void;
+
+		/** Push a constant value. */
+		ECOLE_EXPORT auto push_constant(Reward value) -> void;
+
+		/**
+		 * Replace the values at the top of the stack with the result of the operator.
+		 *
+		 * @throw std::invalid_argument if there are less values on the stack than the arity of the operator.
+		 */
+		ECOLE_EXPORT auto push_operator(Operator op) -> void;
+
+		/**
+		 * Create the expression.
+		 *
+		 * @param formula Text describing the expression, used for display only.
+		 * @throw std::invalid_argument if the plan does not leave exactly one value on the stack.
+		 */
+		ECOLE_EXPORT auto build(std::string formula) -> Expression;
+
+	private:
+		std::vector<Function> m_functions;
+		std::vector<Instruction> m_plan;
+		std::size_t m_n_accumulators = 0;
+		std::size_t m_depth = 0;
+		std::size_t m_max_depth = 0;
+
+		auto push(Instruction instruction) -> void;
+	};
+
+	/** Create the expression of the constant zero. */
+	ECOLE_EXPORT Expression();
+
+	/**
+	 * Compile a formula.
+	 *
+	 * @throw std::invalid_argument if the formula is malformed.
+	 */
+	ECOLE_EXPORT explicit Expression(std::string_view formula);
+
+	/** Reset all reward functions of the formula, and the sums of ``cumsum``. */
+	ECOLE_EXPORT auto before_reset(scip::Model& model) -> void;
+
+	/** Extract all reward functions and compute the formula. */
+	ECOLE_EXPORT auto extract(scip::Model& model, bool done = false) -> Reward;
+
+	/** The text of the formula. */
+	[[nodiscard]] auto formula() const noexcept -> std::string const& { return m_formula; }
+
+private:
+	std::vector<Function> m_functions;
+	std::vector<Instruction> m_plan;
+	std::string m_formula;
+	/** Memory reused between extractions. */
+	std::vector<Reward> m_values;
+	std::vector<Reward> m_stack;
+	std::vector<Reward> m_accumulators;
+
+	Expression(
+		std::vector<Function> functions,
+		std::vector<Instruction> plan,
+		std::size_t n_accumulators,
+		std::size_t max_depth,
+		std::string formula);
+};
+
+}  // namespace ecole::reward
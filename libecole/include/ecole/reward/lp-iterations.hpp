@@ -9,6 +9,9 @@ namespace ecole::reward {
 
 class ECOLE_EXPORT LpIterations {
 public:
+	/** Extraction does not modify the model, see trait::is_model_modifying_data_function. */
+	static constexpr bool modifies_model = false;
+
 	ECOLE_EXPORT auto before_reset(scip::Model& model) -> void;
 	ECOLE_EXPORT auto extract(scip::Model& model, bool done = false) -> Reward;
 
@@ -9,6 +9,9 @@ namespace ecole::reward {
 
 class ECOLE_EXPORT SolvingTime {
 public:
+	/** Extraction does not modify the model, see trait::is_model_modifying_data_function. */
+	static constexpr bool modifies_model = false;
+
 	SolvingTime(bool wall_ = false) noexcept : wall{wall_} {}
 
 	ECOLE_EXPORT auto before_reset(scip::Model& model) -> void;
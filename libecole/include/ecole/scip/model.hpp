@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <filesystem>
 #include <functional>
@@ -19,6 +20,8 @@
 #include "ecole/export.hpp"
 #include "ecole/scip/callback.hpp"
 #include "ecole/scip/exception.hpp"
+#include "ecole/scip/statistics.hpp"
+#include "ecole/scip/strong-branching.hpp"
 #include "ecole/scip/type.hpp"
 #include "ecole/utility/numeric.hpp"
 #include "ecole/utility/type-traits.hpp"
@@ -70,6 +73,14 @@ public:
 	ECOLE_EXPORT bool operator==(Model const& other) const noexcept;
 	ECOLE_EXPORT bool operator!=(Model const& other) const noexcept;
 
+	/**
+	 * Identifier unique to every model created in the process, kept when the model is moved.
+	 *
+	 * Unlike the SCIP pointer, whose address can be reused by a later model, identifiers are never reused, and can
+	 * hence be used to cache data about a model.
+	 */
+	[[nodiscard]] ECOLE_EXPORT auto id() const noexcept -> std::uint64_t;
+
 	/**
 	 * Construct a model by reading a problem file supported by SCIP (LP, MPS,...).
 	 */
@@ -211,8 +222,58 @@ public:
 	 */
 	ECOLE_EXPORT auto solve_iter_continue(SCIP_RESULT result) -> std::optional<callback::DynamicCall>;
 
+	/**
+	 * Continue iterative solving without waiting for the next reverse callback.
+	 *
+	 * Solving proceeds in the background until the next reverse callback is encountered, which must be received with
+	 * ``solve_iter_wait``.
+	 * In the meantime, the model must not be used.
+	 * Depending on the utility::CoroutineBackend, solving may only happen when waiting.
+	 * Calling both functions successively is equivalent to ``solve_iter_continue``.
+	 *
+	 * @param result The result given to the SCIP callback for the action taken on the current pause.
+	 * @see solve_iter_wait
+	 */
+	ECOLE_EXPORT auto solve_iter_resume(SCIP_RESULT result) -> void;
+
+	/**
+	 * Wait for iterative solving resumed with ``solve_iter_resume`` to pause again.
+	 *
+	 * @return The callback arguments where iterative solving has stopped, or nothing if solving has terminated.
+	 * @see solve_iter_resume
+	 */
+	ECOLE_EXPORT auto solve_iter_wait() -> std::optional<callback::DynamicCall>;
+
+	/**
+	 * Strong branching results shared between the components using the model.
+	 *
+	 * Components computing strong branching, such as observation::StrongBranchingScores, store their results so that
+	 * others, such as dynamics::BranchingDynamics, can reuse them at the same node.
+	 */
+	[[nodiscard]] ECOLE_EXPORT auto strong_branching_cache() noexcept -> StrongBranchingCache&;
+
+	/**
+	 * Solver statistics shared between the data functions extracted on the same transition.
+	 *
+	 * Environments cache them for the duration of the extraction of a transition, so that statistics needed by
+	 * several data functions, such as the number of LP iterations or the solving time, are read only once.
+	 */
+	[[nodiscard]] ECOLE_EXPORT auto statistics() noexcept -> Statistics&;
+
+	/**
+	 * Compute the solver data that SCIP evaluates lazily on first access.
+	 *
+	 * Some SCIP getters, such as the LP branching candidates, the objective norm, the LP row activities, or the reduced
+	 * costs, store their result in the model the first time they are called.
+	 * Once they are computed, they can be read concurrently by data functions until the model is modified again.
+	 */
+	ECOLE_EXPORT auto prepare_concurrent_reads() -> void;
+
 private:
 	std::unique_ptr<Scimpl> scimpl;
+	std::uint64_t m_id;
+	StrongBranchingCache m_strong_branching_cache;
+	Statistics m_statistics;
 };
 
 /*****************************
@@ -35,6 +35,8 @@ public:
 	ECOLE_EXPORT auto solve_iter(nonstd::span<callback::DynamicConstructor const> arg_packs)
 		-> std::optional<callback::DynamicCall>;
 	ECOLE_EXPORT auto solve_iter_continue(SCIP_RESULT result) -> std::optional<callback::DynamicCall>;
+	ECOLE_EXPORT auto solve_iter_resume(SCIP_RESULT result) -> void;
+	ECOLE_EXPORT auto solve_iter_wait() -> std::optional<callback::DynamicCall>;
 
 private:
 	using Controller = utility::Coroutine<callback::DynamicCall, SCIP_RESULT>;
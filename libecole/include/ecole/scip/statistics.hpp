@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+
+#include <scip/scip.h>
+
+#include "ecole/export.hpp"
+
+namespace ecole::scip {
+
+/**
+ * Solver statistics shared by the data functions extracted on the same transition.
+ *
+ * Inside a step, every statistic is read from the solver (or the clock) at most once, the first time it is needed,
+ * so that composing many data functions does not multiply the queries.
+ * Outside of a step, statistics are read again on every call.
+ * The cached values are invalidated after the data functions that may modify the model.
+ *
+ * Statistics can be read concurrently, as by read only data functions, but steps must not be started, ended, nor
+ * invalidated at the same time.
+ *
+ * @see trait::is_model_modifying_data_function
+ */
+class ECOLE_EXPORT Statistics {
+public:
+	Statistics() = default;
+	/** Move the cached values, the statistics must not be in use. */
+	ECOLE_EXPORT Statistics(Statistics&& other) noexcept;
+	ECOLE_EXPORT auto operator=(Statistics&& other) noexcept -> Statistics&;
+	Statistics(Statistics const&) = delete;
+	auto operator=(Statistics const&) -> Statistics& = delete;
+	~Statistics() = default;
+
+	/** Start caching the statistics, until end_step is called. */
+	ECOLE_EXPORT auto begin_step() noexcept -> void;
+	/** Stop caching the statistics and forget the cached values. */
+	ECOLE_EXPORT auto end_step() noexcept -> void;
+	/** Forget the cached values, to be called when the model may have been modified during the step. */
+	ECOLE_EXPORT auto invalidate() noexcept -> void;
+	[[nodiscard]] auto in_step() const noexcept -> bool { return m_in_step; }
+
+	/** Number of LP iterations, or zero in the stages where it is not available. */
+	[[nodiscard]] ECOLE_EXPORT auto n_lp_iterations(SCIP* scip) -> SCIP_Longint;
+	/** Number of nodes processed in total, including previous runs. */
+	[[nodiscard]] ECOLE_EXPORT auto n_total_nodes(SCIP* scip) -> SCIP_Longint;
+	/** The time of the steady clock if wall, or the process CPU clock otherwise, since an arbitrary origin. */
+	[[nodiscard]] ECOLE_EXPORT auto time(bool wall) -> std::chrono::nanoseconds;
+
+private:
+	bool m_in_step = false;
+	std::optional<SCIP_Longint> m_n_lp_iterations;
+	std::optional<SCIP_Longint> m_n_total_nodes;
+	std::optional<std::chrono::nanoseconds> m_wall_time;
+	std::optional<std::chrono::nanoseconds> m_cpu_time;
+	/** Guard the cached values, filled on first read. */
+	std::mutex m_mutex;
+
+	template <typename T, typename Func> auto get(std::optional<T>& cached, Func&& read) -> T;
+};
+
+/** Cache the statistics of a model for the lifetime of the object, typically the extraction of a transition. */
+class ECOLE_EXPORT StatisticsStep {
+public:
+	explicit StatisticsStep(Statistics& statistics) noexcept : m_statistics{statistics} { m_statistics.begin_step(); }
+	StatisticsStep(StatisticsStep const&) = delete;
+	StatisticsStep(StatisticsStep&&) = delete;
+	~StatisticsStep() { m_statistics.end_step(); }
+
+	auto operator=(StatisticsStep const&) -> StatisticsStep& = delete;
+	auto operator=(StatisticsStep&&) -> StatisticsStep& = delete;
+
+private:
+	Statistics& m_statistics;
+};
+
+}  // namespace ecole::scip
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <nonstd/span.hpp>
+#include <scip/scip.h>
+
+#include "ecole/export.hpp"
+
+namespace ecole::scip {
+
+/** Outcome of strong branching on a single variable. */
+struct ECOLE_EXPORT StrongBranchingResult {
+	SCIP_VAR* var = nullptr;
+	/** Objective value of the down and up children LP, at least the objective value of the parent LP. */
+	SCIP_Real down = 0.;
+	SCIP_Real up = 0.;
+	bool down_valid = false;
+	bool up_valid = false;
+	bool down_infeasible = false;
+	bool up_infeasible = false;
+	/** The SCIP branching score (SCIPgetBranchScore) of the down and up gains. */
+	SCIP_Real score = 0.;
+};
+
+/**
+ * Strong branch on the given variables at the current node.
+ *
+ * This is the loop of SCIP's vanillafullstrong branching rule, as configured by StrongBranchingScores before, but
+ * called directly so that no parameter is read or written.
+ * The strong branching is idempotent: the solver statistics and pseudocosts are left untouched.
+ * The LP of the node must be solved.
+ *
+ * @param scip The solver, in the solving stage.
+ * @param cands The variables to strong branch on, all of them must be LP columns.
+ * @param lp_iteration_limit The maximum number of LP iterations for solving each child.
+ * @return One result per variable scored, in the same order as the candidates.
+ *         If the LP solver fails on a candidate, the remaining ones are not scored and fewer results are returned.
+ */
+ECOLE_EXPORT auto strong_branch(
+	SCIP* scip,
+	nonstd::span<SCIP_VAR* const> cands,
+	int lp_iteration_limit = std::numeric_limits<int>::max()) -> std::vector<StrongBranchingResult>;
+
+/**
+ * Strong branch on the given variables concurrently, on copies of the LP of the current node.
+ *
+ * The LP of the node, with its optimal basis, is copied into one LP solver per thread, and the candidates are split
+ * among them.
+ * Every child LP is solved from the basis of the node, on a solver state cleared beforehand, so that the results do
+ * not depend on the number of threads, nor on how the candidates are split.
+ * They can differ slightly from the ones of strong_branch, where SCIP reuses LP information between candidates.
+ * The solver is only read, hence its statistics and pseudocosts are left untouched.
+ * The LP of the node must be solved.
+ *
+ * @param scip The solver, in the solving stage.
+ * @param cands The variables to strong branch on, the ones that are not LP columns are skipped.
+ * @param n_threads The maximum number of threads used, including the calling thread.
+ * @param lp_iteration_limit The maximum number of LP iterations for solving each child.
+ * @return One result per variable scored, in the same order as the candidates.
+ *         If the LP solver fails on a candidate, the remaining ones are not scored and fewer results are returned.
+ */
+ECOLE_EXPORT auto strong_branch_parallel(
+	SCIP* scip,
+	nonstd::span<SCIP_VAR* const> cands,
+	std::size_t n_threads,
+	int lp_iteration_limit = std::numeric_limits<int>::max()) -> std::vector<StrongBranchingResult>;
+
+/**
+ * Branch on a variable reusing its strong branching result, as SCIP strong branching rules do.
+ *
+ * If both children are infeasible, the node is cut off.
+ * If only one is, the variable bound is tightened instead of branching, and the node LP is solved again.
+ * Otherwise, the variable is branched on and the children lower bounds are set from the children LP objective values.
+ * Infeasible children are only pruned, and children lower bounds only set, when all columns are in the LP, since the
+ * strong branching bounds are not valid otherwise.
+ * The result must have been computed at the current node and LP.
+ *
+ * @return The SCIP_RESULT of the branching callback: SCIP_CUTOFF, SCIP_REDUCEDDOM, or SCIP_BRANCHED.
+ */
+ECOLE_EXPORT auto branch_var(SCIP* scip, StrongBranchingResult const& result) -> SCIP_RESULT;
+
+/**
+ * Strong branching results computed at a given node.
+ *
+ * The results are only found for the node and LP on which they were stored, so that stale results are never used.
+ */
+class ECOLE_EXPORT StrongBranchingCache {
+public:
+	/** Replace the results with the ones computed at the current node and LP. */
+	ECOLE_EXPORT auto store(SCIP* scip, std::vector<StrongBranchingResult> results) -> void;
+
+	/** Find the result of a variable if it was strong branched at the current node and LP, nullptr otherwise. */
+	[[nodiscard]] ECOLE_EXPORT auto find(SCIP* scip, SCIP_VAR const* var) const -> StrongBranchingResult const*;
+
+	ECOLE_EXPORT auto clear() noexcept -> void;
+
+private:
+	SCIP_Longint m_node_number = -1;
+	SCIP_Longint m_n_lps = -1;
+	std::vector<StrongBranchingResult> m_results;
+};
+
+}  // namespace ecole::scip
@@ -79,6 +79,38 @@ using is_information_function =
 	std::conjunction<is_data_function<T>, internal::extract_return_is<T, is_information_map>>;
 template <typename T> inline constexpr bool is_information_function_v = is_information_function<T>::value;
 
+/**
+ * Check that a data function can be extracted concurrently with other read only data functions.
+ *
+ * The type must have a static member ``read_only`` equal to ``true``, meaning that its ``extract`` member function
+ * does not modify the model, and only reads SCIP data that is up to date after scip::Model::prepare_concurrent_reads.
+ * It may still modify its own state.
+ */
+template <typename, typename = void> struct is_read_only_data_function : std::false_type {};
+template <typename T> struct is_read_only_data_function<T, std::enable_if_t<T::read_only>> : std::true_type {};
+template <typename T> inline constexpr bool is_read_only_data_function_v = is_read_only_data_function<T>::value;
+
+namespace internal {
+
+template <typename, typename = void> struct declares_unmodified_model : std::false_type {};
+template <typename T> struct declares_unmodified_model<T, std::enable_if_t<!T::modifies_model>> : std::true_type {};
+
+}  // namespace internal
+
+/**
+ * Check whether extracting a data function may modify the model.
+ *
+ * Data functions are assumed to modify the model, unless they are read only, or have a static member
+ * ``modifies_model`` equal to ``false``, meaning that their ``extract`` member function leaves the model unchanged,
+ * even though it may not be safe to extract concurrently.
+ * The statistics cached during a step are invalidated after the functions that may modify the model.
+ */
+template <typename T>
+struct is_model_modifying_data_function :
+	std::bool_constant<!is_read_only_data_function_v<T> && !internal::declares_unmodified_model<T>::value> {};
+template <typename T>
+inline constexpr bool is_model_modifying_data_function_v = is_model_modifying_data_function<T>::value;
+
 /******************************
  *  Detection of environment  *
  ******************************/
@@ -107,6 +139,18 @@ template <typename T> inline constexpr bool has_step_dynamics_v = has_step_dynam
 
 template <typename T> inline constexpr bool is_dynamics_v = internal::has_step_dynamics_v<T>;
 
+/**
+ * Check that dynamics can perform a transition in two parts.
+ *
+ * The type must have member functions ``step_dynamics_async``, starting the transition, and ``step_dynamics_wait``,
+ * waiting for it to complete.
+ */
+template <typename, typename = void> struct has_async_step_dynamics : std::false_type {};
+template <typename T>
+struct has_async_step_dynamics<T, std::void_t<decltype(&T::step_dynamics_async), decltype(&T::step_dynamics_wait)>> :
+	std::true_type {};
+template <typename T> inline constexpr bool has_async_step_dynamics_v = has_async_step_dynamics<T>::value;
+
 /*********************************
  *  Detection of extracted data  *
  *********************************/
@@ -26,4 +26,21 @@ public:
 	ECOLE_EXPORT static auto now() -> time_point;
 };
 
+/**
+ * A monotonic clock that is cheap to read, at the cost of a resolution of a few milliseconds.
+ *
+ * Used to rate limit reads of more precise clocks.
+ * The implementation uses OS dependent functionality, falling back to std::chrono::steady_clock.
+ */
+class ECOLE_EXPORT coarse_clock {
+public:
+	using duration = std::chrono::nanoseconds;
+	using rep = duration::rep;
+	using period = duration::period;
+	using time_point = std::chrono::time_point<coarse_clock>;
+	static bool constexpr is_steady = true;
+
+	ECOLE_EXPORT static auto now() -> time_point;
+};
+
 }  // namespace ecole::utility
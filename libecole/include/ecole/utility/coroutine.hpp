@@ -1,7 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -9,8 +13,55 @@
 #include <utility>
 #include <variant>
 
+#include "ecole/export.hpp"
+#include "ecole/utility/fiber.hpp"
+#include "ecole/utility/profiler.hpp"
+#include "ecole/utility/thread-pool.hpp"
+
 namespace ecole::utility {
 
+/** Mechanism used by a Coroutine to run its executor. */
+enum struct ECOLE_EXPORT CoroutineBackend {
+	/** The executor runs in its own thread, control is passed with a mutex and a condition variable. */
+	thread,
+	/**
+	 * The executor runs in its own thread, control is passed through an atomic variable.
+	 *
+	 * The waiting side spins for a bounded number of iterations before sleeping, trading CPU time for a lower latency
+	 * when the other side answers quickly.
+	 * Spinning is disabled on single core machines, where it would only delay the other side.
+	 */
+	spin_thread,
+	/**
+	 * The executor runs on a fiber in the thread of the coroutine, control is passed by switching context.
+	 *
+	 * The stack of a fiber cannot migrate between threads, so the coroutine must always be waited on from the same
+	 * thread.
+	 */
+	fiber,
+};
+
+/** Parameters used to create a Coroutine. */
+struct ECOLE_EXPORT CoroutineOptions {
+	CoroutineBackend backend = CoroutineBackend::thread;
+	/** Size of the stack allocated for the executor with the fiber backend. */
+	std::size_t fiber_stack_size = Fiber::default_stack_size;
+	/** Number of iterations spent busy waiting before sleeping with the spin thread backend. */
+	std::size_t spin_budget = 2048;  // NOLINT(readability-magic-numbers)
+	/** Whether thread backends borrow a worker from ThreadPool::global() rather than starting a new thread. */
+	bool use_thread_pool = true;
+};
+
+/**
+ * Options used by coroutines created without explicit options.
+ *
+ * Initially, the backend is the one selected when building Ecole (CMake option ``ECOLE_COROUTINE_BACKEND``).
+ */
+ECOLE_EXPORT auto default_coroutine_options() -> CoroutineOptions;
+
+/** Change the options used by coroutines created without explicit options, existing coroutines are unaffected. */
+ECOLE_EXPORT auto set_default_coroutine_options(CoroutineOptions const& options) -> void;
+
 /**
  * Asynchronous cooperative interruptable code execution.
  *
@@ -24,6 +75,11 @@ namespace ecole::utility {
  * 5. Else, the coroutine calls ``resume`` with a message to pass to the executor.
  * 6. The executor recieve the message and continue its execution unitl the next ``yield``, the process repeats from 2.
  *
+ * With the fiber backend, the executor only makes progress inside ``wait``, hence the steps above are run
+ * sequentially in the thread of the coroutine.
+ * In that case, ``wait`` must always be called from the same thread, whereas the thread backends allow the coroutine
+ * to be passed between threads.
+ *
  * @tparam Return The type of return values created by the executor.
  * @tparam Message The type of the messages that can be sent to the executor.
  */
@@ -33,16 +89,27 @@ public:
 	using MaybeReturn = std::optional<Return>;
 
 	/**
-	 * Start the execution.
+	 * Start the execution using the default options.
 	 *
 	 * @param func Function used to define the code that needs to be executed by the executor.
 	 *        The first parameter to that function is a ``std::weak_ptr<Executor>`` used to yield values and recieve
 	 *        messages.
 	 *        If the weak pointer is expired, the executor must terminate.
 	 * @param args Additional parameters to be passed as additinal arguments to ``func``.
+	 * @see default_coroutine_options
 	 */
 	template <class Function, class... Args> Coroutine(Function&& func, Args&&... args);
 
+	/**
+	 * Start the execution using the given options.
+	 *
+	 * @param options The options defining how the executor is run.
+	 * @param func Same as in the default constructor.
+	 * @param args Same as in the default constructor.
+	 */
+	template <class Function, class... Args>
+	Coroutine(CoroutineOptions options, Function&& func, Args&&... args);
+
 	/**
 	 * Terminate the coroutine
 	 *
@@ -78,37 +145,130 @@ private:
 	using MessageOrStop = std::variant<Message, Coroutine::StopToken>;
 
 	/**
-	 * Lock type to synchronise between the coroutine and executor.
+	 * Class responsible for synchronizing between the coroutine and executor.
 	 *
-	 * The lock is passed back and forth to guarantee that it is help/release when necessary.
+	 * Derived classes define how control is passed between the two, depending on how the executor is run.
 	 */
-	using Lock = std::unique_lock<std::mutex>;
-
-	/** Class responsible for synchronizing between the coroutine and executor. */
 	class Synchronizer {
 	public:
-		auto coroutine_wait_executor() -> Lock;
+		Synchronizer() = default;
+		Synchronizer(Synchronizer const&) = delete;
+		Synchronizer(Synchronizer&&) = delete;
+		virtual ~Synchronizer() = default;
+
+		auto operator=(Synchronizer const&) -> Synchronizer& = delete;
+		auto operator=(Synchronizer&&) -> Synchronizer& = delete;
+
+		/** Block until the executor yields or terminates, rethrowing the exception it may have terminated with. */
+		virtual auto coroutine_wait_executor() -> void = 0;
 		auto coroutine_pop_return() -> Return;
-		auto coroutine_resume_executor(Lock&& lk, MessageOrStop instruction) -> void;
-		auto coroutine_stop_executor(Lock&& lk) -> void;
-		[[nodiscard]] auto coroutine_executor_is_done(Lock const& lk) const noexcept -> bool;
+		virtual auto coroutine_resume_executor(MessageOrStop instruction) -> void = 0;
+		auto coroutine_stop_executor() -> void;
+		[[nodiscard]] auto coroutine_executor_is_done() const noexcept -> bool;
 
-		auto executor_start() -> Lock;
-		auto executor_yield(Lock&& lk, Return value) -> std::pair<Lock, MessageOrStop>;
-		auto executor_terminate(Lock&& lk) -> void;
-		auto executor_terminate(Lock&& lk, std::exception_ptr const& e) -> void;
+		virtual auto executor_start() -> void = 0;
+		virtual auto executor_yield(Return value) -> MessageOrStop = 0;
+		virtual auto executor_terminate(std::exception_ptr const& e) -> void = 0;
 
-	private:
+		/** Mark the moment control is given to the other side, when the Profiler is enabled. */
+		auto start_handoff() noexcept -> void;
+		/** Record the time since control was given as a ProfileCategory::coroutine event. */
+		auto end_handoff() noexcept -> void;
+
+	protected:
 		std::exception_ptr m_executor_exception = nullptr;  // NOLINT(bugprone-throw-keyword-missing)
-		std::mutex m_exclusion_mutex;
-		std::condition_variable m_resume_signal;
-		bool m_executor_running = true;
 		bool m_executor_finished = false;
 		Return m_value;
 		MessageOrStop m_instruction;
+		/** Written before giving control and read after taking it, hence synchronized by the handoff itself. */
+		std::uint64_t m_handoff_ticks = 0;
+
+		auto maybe_throw() -> void;
+	};
+
+	/**
+	 * Synchronizer for an executor running in its own thread.
+	 *
+	 * Control is passed by flipping a flag under a mutex and signaling a condition variable.
+	 * The mutex is only held during the handoff, never while a side has control, so the coroutine can be waited on and
+	 * resumed from different threads.
+	 */
+	class ThreadSynchronizer final : public Synchronizer {
+	public:
+		auto coroutine_wait_executor() -> void override;
+		auto coroutine_resume_executor(MessageOrStop instruction) -> void override;
+
+		auto executor_start() -> void override;
+		auto executor_yield(Return value) -> MessageOrStop override;
+		auto executor_terminate(std::exception_ptr const& e) -> void override;
+
+	private:
+		std::mutex m_exclusion_mutex;
+		std::condition_variable m_resume_signal;
+		bool m_executor_running = true;
+
+		/** Block until the executor is, respectively is not, running. */
+		auto wait_running(bool running) -> void;
+		/** Give control to the executor, respectively to the coroutine. */
+		auto set_running(bool running) -> void;
+	};
 
-		[[nodiscard]] auto is_valid_lock(Lock const& lk) const noexcept -> bool;
-		auto maybe_throw(Lock&& lk) -> Lock;
+	/**
+	 * Synchronizer for an executor running in its own thread, passing control through an atomic turn variable.
+	 *
+	 * A side waiting for its turn first spins, then parks on a condition variable.
+	 * The side giving the turn only touches the mutex if the other side is parked.
+	 */
+	class SpinSynchronizer final : public Synchronizer {
+	public:
+		SpinSynchronizer(std::size_t spin_budget) noexcept;
+
+		auto coroutine_wait_executor() -> void override;
+		auto coroutine_resume_executor(MessageOrStop instruction) -> void override;
+
+		auto executor_start() -> void override;
+		auto executor_yield(Return value) -> MessageOrStop override;
+		auto executor_terminate(std::exception_ptr const& e) -> void override;
+
+	private:
+		enum struct Turn { coroutine, executor };
+
+		std::atomic<Turn> m_turn{Turn::executor};
+		/** Whether the coroutine, respectively the executor, is sleeping while waiting for its turn. */
+		std::atomic<bool> m_coroutine_parked{false};
+		std::atomic<bool> m_executor_parked{false};
+		std::mutex m_park_mutex;
+		std::condition_variable m_park_signal;
+		std::size_t m_spin_budget;
+
+		auto parked_flag(Turn turn) noexcept -> std::atomic<bool>&;
+		auto wait_turn(Turn turn) -> void;
+		auto give_turn(Turn turn) -> void;
+	};
+
+	/**
+	 * Synchronizer for an executor running on a fiber.
+	 *
+	 * Executor and coroutine share the same thread so no locking is needed.
+	 * The message sent by ``resume`` is only delivered when the coroutine waits and switches to the fiber.
+	 * The fiber is bound to the thread that first switches to it.
+	 */
+	class FiberSynchronizer final : public Synchronizer {
+	public:
+		auto set_fiber(Fiber* fiber) noexcept -> void;
+
+		auto coroutine_wait_executor() -> void override;
+		auto coroutine_resume_executor(MessageOrStop instruction) -> void override;
+
+		auto executor_start() -> void override;
+		auto executor_yield(Return value) -> MessageOrStop override;
+		auto executor_terminate(std::exception_ptr const& e) -> void override;
+
+	private:
+		/** Owned by the Coroutine, to avoid a reference cycle with the executor it runs. */
+		Fiber* m_fiber = nullptr;
+		/** The thread running the fiber, set when first switching to it. */
+		std::thread::id m_thread;
 	};
 
 public:
@@ -135,9 +295,18 @@ public:
 		 */
 		auto yield(Return value) -> MessageOrStop;
 
+		/**
+		 * The profile_ticks when the executor last took control, or zero if the Profiler was disabled.
+		 *
+		 * @see Profiler
+		 */
+		[[nodiscard]] auto resumed_ticks() const noexcept -> std::uint64_t;
+
 	private:
 		std::shared_ptr<Synchronizer> m_synchronizer;
-		Lock m_exclusion_lock;
+		std::uint64_t m_resumed_ticks = 0;
+
+		auto mark_resumed() noexcept -> void;
 
 		friend class Coroutine;
 		/** Indicate to the synchronizer that executor is ready to start. */
@@ -151,17 +320,24 @@ public:
 private:
 	std::shared_ptr<Synchronizer> m_synchronizer;
 	std::thread executor_thread;
-	Lock m_exclusion_lock;
+	std::future<void> executor_task;
+	std::unique_ptr<Fiber> executor_fiber;
+	/** Whether the coroutine has control, i.e. ``wait`` returned and ``resume`` was not called since. */
+	bool m_has_control = false;
 
+	static auto make_synchronizer(CoroutineOptions const& options) -> std::shared_ptr<Synchronizer>;
 	auto stop_executor() -> void;
 };
 }  // namespace ecole::utility
 
 #include <cassert>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
+#include "ecole/utility/cpu-relax.hpp"
 #include "ecole/utility/function-traits.hpp"
+#include "ecole/utility/unreachable.hpp"
 
 namespace ecole::utility {
 
@@ -170,82 +346,214 @@ namespace ecole::utility {
  ***********************************************/
 
 template <typename Return, typename Message>
-auto Coroutine<Return, Message>::Synchronizer::coroutine_wait_executor() -> Lock {
-	Lock lk{m_exclusion_mutex};
-	m_resume_signal.wait(lk, [this] { return !m_executor_running; });
-	return maybe_throw(std::move(lk));
+auto Coroutine<Return, Message>::Synchronizer::coroutine_pop_return() -> Return {
+	return std::move(m_value);
 }
 
 template <typename Return, typename Message>
-auto Coroutine<Return, Message>::Synchronizer::coroutine_pop_return() -> Return {
-	return std::move(m_value);
+auto Coroutine<Return, Message>::Synchronizer::coroutine_stop_executor() -> void {
+	coroutine_resume_executor(Coroutine::StopToken{});
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::Synchronizer::coroutine_executor_is_done() const noexcept -> bool {
+	return m_executor_finished;
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::Synchronizer::start_handoff() noexcept -> void {
+	m_handoff_ticks = Profiler::is_enabled() ? profile_ticks() : 0;
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::Synchronizer::end_handoff() noexcept -> void {
+	if (m_handoff_ticks != 0) {
+		auto const start_ticks = std::exchange(m_handoff_ticks, 0);
+		Profiler::record("coroutine_handoff", ProfileCategory::coroutine, start_ticks, profile_ticks());
+	}
 }
 
+template <typename Return, typename Message> auto Coroutine<Return, Message>::Synchronizer::maybe_throw() -> void {
+	auto e_ptr = m_executor_exception;
+	m_executor_exception = nullptr;
+	if (e_ptr) {
+		assert(m_executor_finished);
+		std::rethrow_exception(e_ptr);
+	}
+}
+
+/*****************************************************
+ *  Implementation of Coroutine::ThreadSynchronizer  *
+ *****************************************************/
+
 template <typename Return, typename Message>
-auto Coroutine<Return, Message>::Synchronizer::coroutine_resume_executor(Lock&& lk, MessageOrStop new_instruction)
+auto Coroutine<Return, Message>::ThreadSynchronizer::coroutine_wait_executor() -> void {
+	wait_running(false);
+	this->maybe_throw();
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::ThreadSynchronizer::coroutine_resume_executor(MessageOrStop new_instruction)
 	-> void {
-	assert(is_valid_lock(lk));
-	m_instruction = std::move(new_instruction);
-	m_executor_running = true;
-	lk.unlock();
-	m_resume_signal.notify_one();
+	// Only the side with control writes the flag, so it can be read without the mutex
+	assert(!m_executor_running);
+	this->m_instruction = std::move(new_instruction);
+	set_running(true);
 }
 
 template <typename Return, typename Message>
-auto Coroutine<Return, Message>::Synchronizer::coroutine_executor_is_done(
-	[[maybe_unused]] Lock const& lk) const noexcept -> bool {
-	assert(is_valid_lock(lk));
-	return m_executor_finished;
+auto Coroutine<Return, Message>::ThreadSynchronizer::executor_start() -> void {
+	wait_running(true);
 }
 
-template <typename Return, typename Message> auto Coroutine<Return, Message>::Synchronizer::executor_start() -> Lock {
-	return Lock{m_exclusion_mutex};
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::ThreadSynchronizer::executor_yield(Return value) -> MessageOrStop {
+	assert(m_executor_running);
+	this->m_value = std::move(value);
+	set_running(false);
+	wait_running(true);
+	return std::move(this->m_instruction);
 }
 
 template <typename Return, typename Message>
-auto Coroutine<Return, Message>::Synchronizer::executor_yield(Lock&& lk, Return value)
-	-> std::pair<Lock, MessageOrStop> {
-	assert(is_valid_lock(lk));
-	m_executor_running = false;
-	m_value = value;
-	lk.unlock();
-	m_resume_signal.notify_one();
-	lk.lock();
-	m_resume_signal.wait(lk, [this] { return m_executor_running; });
-	return {std::move(lk), std::move(m_instruction)};
+auto Coroutine<Return, Message>::ThreadSynchronizer::executor_terminate(std::exception_ptr const& e) -> void {
+	assert(m_executor_running);
+	this->m_executor_exception = e;
+	this->m_executor_finished = true;
+	set_running(false);
 }
 
 template <typename Return, typename Message>
-auto Coroutine<Return, Message>::Synchronizer::executor_terminate(Lock&& lk) -> void {
-	assert(is_valid_lock(lk));
-	m_executor_running = false;
-	m_executor_finished = true;
-	lk.unlock();
+auto Coroutine<Return, Message>::ThreadSynchronizer::wait_running(bool running) -> void {
+	auto lk = std::unique_lock{m_exclusion_mutex};
+	m_resume_signal.wait(lk, [this, running] { return m_executor_running == running; });
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::ThreadSynchronizer::set_running(bool running) -> void {
+	{
+		auto const lk = std::lock_guard{m_exclusion_mutex};
+		m_executor_running = running;
+	}
+	// Only one side waits at a time, the one not in control
 	m_resume_signal.notify_one();
 }
 
+/***************************************************
+ *  Implementation of Coroutine::SpinSynchronizer  *
+ ***************************************************/
+
 template <typename Return, typename Message>
-auto Coroutine<Return, Message>::Synchronizer::executor_terminate(Lock&& lk, std::exception_ptr const& e) -> void {
-	assert(is_valid_lock(lk));
-	m_executor_exception = e;
-	executor_terminate(std::move(lk));
+Coroutine<Return, Message>::SpinSynchronizer::SpinSynchronizer(std::size_t spin_budget) noexcept :
+	m_spin_budget(std::thread::hardware_concurrency() > 1 ? spin_budget : 0) {}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::SpinSynchronizer::coroutine_wait_executor() -> void {
+	wait_turn(Turn::coroutine);
+	this->maybe_throw();
 }
 
 template <typename Return, typename Message>
-auto Coroutine<Return, Message>::Synchronizer::is_valid_lock(Lock const& lk) const noexcept -> bool {
-	return lk && (lk.mutex() == &m_exclusion_mutex);
+auto Coroutine<Return, Message>::SpinSynchronizer::coroutine_resume_executor(MessageOrStop new_instruction) -> void {
+	assert(m_turn.load() == Turn::coroutine);
+	this->m_instruction = std::move(new_instruction);
+	give_turn(Turn::executor);
 }
 
 template <typename Return, typename Message>
-auto Coroutine<Return, Message>::Synchronizer::maybe_throw(Lock&& lk) -> Lock {
-	assert(is_valid_lock(lk));
-	auto e_ptr = m_executor_exception;
-	m_executor_exception = nullptr;
-	if (e_ptr) {
-		assert(m_executor_finished);
-		std::rethrow_exception(e_ptr);
+auto Coroutine<Return, Message>::SpinSynchronizer::executor_start() -> void {
+	wait_turn(Turn::executor);
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::SpinSynchronizer::executor_yield(Return value) -> MessageOrStop {
+	assert(m_turn.load() == Turn::executor);
+	this->m_value = std::move(value);
+	give_turn(Turn::coroutine);
+	wait_turn(Turn::executor);
+	return std::move(this->m_instruction);
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::SpinSynchronizer::executor_terminate(std::exception_ptr const& e) -> void {
+	assert(m_turn.load() == Turn::executor);
+	this->m_executor_exception = e;
+	this->m_executor_finished = true;
+	give_turn(Turn::coroutine);
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::SpinSynchronizer::wait_turn(Turn turn) -> void {
+	for (std::size_t i = 0; i < m_spin_budget; ++i) {
+		if (m_turn.load(std::memory_order_acquire) == turn) {
+			return;
+		}
+		utility::cpu_relax();
+	}
+	// Setting the flag before checking the turn guarantees that give_turn either sees the flag or that we see the turn.
+	auto& parked = parked_flag(turn);
+	auto lk = std::unique_lock{m_park_mutex};
+	parked.store(true);
+	m_park_signal.wait(lk, [this, turn] { return m_turn.load() == turn; });
+	parked.store(false);
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::SpinSynchronizer::give_turn(Turn turn) -> void {
+	m_turn.store(turn);
+	if (parked_flag(turn).load()) {
+		// Acquiring the mutex guarantees that the other side is waiting on the signal and will not miss it.
+		auto const lk = std::lock_guard{m_park_mutex};
+		m_park_signal.notify_one();
 	}
-	return std::move(lk);
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::SpinSynchronizer::parked_flag(Turn turn) noexcept -> std::atomic<bool>& {
+	return (turn == Turn::coroutine) ? m_coroutine_parked : m_executor_parked;
+}
+
+/****************************************************
+ *  Implementation of Coroutine::FiberSynchronizer  *
+ ****************************************************/
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::FiberSynchronizer::set_fiber(Fiber* fiber) noexcept -> void {
+	m_fiber = fiber;
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::FiberSynchronizer::coroutine_wait_executor() -> void {
+	assert(m_fiber != nullptr);
+	assert((m_thread == std::thread::id{}) || (m_thread == std::this_thread::get_id()));
+	if (!this->m_executor_finished) {
+		m_thread = std::this_thread::get_id();
+		m_fiber->resume();
+	}
+	this->maybe_throw();
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::FiberSynchronizer::coroutine_resume_executor(MessageOrStop new_instruction)
+	-> void {
+	this->m_instruction = std::move(new_instruction);
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::FiberSynchronizer::executor_start() -> void {}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::FiberSynchronizer::executor_yield(Return value) -> MessageOrStop {
+	this->m_value = std::move(value);
+	m_fiber->suspend();
+	return std::move(this->m_instruction);
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::FiberSynchronizer::executor_terminate(std::exception_ptr const& e) -> void {
+	// Control returns to the coroutine when the fiber function returns.
+	this->m_executor_exception = e;
+	this->m_executor_finished = true;
 }
 
 /*******************************************
@@ -262,23 +570,38 @@ Coroutine<Return, Message>::Executor::Executor(std::shared_ptr<Synchronizer> syn
 	m_synchronizer(std::move(synchronizer)) {}
 
 template <typename Return, typename Message> auto Coroutine<Return, Message>::Executor::start() -> void {
-	m_exclusion_lock = m_synchronizer->executor_start();
+	m_synchronizer->executor_start();
+	mark_resumed();
 }
 
 template <typename Return, typename Message>
 auto Coroutine<Return, Message>::Executor::yield(Return value) -> MessageOrStop {
-	auto [lock, instruction] = m_synchronizer->executor_yield(std::move(m_exclusion_lock), std::move(value));
-	m_exclusion_lock = std::move(lock);
-	return instruction;
+	m_synchronizer->start_handoff();
+	auto message = m_synchronizer->executor_yield(std::move(value));
+	m_synchronizer->end_handoff();
+	mark_resumed();
+	return message;
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::Executor::resumed_ticks() const noexcept -> std::uint64_t {
+	return m_resumed_ticks;
 }
 
 template <typename Return, typename Message> auto Coroutine<Return, Message>::Executor::terminate() -> void {
-	m_synchronizer->executor_terminate(std::move(m_exclusion_lock));
+	m_synchronizer->start_handoff();
+	m_synchronizer->executor_terminate(nullptr);
 }
 
 template <typename Return, typename Message>
 auto Coroutine<Return, Message>::Executor::terminate(std::exception_ptr&& except) -> void {
-	m_synchronizer->executor_terminate(std::move(m_exclusion_lock), except);
+	m_synchronizer->start_handoff();
+	m_synchronizer->executor_terminate(except);
+}
+
+template <typename Return, typename Message>
+auto Coroutine<Return, Message>::Executor::mark_resumed() noexcept -> void {
+	m_resumed_ticks = Profiler::is_enabled() ? profile_ticks() : 0;
 }
 
 /*********************************
@@ -287,70 +610,120 @@ auto Coroutine<Return, Message>::Executor::terminate(std::exception_ptr&& except
 
 template <typename Return, typename Message>
 template <typename Function, typename... Args>
-Coroutine<Return, Message>::Coroutine(Function&& func_, Args&&... args_) :
-	m_synchronizer(std::make_shared<Synchronizer>()) {
+Coroutine<Return, Message>::Coroutine(Function&& func, Args&&... args) :
+	Coroutine(default_coroutine_options(), std::forward<Function>(func), std::forward<Args>(args)...) {}
+
+template <typename Return, typename Message>
+template <typename Function, typename... Args>
+Coroutine<Return, Message>::Coroutine(CoroutineOptions options, Function&& func_, Args&&... args_) :
+	m_synchronizer(make_synchronizer(options)) {
 	auto executor = std::make_shared<Executor>(m_synchronizer);
 
-	auto executor_func = [executor](Function&& func, Args&&... args) {
+	auto executor_func =
+		[executor, func = std::forward<Function>(func_), args = std::make_tuple(std::forward<Args>(args_)...)]() mutable {
 		executor->start();
 		try {
 			using ExecutorArg = std::remove_const_t<std::remove_reference_t<utility::arg_t<0, Function>>>;
-			if constexpr (std::is_same_v<ExecutorArg, std::shared_ptr<Executor>>) {
-				func(executor, std::forward<Args>(args)...);
-			} else if constexpr (std::is_same_v<ExecutorArg, std::weak_ptr<Executor>>) {
-				func(std::weak_ptr<Executor>(executor), std::forward<Args>(args)...);
-			} else {
-				func(*executor, std::forward<Args>(args)...);
-			}
+			std::apply(
+				[&](auto&&... args_elem) {
+					if constexpr (std::is_same_v<ExecutorArg, std::shared_ptr<Executor>>) {
+						func(executor, std::move(args_elem)...);
+					} else if constexpr (std::is_same_v<ExecutorArg, std::weak_ptr<Executor>>) {
+						func(std::weak_ptr<Executor>(executor), std::move(args_elem)...);
+					} else {
+						func(*executor, std::move(args_elem)...);
+					}
+				},
+				args);
 			executor->terminate();
 		} catch (...) {
 			executor->terminate(std::current_exception());
 		}
 	};
 
-	executor_thread = std::thread(executor_func, std::forward<Function>(func_), std::forward<Args>(args_)...);
+	switch (options.backend) {
+	case CoroutineBackend::thread:
+	case CoroutineBackend::spin_thread:
+		if (options.use_thread_pool) {
+			executor_task = ThreadPool::global().submit(std::move(executor_func));
+		} else {
+			executor_thread = std::thread(std::move(executor_func));
+		}
+		return;
+	case CoroutineBackend::fiber: {
+		// std::function requires a copyable function
+		auto shared_func = std::make_shared<decltype(executor_func)>(std::move(executor_func));
+		executor_fiber = std::make_unique<Fiber>([shared_func] { (*shared_func)(); }, options.fiber_stack_size);
+		static_cast<FiberSynchronizer&>(*m_synchronizer).set_fiber(executor_fiber.get());
+		return;
+	}
+	default:
+		utility::unreachable();
+	}
 }
 
 template <typename Return, typename Message> Coroutine<Return, Message>::~Coroutine() noexcept {
 	assert(std::this_thread::get_id() != executor_thread.get_id());
-	if (executor_thread.joinable()) {
+	if (executor_thread.joinable() || executor_task.valid() || (executor_fiber != nullptr)) {
 		try {
 			stop_executor();
 		} catch (...) {
 			// if the Coroutine<Return, Message> is deleted but not waited on, then we ignore potential
 			// exceptions
 		}
+	}
+	if (executor_thread.joinable()) {
 		executor_thread.join();
 	}
+	if (executor_task.valid()) {
+		executor_task.wait();
+	}
 }
 
 template <typename Return, typename Message> auto Coroutine<Return, Message>::wait() -> MaybeReturn {
-	m_exclusion_lock = m_synchronizer->coroutine_wait_executor();
-	if (m_synchronizer->coroutine_executor_is_done(m_exclusion_lock)) {
+	m_synchronizer->coroutine_wait_executor();
+	m_synchronizer->end_handoff();
+	m_has_control = true;
+	if (m_synchronizer->coroutine_executor_is_done()) {
 		return std::nullopt;
 	}
 	return m_synchronizer->coroutine_pop_return();
 }
 
 template <typename Return, typename Message> auto Coroutine<Return, Message>::resume(Message instruction) -> void {
-	m_synchronizer->coroutine_resume_executor(std::move(m_exclusion_lock), std::move(instruction));
+	m_has_control = false;
+	m_synchronizer->start_handoff();
+	m_synchronizer->coroutine_resume_executor(std::move(instruction));
 }
 
 template <typename Return, typename Message>
-auto Coroutine<Return, Message>::Synchronizer::coroutine_stop_executor(Lock&& lk) -> void {
-	coroutine_resume_executor(std::move(lk), Coroutine::StopToken{});
+auto Coroutine<Return, Message>::make_synchronizer(CoroutineOptions const& options)
+	-> std::shared_ptr<Synchronizer> {
+	switch (options.backend) {
+	case CoroutineBackend::thread:
+		return std::make_shared<ThreadSynchronizer>();
+	case CoroutineBackend::spin_thread:
+		return std::make_shared<SpinSynchronizer>(options.spin_budget);
+	case CoroutineBackend::fiber:
+		return std::make_shared<FiberSynchronizer>();
+	default:
+		utility::unreachable();
+	}
 }
 
 template <typename Return, typename Message> auto Coroutine<Return, Message>::stop_executor() -> void {
-	if (!m_exclusion_lock.owns_lock()) {
-		m_exclusion_lock = m_synchronizer->coroutine_wait_executor();
+	if (!m_has_control) {
+		m_synchronizer->coroutine_wait_executor();
+		m_has_control = true;
 	}
 	// Could be an `if` statement because executors are supposed to terminate directly when being sent a StopToken.
 	// However, using coroutine with multiple SCIP callbacks, some callbacks might still be called even after
 	// `SCIPinterrupt` is called on `StopToken`.
-	while (!m_synchronizer->coroutine_executor_is_done(m_exclusion_lock)) {
-		m_synchronizer->coroutine_stop_executor(std::move(m_exclusion_lock));
-		m_exclusion_lock = m_synchronizer->coroutine_wait_executor();
+	while (!m_synchronizer->coroutine_executor_is_done()) {
+		m_has_control = false;
+		m_synchronizer->coroutine_stop_executor();
+		m_synchronizer->coroutine_wait_executor();
+		m_has_control = true;
 	}
 }
 
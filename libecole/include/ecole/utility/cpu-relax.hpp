@@ -0,0 +1,22 @@
+#pragma once
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace ecole::utility {
+
+/**
+ * Hint the processor that the calling thread is busy waiting.
+ *
+ * Reduce the power used and the penalty when exiting a spin loop, and give resources to the sibling hyper-thread.
+ */
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	_mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+	asm volatile("yield" ::: "memory");
+#endif
+}
+
+}  // namespace ecole::utility
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "ecole/export.hpp"
+
+namespace ecole::utility {
+
+/**
+ * Stackful execution context running in the thread of whoever resumes it.
+ *
+ * A fiber runs a function on its own stack.
+ * Control is passed explicitly and without involving the kernel scheduler: ``resume`` switches from the caller into
+ * the fiber, and ``suspend``, called from within the fiber, switches back to the caller.
+ *
+ * The function run by the fiber must not let exceptions escape.
+ * Destroying a suspended fiber does not unwind its stack, hence objects living on it are never destroyed.
+ */
+class ECOLE_EXPORT Fiber {
+public:
+	/** Stack size used when none is given, same as the default size of a thread stack on Linux. */
+	static std::size_t constexpr default_stack_size = 8UL << 20UL;  // NOLINT(readability-magic-numbers)
+
+	/**
+	 * Create the fiber without starting it.
+	 *
+	 * @param func The function executed on the fiber stack upon the first call to ``resume``.
+	 * @param stack_size The size of the stack allocated for the fiber.
+	 */
+	ECOLE_EXPORT Fiber(std::function<void()> func, std::size_t stack_size = default_stack_size);
+	Fiber(Fiber const&) = delete;
+	Fiber(Fiber&&) = delete;
+	ECOLE_EXPORT ~Fiber();
+
+	auto operator=(Fiber const&) -> Fiber& = delete;
+	auto operator=(Fiber&&) -> Fiber& = delete;
+
+	/**
+	 * Switch into the fiber until it calls ``suspend`` or its function returns.
+	 *
+	 * Must not be called from within the fiber itself, or once the fiber has finished.
+	 */
+	ECOLE_EXPORT auto resume() -> void;
+
+	/**
+	 * Switch back to the context that last called ``resume``.
+	 *
+	 * Must be called from within the fiber.
+	 */
+	ECOLE_EXPORT auto suspend() -> void;
+
+	/** Whether the function of the fiber has returned. */
+	[[nodiscard]] ECOLE_EXPORT auto is_finished() const noexcept -> bool;
+
+private:
+	struct Context;
+	std::unique_ptr<Context> m_context;
+};
+
+}  // namespace ecole::utility
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <string_view>
+#include <typeinfo>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+#include "ecole/export.hpp"
+
+namespace ecole::utility {
+
+/** Kind of work recorded by the Profiler. */
+enum struct ECOLE_EXPORT ProfileCategory : std::uint8_t {
+	/** Transfer of control between a Coroutine and its executor. */
+	coroutine,
+	/** SCIP solving, between two callbacks. */
+	solving,
+	observation,
+	reward,
+	information,
+	/** Conversion of data to Python objects. */
+	python,
+};
+
+/**
+ * Read the timestamp used by the Profiler.
+ *
+ * This is the CPU timestamp counter where available, falling back to std::chrono::steady_clock.
+ * Both are comparable between threads, provided the processor has an invariant timestamp counter, as modern ones do.
+ */
+inline auto profile_ticks() noexcept -> std::uint64_t {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/**
+ * Process-wide recorder of the time spent in the different phases of environment transitions.
+ *
+ * Every thread records its events in its own ring buffer, without locking, so that recording does not synchronize
+ * threads.
+ * When a buffer is full, the oldest events of the thread are overwritten.
+ * Recording is disabled by default, in which case the cost of a ProfileScope is reduced to reading an atomic flag.
+ *
+ * Events are exported as a Chrome trace, readable with ``chrome://tracing`` or Perfetto, or as folded stacks, the text
+ * format used to draw flame graphs.
+ * Events are nested according to their time intervals on each thread.
+ * Exporting and clearing events must be done while no thread is recording.
+ */
+class ECOLE_EXPORT Profiler {
+public:
+	/** Whether events are recorded. */
+	[[nodiscard]] static auto is_enabled() noexcept -> bool { return enabled_flag.load(std::memory_order_relaxed); }
+
+	/** Start recording events. */
+	ECOLE_EXPORT static auto enable() -> void;
+
+	/** Stop recording events, keeping the ones already recorded. */
+	ECOLE_EXPORT static auto disable() -> void;
+
+	/** Delete all recorded events. */
+	ECOLE_EXPORT static auto clear() -> void;
+
+	/**
+	 * Change the number of events kept for each thread.
+	 *
+	 * Only applies to threads that did not record any event yet.
+	 */
+	ECOLE_EXPORT static auto set_buffer_capacity(std::size_t capacity) -> void;
+
+	/**
+	 * Record an event on the calling thread.
+	 *
+	 * Events are dropped if they cannot be recorded.
+	 *
+	 * @param name Name of the event, must remain valid until events are cleared, such as a string literal or the result
+	 *        of ``intern``.
+	 * @param category The kind of work done during the event.
+	 * @param start_ticks The profile_ticks when the event started.
+	 * @param end_ticks The profile_ticks when the event ended.
+	 */
+	ECOLE_EXPORT static auto
+	record(char const* name, ProfileCategory category, std::uint64_t start_ticks, std::uint64_t end_ticks) noexcept
+		-> void;
+
+	/** Return a copy of the name valid for the lifetime of the program, the same for all equal names. */
+	ECOLE_EXPORT static auto intern(std::string_view name) -> char const*;
+
+	/** Intern the name of a type without its namespaces, such as ``NodeBipartite`` for observation::NodeBipartite. */
+	ECOLE_EXPORT static auto intern(std::type_info const& type) -> char const*;
+
+	/** Write all recorded events in the Chrome trace event format. */
+	ECOLE_EXPORT static auto write_chrome_trace(std::ostream& out) -> void;
+	ECOLE_EXPORT static auto write_chrome_trace(std::filesystem::path const& filename) -> void;
+
+	/** Write the time in microseconds spent in every stack of events, excluding nested events, as folded stacks. */
+	ECOLE_EXPORT static auto write_flame_graph(std::ostream& out) -> void;
+	ECOLE_EXPORT static auto write_flame_graph(std::filesystem::path const& filename) -> void;
+
+private:
+	ECOLE_EXPORT static std::atomic<bool> enabled_flag;
+};
+
+/**
+ * Name of the type in the Profiler, interned on first use only.
+ *
+ * This is the same name as the Python class of the bound data functions.
+ */
+template <typename T> auto profile_name() -> char const* {
+	static auto const* const name = Profiler::intern(typeid(T));
+	return name;
+}
+
+/**
+ * Record the lifetime of the scope as an event, when the Profiler is enabled.
+ */
+class ProfileScope {
+public:
+	/** Start the event, with the same name and category as in Profiler::record. */
+	ProfileScope(char const* name, ProfileCategory category) noexcept :
+		m_name{name}, m_category{category}, m_start_ticks{Profiler::is_enabled() ? profile_ticks() : 0} {}
+	ProfileScope(ProfileScope const&) = delete;
+	ProfileScope(ProfileScope&&) = delete;
+	~ProfileScope() {
+		if (m_start_ticks != 0) {
+			Profiler::record(m_name, m_category, m_start_ticks, profile_ticks());
+		}
+	}
+
+	auto operator=(ProfileScope const&) -> ProfileScope& = delete;
+	auto operator=(ProfileScope&&) -> ProfileScope& = delete;
+
+private:
+	char const* m_name;
+	ProfileCategory m_category;
+	std::uint64_t m_start_ticks;
+};
+
+}  // namespace ecole::utility
@@ -2,8 +2,11 @@
 
 #include <array>
 #include <cstddef>
+#include <limits>
+#include <stdexcept>
 #include <tuple>
 
+#include <xtensor/xbuilder.hpp>
 #include <xtensor/xtensor.hpp>
 
 namespace ecole::utility {
@@ -13,14 +16,18 @@ namespace ecole::utility {
  *
  * Indices are given with shape (2, nnz, that is indices[0] are row indices and indices[1] are columns indicies.
  *
+ * @tparam T The type of the non zero values.
+ * @tparam I The type of the indices, narrower integers can be used to save memory on large matrices.
+ *
  * FIXME there is early development of a sparse xtensor to replace this class, but it still a bit early.
  * https://github.com/xtensor-stack/xtensor-sparse
  */
-template <typename T> struct coo_matrix {
+template <typename T, typename I = std::size_t> struct coo_matrix {
 	using value_type = T;
+	using index_type = I;
 
 	xt::xtensor<value_type, 1> values;
-	xt::xtensor<std::size_t, 2> indices;
+	xt::xtensor<index_type, 2> indices;
 	std::array<std::size_t, 2> shape = {0, 0};
 
 	using Tuple = std::tuple<decltype(values), decltype(indices), decltype(shape)>;
@@ -35,23 +42,152 @@ template <typename T> struct coo_matrix {
 	auto operator==(coo_matrix const& other) const -> bool;
 };
 
+/**
+ * Simple compressed sparse row matrix.
+ *
+ * The column indices and values of row ``i`` are stored in the range ``[row_pointers[i], row_pointers[i+1])``, so
+ * that ``row_pointers`` has one more element than there are rows.
+ * This is the layout of Scipy's ``scipy.sparse.csr_matrix`` and PyTorch ``torch.sparse_csr_tensor``, and it uses
+ * ``nnz + rows + 1`` indices instead of the ``2 * nnz`` of a coo_matrix.
+ *
+ * @tparam T The type of the non zero values.
+ * @tparam I The type of the indices, narrower integers can be used to save memory on large matrices.
+ */
+template <typename T, typename I = std::size_t> struct csr_matrix {
+	using value_type = T;
+	using index_type = I;
+
+	xt::xtensor<value_type, 1> values;
+	xt::xtensor<index_type, 1> column_indices;
+	xt::xtensor<index_type, 1> row_pointers;
+	std::array<std::size_t, 2> shape = {0, 0};
+
+	using Tuple = std::tuple<decltype(values), decltype(column_indices), decltype(row_pointers), decltype(shape)>;
+
+	[[nodiscard]] static auto from_tuple(Tuple t) -> csr_matrix;
+
+	[[nodiscard]] auto to_tuple() const& -> Tuple;
+	[[nodiscard]] auto to_tuple() && -> Tuple;
+
+	[[nodiscard]] auto nnz() const noexcept -> std::size_t { return values.size(); }
+
+	auto operator==(csr_matrix const& other) const -> bool;
+};
+
+/**
+ * Convert a coordinate matrix to the compressed sparse row format.
+ *
+ * The non zeros need not be sorted, the ones in the same row keep their relative order.
+ */
+template <typename T, typename I> auto to_csr(coo_matrix<T, I> const& matrix) -> csr_matrix<T, I>;
+
+/** Convert a compressed sparse row matrix to the coordinate format, with non zeros sorted by row. */
+template <typename T, typename I> auto to_coo(csr_matrix<T, I> const& matrix) -> coo_matrix<T, I>;
+
+/**
+ * Check that a sparse matrix with the given shape and number of non zeros can be indexed with ``I``.
+ *
+ * This covers the row and column indices, as well as the row pointers of a csr_matrix, which go up to ``nnz``.
+ *
+ * @throw std::overflow_error if the dimensions or number of non zeros do not fit in ``I``.
+ */
+template <typename I> auto check_index_range(std::array<std::size_t, 2> const& shape, std::size_t nnz) -> void;
+
 /**********************************
  *  Implementation of coo_matrix  *
  **********************************/
 
-template <typename T> auto coo_matrix<T>::from_tuple(Tuple t) -> coo_matrix {
+template <typename T, typename I> auto coo_matrix<T, I>::from_tuple(Tuple t) -> coo_matrix {
 	return std::apply([](auto&&... vals) { return coo_matrix{std::forward<decltype(vals)>(vals)...}; }, std::move(t));
 }
 
-template <typename T> auto coo_matrix<T>::to_tuple() const& -> Tuple {
+template <typename T, typename I> auto coo_matrix<T, I>::to_tuple() const& -> Tuple {
 	return {values, indices, shape};
 }
-template <typename T> auto coo_matrix<T>::to_tuple() && -> Tuple {
+template <typename T, typename I> auto coo_matrix<T, I>::to_tuple() && -> Tuple {
 	return {std::move(values), std::move(indices), shape};
 }
 
-template <typename T> auto coo_matrix<T>::operator==(coo_matrix const& other) const -> bool {
+template <typename T, typename I> auto coo_matrix<T, I>::operator==(coo_matrix const& other) const -> bool {
 	return std::tie(values, indices, shape) == std::tie(other.values, other.indices, other.shape);
 }
 
+/**********************************
+ *  Implementation of csr_matrix  *
+ **********************************/
+
+template <typename T, typename I> auto csr_matrix<T, I>::from_tuple(Tuple t) -> csr_matrix {
+	return std::apply([](auto&&... vals) { return csr_matrix{std::forward<decltype(vals)>(vals)...}; }, std::move(t));
+}
+
+template <typename T, typename I> auto csr_matrix<T, I>::to_tuple() const& -> Tuple {
+	return {values, column_indices, row_pointers, shape};
+}
+template <typename T, typename I> auto csr_matrix<T, I>::to_tuple() && -> Tuple {
+	return {std::move(values), std::move(column_indices), std::move(row_pointers), shape};
+}
+
+template <typename T, typename I> auto csr_matrix<T, I>::operator==(csr_matrix const& other) const -> bool {
+	auto const members = std::tie(values, column_indices, row_pointers, shape);
+	return members == std::tie(other.values, other.column_indices, other.row_pointers, other.shape);
+}
+
+/***********************************
+ *  Implementation of conversions  *
+ ***********************************/
+
+template <typename T, typename I> auto to_csr(coo_matrix<T, I> const& matrix) -> csr_matrix<T, I> {
+	auto const nnz = matrix.nnz();
+	auto const n_rows = matrix.shape[0];
+	auto csr = csr_matrix<T, I>{
+		decltype(csr_matrix<T, I>::values)::from_shape({nnz}),
+		decltype(csr_matrix<T, I>::column_indices)::from_shape({nnz}),
+		xt::zeros<I>({n_rows + 1}),
+		matrix.shape,
+	};
+
+	// Count the non zeros of every row, then offset them to get where each row starts
+	for (std::size_t k = 0; k < nnz; ++k) {
+		++csr.row_pointers[static_cast<std::size_t>(matrix.indices(0, k)) + 1];
+	}
+	for (std::size_t i = 0; i < n_rows; ++i) {
+		csr.row_pointers[i + 1] += csr.row_pointers[i];
+	}
+
+	// Scatter the non zeros, using the row pointers as insertion positions shifted by one row
+	for (std::size_t k = 0; k < nnz; ++k) {
+		auto const row = static_cast<std::size_t>(matrix.indices(0, k));
+		auto const pos = static_cast<std::size_t>(csr.row_pointers[row]++);
+		csr.column_indices[pos] = matrix.indices(1, k);
+		csr.values[pos] = matrix.values[k];
+	}
+	for (std::size_t i = n_rows; i > 0; --i) {
+		csr.row_pointers[i] = csr.row_pointers[i - 1];
+	}
+	csr.row_pointers[0] = 0;
+	return csr;
+}
+
+template <typename T, typename I> auto to_coo(csr_matrix<T, I> const& matrix) -> coo_matrix<T, I> {
+	auto const nnz = matrix.nnz();
+	auto coo = coo_matrix<T, I>{matrix.values, decltype(coo_matrix<T, I>::indices)::from_shape({2, nnz}), matrix.shape};
+	for (std::size_t i = 0; i < matrix.shape[0]; ++i) {
+		auto const end = static_cast<std::size_t>(matrix.row_pointers[i + 1]);
+		for (auto k = static_cast<std::size_t>(matrix.row_pointers[i]); k < end; ++k) {
+			coo.indices(0, k) = static_cast<I>(i);
+			coo.indices(1, k) = matrix.column_indices[k];
+		}
+	}
+	return coo;
+}
+
+template <typename I> auto check_index_range(std::array<std::size_t, 2> const& shape, std::size_t nnz) -> void {
+	if constexpr (std::numeric_limits<I>::digits < std::numeric_limits<std::size_t>::digits) {
+		constexpr auto max_index = static_cast<std::size_t>(std::numeric_limits<I>::max());
+		if ((shape[0] > max_index) || (shape[1] > max_index) || (nnz > max_index)) {
+			throw std::overflow_error{"Sparse matrix is too large for its index type."};
+		}
+	}
+}
+
 }  // namespace ecole::utility
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ecole/export.hpp"
+
+namespace ecole::utility {
+
+/**
+ * Pool of persistent threads running tasks.
+ *
+ * A task is run on an idle worker, or on a new worker if they are all busy, so a task never waits for another one to
+ * finish before starting.
+ * This makes the pool suited for tasks that block for a long time, such as coroutine executors.
+ * When a worker finishes a task, it waits for the next one if there are less idle workers than the pool size, and
+ * terminates otherwise.
+ * A worker is idle again before the result of its task is published, hence a pool of size one to which
+ * tasks are submitted one at a time runs them all on the same thread.
+ */
+class ECOLE_EXPORT ThreadPool {
+public:
+	/** When the workers of a pool are started. */
+	enum struct Start {
+		/** Idle workers are started up to the pool size when the pool is created or resized. */
+		eager,
+		/** Workers are only started when tasks are submitted, and are then kept alive up to the pool size. */
+		lazy,
+	};
+
+	/**
+	 * Process-wide pool, used to run the executors of coroutines.
+	 *
+	 * Its workers are started lazily, so that processes not using the pool do not pay for it.
+	 */
+	ECOLE_EXPORT static auto global() -> ThreadPool&;
+
+	/**
+	 * Create a pool and start its workers.
+	 *
+	 * @param size The number of idle workers kept alive waiting for tasks.
+	 * @param start Whether to start the idle workers now, or as tasks are submitted.
+	 */
+	ECOLE_EXPORT ThreadPool(std::size_t size = std::thread::hardware_concurrency(), Start start = Start::eager);
+	ThreadPool(ThreadPool const&) = delete;
+	ThreadPool(ThreadPool&&) = delete;
+	/** Wait for all submitted tasks to finish and join the workers. */
+	ECOLE_EXPORT ~ThreadPool();
+
+	auto operator=(ThreadPool const&) -> ThreadPool& = delete;
+	auto operator=(ThreadPool&&) -> ThreadPool& = delete;
+
+	/** The number of idle workers kept alive waiting for tasks. */
+	[[nodiscard]] ECOLE_EXPORT auto size() const -> std::size_t;
+
+	/** The number of workers started and not terminated, whether busy or idle. */
+	[[nodiscard]] ECOLE_EXPORT auto n_workers() const -> std::size_t;
+
+	/**
+	 * Change the number of idle workers kept alive waiting for tasks.
+	 *
+	 * With an eager start, new workers are started immediately if needed.
+	 * Exceeding idle workers terminate.
+	 */
+	ECOLE_EXPORT auto resize(std::size_t size) -> void;
+
+	/**
+	 * Pin the workers to the given CPUs.
+	 *
+	 * Workers, current and future, are assigned to the CPUs in a round robin fashion.
+	 * An empty vector removes the restriction.
+	 *
+	 * @throw std::runtime_error if thread affinity is not supported on the platform.
+	 * @throw std::system_error if a worker could not be pinned.
+	 */
+	ECOLE_EXPORT auto pin(std::vector<std::size_t> cpus) -> void;
+
+	/**
+	 * Run a function on one of the workers.
+	 *
+	 * @return A future holding the result of the function, or the exception it raised.
+	 */
+	template <typename Function>
+	auto submit(Function&& func) -> std::future<std::invoke_result_t<std::decay_t<Function>>>;
+
+private:
+	/**
+	 * Type erased task.
+	 *
+	 * The result is published separately from running the task so that the worker can be made available again in
+	 * between, and be reused by a task submitted as soon as the result is received.
+	 */
+	class Task {
+	public:
+		Task() = default;
+		Task(Task const&) = delete;
+		Task(Task&&) = delete;
+		virtual ~Task() = default;
+
+		auto operator=(Task const&) -> Task& = delete;
+		auto operator=(Task&&) -> Task& = delete;
+
+		virtual auto run() noexcept -> void = 0;
+		virtual auto publish() noexcept -> void = 0;
+	};
+
+	template <typename Function, typename Result> class FunctionTask;
+
+	struct Worker {
+		std::thread thread;
+		std::size_t cpu_index = 0;
+	};
+
+	mutable std::mutex m_mutex;
+	std::condition_variable m_task_signal;
+	std::condition_variable m_retire_signal;
+	std::deque<std::unique_ptr<Task>> m_tasks;
+	std::vector<Worker> m_workers;
+	std::vector<std::thread> m_finished_workers;
+	std::vector<std::size_t> m_cpus;
+	std::size_t m_size = 0;
+	std::size_t m_n_idle = 0;
+	std::size_t m_n_started = 0;
+	Start m_start;
+	bool m_stopping = false;
+
+	auto push(std::unique_ptr<Task> task) -> void;
+	auto start_worker(std::unique_lock<std::mutex> const& lk) -> void;
+	auto join_finished_workers(std::unique_lock<std::mutex>& lk) -> void;
+	auto work() -> void;
+};
+
+/**
+ * Call the function on all indices in ``[0, n_tasks)``, split among at most ``n_threads`` threads.
+ *
+ * The calling thread takes part in the work, the others are run on the pool.
+ * Indices are split in strided chunks to balance tasks that take longer in consecutive indices.
+ * All tasks are waited for, even if one throws, after what the first exception is rethrown.
+ */
+template <typename Function>
+auto parallel_for(ThreadPool& pool, std::size_t n_threads, std::size_t n_tasks, Function const& func) -> void;
+
+/**********************************
+ *  Implementation of ThreadPool  *
+ **********************************/
+
+template <typename Function, typename Result> class ThreadPool::FunctionTask final : public Task {
+public:
+	template <typename Func> FunctionTask(Func&& func) : m_func{std::forward<Func>(func)} {}
+
+	auto future() -> std::future<Result> { return m_promise.get_future(); }
+
+	auto run() noexcept -> void override {
+		try {
+			if constexpr (std::is_void_v<Result>) {
+				(*m_func)();
+			} else {
+				m_result.emplace((*m_func)());
+			}
+		} catch (...) {
+			m_exception = std::current_exception();
+		}
+		// Release the resources held by the function before the result is received
+		m_func.reset();
+	}
+
+	auto publish() noexcept -> void override {
+		if (m_exception) {
+			m_promise.set_exception(m_exception);
+		} else if constexpr (std::is_void_v<Result>) {
+			m_promise.set_value();
+		} else {
+			m_promise.set_value(std::move(*m_result));
+		}
+	}
+
+private:
+	std::optional<Function> m_func;
+	std::optional<std::conditional_t<std::is_void_v<Result>, bool, Result>> m_result;
+	std::exception_ptr m_exception;  // NOLINT(bugprone-throw-keyword-missing)
+	std::promise<Result> m_promise;
+};
+
+template <typename Function>
+auto ThreadPool::submit(Function&& func) -> std::future<std::invoke_result_t<std::decay_t<Function>>> {
+	using Result = std::invoke_result_t<std::decay_t<Function>>;
+	auto task = std::make_unique<FunctionTask<std::decay_t<Function>, Result>>(std::forward<Function>(func));
+	auto future = task->future();
+	push(std::move(task));
+	return future;
+}
+
+template <typename Function>
+auto parallel_for(ThreadPool& pool, std::size_t n_threads, std::size_t n_tasks, Function const& func) -> void {
+	auto const n_chunks = std::min(n_tasks, n_threads);
+	auto const run_chunk = [&func, n_tasks, n_chunks](std::size_t chunk) {
+		for (auto i = chunk; i < n_tasks; i += n_chunks) {
+			func(i);
+		}
+	};
+
+	auto futures = std::vector<std::future<void>>{};
+	futures.reserve(n_chunks);
+	for (std::size_t chunk = 1; chunk < n_chunks; ++chunk) {
+		futures.push_back(pool.submit([&run_chunk, chunk] { run_chunk(chunk); }));
+	}
+
+	auto exception = std::exception_ptr{};
+	try {
+		if (n_chunks > 0) {
+			run_chunk(0);
+		}
+	} catch (...) {
+		exception = std::current_exception();
+	}
+	for (auto& future : futures) {
+		try {
+			future.get();
+		} catch (...) {
+			if (!exception) {
+				exception = std::current_exception();
+			}
+		}
+	}
+	if (exception) {
+		std::rethrow_exception(exception);
+	}
+}
+
+}  // namespace ecole::utility
@@ -10,7 +10,8 @@
 
 namespace ecole::dynamics {
 
-BranchingDynamics::BranchingDynamics(bool pseudo_candidates_) noexcept : pseudo_candidates(pseudo_candidates_) {}
+BranchingDynamics::BranchingDynamics(bool pseudo_candidates_, bool reuse_strong_branching_) noexcept :
+	pseudo_candidates(pseudo_candidates_), reuse_strong_branching(reuse_strong_branching_) {}
 
 namespace {
 
@@ -55,6 +56,11 @@ auto BranchingDynamics::reset_dynamics(scip::Model& model) const -> std::tuple<b
 
 auto BranchingDynamics::step_dynamics(scip::Model& model, Defaultable<std::size_t> maybe_var_idx) const
 	-> std::tuple<bool, ActionSet> {
+	step_dynamics_async(model, maybe_var_idx);
+	return step_dynamics_wait(model);
+}
+
+auto BranchingDynamics::step_dynamics_async(scip::Model& model, Defaultable<std::size_t> maybe_var_idx) const -> void {
 	// Default fallback to SCIP default branching
 	auto scip_result = SCIP_DIDNOTRUN;
 
@@ -67,12 +73,23 @@ auto BranchingDynamics::step_dynamics(scip::Model& model, Defaultable<std::size_
 				fmt::format("Branching candidate index {} larger than the number of variables ({}).", var_idx, vars.size())};
 		}
 		// Branching
-		scip::call(SCIPbranchVar, model.get_scip_ptr(), vars[var_idx], nullptr, nullptr, nullptr);
-		scip_result = SCIP_BRANCHED;
+		auto* const scip = model.get_scip_ptr();
+		auto const* const sb_result =
+			reuse_strong_branching ? model.strong_branching_cache().find(scip, vars[var_idx]) : nullptr;
+		if (sb_result != nullptr) {
+			scip_result = scip::branch_var(scip, *sb_result);
+		} else {
+			scip::call(SCIPbranchVar, scip, vars[var_idx], nullptr, nullptr, nullptr);
+			scip_result = SCIP_BRANCHED;
+		}
 	}
 
+	model.solve_iter_resume(scip_result);
+}
+
+auto BranchingDynamics::step_dynamics_wait(scip::Model& model) const -> std::tuple<bool, ActionSet> {
 	// Looping until the next LP branchrule rule callback, if it exists.
-	auto fcall = model.solve_iter_continue(scip_result);
+	auto fcall = model.solve_iter_wait();
 	return keep_solving_until_next_LP_callback(model, fcall, pseudo_candidates);
 }
 
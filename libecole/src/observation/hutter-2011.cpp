@@ -1,17 +1,22 @@
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
 #include <optional>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <range/v3/numeric/accumulate.hpp>
-#include <range/v3/range/conversion.hpp>
-#include <range/v3/view/iota.hpp>
 #include <range/v3/view/transform.hpp>
+#include <lpi/lpi.h>
 #include <scip/scip.h>
 #include <xtensor/xadapt.hpp>
-#include <xtensor/xindex_view.hpp>
+#include <xtensor/xmanipulation.hpp>
 #include <xtensor/xsort.hpp>
 #include <xtensor/xtensor.hpp>
 #include <xtensor/xview.hpp>
@@ -21,7 +26,6 @@
 #include "ecole/scip/model.hpp"
 #include "ecole/utility/sparse-matrix.hpp"
 
-#include "utility/graph.hpp"
 #include "utility/math.hpp"
 
 namespace ecole::observation {
@@ -33,6 +37,7 @@ namespace views = ranges::views;
 using Features = Hutter2011Obs::Features;
 using value_type = decltype(Hutter2011Obs::features)::value_type;
 using ConstraintMatrix = ecole::utility::coo_matrix<SCIP_Real>;
+using ConstraintCsr = ecole::utility::csr_matrix<SCIP_Real>;
 std::size_t constexpr cons_axis = 0;
 std::size_t constexpr var_axis = 1;
 
@@ -124,40 +129,142 @@ template <typename E, typename QT, std::size_t QN> auto quantiles(E&& data, std:
 	return quants;
 }
 
-/** [12-17,20] Variable graph features. */
-template <typename Tensor> void set_var_degrees(Tensor&& out, ConstraintMatrix const& matrix) {
-	auto const n_var = matrix.shape[var_axis];
-	auto const n_cons = matrix.shape[cons_axis];
-	// Build variable graph.
-	// TODO could be optimized if we know matrix.indices[cons_axis] is sorted (or sort it).
-	auto graph = utility::Graph{n_var};
-	for (std::size_t cons = 0; cons < n_cons; ++cons) {
-		auto const vars =
-			xt::eval(xt::filter(xt::row(matrix.indices, var_axis), xt::equal(xt::row(matrix.indices, cons_axis), cons)));
-		auto const* const var_end = vars.end();
-		for (auto const* var1_iter = vars.begin(); var1_iter < var_end; ++var1_iter) {
-			for (auto const* var2_iter = var1_iter + 1; var2_iter < var_end; ++var2_iter) {
-				if (!graph.are_connected(*var1_iter, *var2_iter)) {
-					graph.add_edge({*var1_iter, *var2_iter});
+/** Swap the rows and columns of a coordinate matrix. */
+auto transpose(ConstraintMatrix const& matrix) -> ConstraintMatrix {
+	return {matrix.values, decltype(matrix.indices){xt::flip(matrix.indices, 0)}, {matrix.shape[1], matrix.shape[0]}};
+}
+
+/**
+ * Exact node degrees in the variable graph, where variables are adjacent if they appear in a common constraint.
+ *
+ * The neighborhood of a variable is the union of the variables of its constraints.
+ * Variables already counted are marked with the (one based) index of the current variable, so that the marks need
+ * not be cleared between variables.
+ *
+ * @param cons_vars The variables of every constraint, one row per constraint.
+ * @param var_conss The constraints of every variable, one row per variable.
+ */
+auto exact_var_degrees(ConstraintCsr const& cons_vars, ConstraintCsr const& var_conss) -> std::vector<std::size_t> {
+	auto const n_var = var_conss.shape[0];
+	auto degrees = std::vector<std::size_t>(n_var, 0);
+	auto marks = std::vector<std::size_t>(n_var, 0);
+	for (std::size_t var = 0; var < n_var; ++var) {
+		auto const mark = var + 1;
+		marks[var] = mark;  // Not adjacent to itself
+		for (auto k = var_conss.row_pointers[var]; k < var_conss.row_pointers[var + 1]; ++k) {
+			auto const cons = var_conss.column_indices[k];
+			for (auto l = cons_vars.row_pointers[cons]; l < cons_vars.row_pointers[cons + 1]; ++l) {
+				auto const neighbor = cons_vars.column_indices[l];
+				if (marks[neighbor] != mark) {
+					marks[neighbor] = mark;
+					++degrees[var];
 				}
 			}
 		}
 	}
+	return degrees;
+}
 
-	// Compute stats
-	auto get_var_degree = [&graph](auto var) { return graph.neighbors(var).size(); };
-	auto var_degrees = views::ints(0UL, n_var) | views::transform(get_var_degree) | ranges::to<std::vector>();
+/** Hash a node to a 64 bits number using the SplitMix64 finalizer. */
+constexpr auto hash_node(std::size_t node) noexcept -> std::uint64_t {
+	auto x = static_cast<std::uint64_t>(node) + 0x9E3779B97F4A7C15ULL;
+	x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+	x = (x ^ (x >> 27U)) * 0x94D049BB133111EBULL;
+	return x ^ (x >> 31U);
+}
+
+/**
+ * Estimated node degrees in the variable graph, where variables are adjacent if they appear in a common constraint.
+ *
+ * The size of the neighborhood of a variable is estimated with a k minimum values sketch: only the k smallest hashes
+ * of the variables of every constraint are kept, and the k-th smallest hash of their union gives an estimate of its
+ * size.
+ * Neighborhoods with less than k variables are counted exactly.
+ * The time is linear in the number of non zeros (times k) instead of quadratic in the size of the constraints.
+ *
+ * @param cons_vars The variables of every constraint, one row per constraint.
+ * @param var_conss The constraints of every variable, one row per variable.
+ * @param sketch_size The number k of hashes kept per constraint.
+ */
+auto approximate_var_degrees(ConstraintCsr const& cons_vars, ConstraintCsr const& var_conss, std::size_t sketch_size)
+	-> std::vector<std::size_t> {
+	auto const n_var = var_conss.shape[0];
+	auto const n_cons = cons_vars.shape[0];
+	auto const k = std::max<std::size_t>(sketch_size, 3);
+
+	// The sorted k smallest hashes of every constraint, in a compressed sparse row layout
+	auto sketches = std::vector<std::uint64_t>{};
+	auto sketch_pointers = std::vector<std::size_t>(n_cons + 1, 0);
+	for (std::size_t cons = 0; cons < n_cons; ++cons) {
+		auto const begin = sketches.size();
+		for (auto l = cons_vars.row_pointers[cons]; l < cons_vars.row_pointers[cons + 1]; ++l) {
+			sketches.push_back(hash_node(cons_vars.column_indices[l]));
+		}
+		auto const end = std::min(begin + k, sketches.size());
+		auto* const data = sketches.data();
+		std::partial_sort(data + begin, data + end, data + sketches.size());
+		sketches.resize(end);
+		sketch_pointers[cons + 1] = end;
+	}
+
+	auto degrees = std::vector<std::size_t>(n_var, 0);
+	auto neighborhood = std::vector<std::uint64_t>{};
+	for (std::size_t var = 0; var < n_var; ++var) {
+		neighborhood.clear();
+		for (auto k_cons = var_conss.row_pointers[var]; k_cons < var_conss.row_pointers[var + 1]; ++k_cons) {
+			auto const cons = var_conss.column_indices[k_cons];
+			neighborhood.insert(
+				neighborhood.end(),
+				sketches.begin() + static_cast<std::ptrdiff_t>(sketch_pointers[cons]),
+				sketches.begin() + static_cast<std::ptrdiff_t>(sketch_pointers[cons + 1]));
+		}
+		std::sort(neighborhood.begin(), neighborhood.end());
+		neighborhood.erase(std::unique(neighborhood.begin(), neighborhood.end()), neighborhood.end());
+
+		// The variable itself is in the union of its constraints
+		if (neighborhood.size() < k) {
+			degrees[var] = neighborhood.empty() ? 0 : neighborhood.size() - 1;
+		} else {
+			auto constexpr hash_max = static_cast<double>(std::numeric_limits<std::uint64_t>::max());
+			auto const kth_hash = (static_cast<double>(neighborhood[k - 1]) + 1.) / hash_max;
+			auto const n_neighborhood = static_cast<double>(k - 1) / kth_hash;
+			auto const degree = std::lround(n_neighborhood) - 1;
+			degrees[var] = std::clamp(static_cast<std::size_t>(degree), k - 1, n_var - 1);
+		}
+	}
+	return degrees;
+}
 
+/** [12-17,20] Variable graph features. */
+template <typename Tensor>
+void set_var_degrees(
+	Tensor&& out,
+	ConstraintMatrix const& cons_matrix,
+	ConstraintCsr const& cons_vars,
+	bool approximate_degrees,
+	std::size_t degree_sketch_size) {
+	auto const n_var = cons_matrix.shape[var_axis];
+	// Row sorted view of the transposed constraint matrix
+	auto const var_conss = utility::to_csr(transpose(cons_matrix));
+	auto var_degrees = [&] {
+		if (approximate_degrees) {
+			return approximate_var_degrees(cons_vars, var_conss, degree_sketch_size);
+		}
+		return exact_var_degrees(cons_vars, var_conss);
+	}();
+
+	// Compute stats
 	auto const stats = utility::compute_stats(var_degrees);
 	out[idx(Features::node_degree_mean)] = stats.mean;
 	out[idx(Features::node_degree_max)] = stats.max;
 	out[idx(Features::node_degree_min)] = stats.min;
 	out[idx(Features::node_degree_std)] = stats.stddev;
+	auto const n_edges = static_cast<value_type>(std::accumulate(var_degrees.begin(), var_degrees.end(), 0UL)) / 2.;
 	auto const quants = quantiles(xt::adapt(var_degrees), std::array<double, 2>{0.25, 0.75});
 	out[idx(Features::node_degree_25q)] = quants[0];
 	out[idx(Features::node_degree_75q)] = quants[1];
 	auto const n_edges_complete_graph = static_cast<value_type>(n_var * (n_var - 1)) / 2.;
-	out[idx(Features::edge_density)] = static_cast<value_type>(graph.n_edges()) / n_edges_complete_graph;
+	out[idx(Features::edge_density)] = n_edges / n_edges_complete_graph;
 }
 
 /** Solves the LP relaxation of a model by making a copy, and setting all its variables continuous. */
@@ -204,10 +311,106 @@ auto solve_lp_relaxation(scip::Model const& model) {
 	return std::tuple{std::move(optimal_sol_coefs), optimal_value};
 }
 
-/** [21-24] LP based features. */
-template <typename Tensor> void set_lp_based_features(Tensor&& out, scip::Model const& model) {
-	auto const [lp_solution, lp_objective] = solve_lp_relaxation(model);
+/** Free an LP interface when going out of scope. */
+struct LpiDeleter {
+	void operator()(SCIP_LPI* ptr) { scip::call(SCIPlpiFree, &ptr); }
+};
 
+/**
+ * Solves the LP relaxation of a model directly with the LP interface.
+ *
+ * The LP is built from the rows of the constraint matrix and the variable bounds, without copying nor presolving the
+ * model.
+ * The solution and objective value are NaN if the LP is not solved to optimality.
+ */
+auto solve_lp_relaxation_direct(
+	scip::Model const& model,
+	ConstraintCsr const& cons_vars,
+	xt::xtensor<SCIP_Real, 1> const& cons_biases) {
+	auto* const scip = const_cast<SCIP*>(model.get_scip_ptr());
+	auto const variables = model.variables();
+	auto const n_vars = variables.size();
+	auto const n_rows = cons_vars.shape[cons_axis];
+
+	// Transformed problems are always minimized
+	auto const is_transformed = SCIPisTransformed(scip) == TRUE;
+	auto const maximize = !is_transformed && (SCIPgetObjsense(scip) == SCIP_OBJSENSE_MAXIMIZE);
+	auto lpi = std::unique_ptr<SCIP_LPI, LpiDeleter>{};
+	{
+		SCIP_LPI* lpi_raw = nullptr;
+		auto const objsense = maximize ? SCIP_OBJSEN_MAXIMIZE : SCIP_OBJSEN_MINIMIZE;
+		scip::call(SCIPlpiCreate, &lpi_raw, SCIPgetMessagehdlr(scip), "hutter2011_relaxation", objsense);
+		lpi.reset(lpi_raw);
+	}
+	auto const lpi_infinity = SCIPlpiInfinity(lpi.get());
+	auto const to_lpi_bound = [scip, lpi_infinity](SCIP_Real bound) {
+		if (SCIPisInfinity(scip, std::abs(bound))) {
+			return bound > 0 ? lpi_infinity : -lpi_infinity;
+		}
+		return bound;
+	};
+
+	// Columns, with no coefficients as they are given with the rows
+	auto objective = std::vector<SCIP_Real>(n_vars);
+	auto lower_bounds = std::vector<SCIP_Real>(n_vars);
+	auto upper_bounds = std::vector<SCIP_Real>(n_vars);
+	for (std::size_t var_idx = 0; var_idx < n_vars; ++var_idx) {
+		objective[var_idx] = SCIPvarGetObj(variables[var_idx]);
+		lower_bounds[var_idx] = to_lpi_bound(SCIPvarGetLbGlobal(variables[var_idx]));
+		upper_bounds[var_idx] = to_lpi_bound(SCIPvarGetUbGlobal(variables[var_idx]));
+	}
+	scip::call(
+		SCIPlpiAddCols,
+		lpi.get(),
+		static_cast<int>(n_vars),
+		objective.data(),
+		lower_bounds.data(),
+		upper_bounds.data(),
+		nullptr,
+		0,
+		nullptr,
+		nullptr,
+		nullptr);
+
+	// Rows of the constraint matrix, all of the form Ax <= b
+	auto const lhs = std::vector<SCIP_Real>(n_rows, -lpi_infinity);
+	auto const rhs = std::vector<SCIP_Real>(cons_biases.begin(), cons_biases.end());
+	auto const begins = std::vector<int>(cons_vars.row_pointers.begin(), cons_vars.row_pointers.end() - 1);
+	auto const indices = std::vector<int>(cons_vars.column_indices.begin(), cons_vars.column_indices.end());
+	scip::call(
+		SCIPlpiAddRows,
+		lpi.get(),
+		static_cast<int>(n_rows),
+		lhs.data(),
+		rhs.data(),
+		nullptr,
+		static_cast<int>(cons_vars.nnz()),
+		begins.data(),
+		indices.data(),
+		cons_vars.values.data());
+
+	scip::call(SCIPlpiSolveDual, lpi.get());
+
+	auto solution = std::vector<SCIP_Real>(n_vars, std::nan(""));
+	auto objective_value = std::nan("");
+	if (SCIPlpiIsOptimal(lpi.get()) == TRUE) {
+		scip::call(SCIPlpiGetSol, lpi.get(), &objective_value, solution.data(), nullptr, nullptr, nullptr);
+		if (is_transformed) {
+			objective_value = SCIPretransformObj(scip, objective_value);
+		} else {
+			objective_value += SCIPgetOrigObjoffset(scip);
+		}
+	}
+	return std::tuple{std::move(solution), objective_value};
+}
+
+/** [21-24] LP based features. */
+template <typename Tensor>
+void set_lp_based_features(
+	Tensor&& out,
+	scip::Model const& model,
+	std::vector<SCIP_Real> const& lp_solution,
+	SCIP_Real lp_objective) {
 	// Compute the integer slack vector
 	auto* const scip = const_cast<SCIP*>(model.get_scip_ptr());
 	int const nb_integer_variables = SCIPgetNBinVars(scip) + SCIPgetNIntVars(scip);
@@ -362,14 +565,21 @@ template <typename Tensor> void set_variable_type_features(Tensor&& out, scip::M
 	out[idx(Features::ratio_continuous_vars)] = nb_cont_vars / (nb_int_vars + nb_cont_vars);
 }
 
-auto extract_features(scip::Model& model) {
+auto extract_features(
+	scip::Model& model,
+	ConstraintMatrix const& cons_matrix,
+	ConstraintCsr const& cons_vars,
+	xt::xtensor<SCIP_Real, 1> const& cons_biases,
+	std::vector<SCIP_Real> const& lp_solution,
+	SCIP_Real lp_objective,
+	bool approximate_degrees,
+	std::size_t degree_sketch_size) {
 	auto observation = xt::xtensor<value_type, 1>::from_shape({Hutter2011Obs::n_features});
-	auto const [cons_matrix, cons_biases] = scip::get_all_constraints(model.get_scip_ptr());
 
 	set_problem_size(observation, cons_matrix);
 	set_var_cons_degrees(observation, cons_matrix);
-	set_var_degrees(observation, cons_matrix);
-	set_lp_based_features(observation, model);
+	set_var_degrees(observation, cons_matrix, cons_vars, approximate_degrees, degree_sketch_size);
+	set_lp_based_features(observation, model, lp_solution, lp_objective);
 	set_obj_features(observation, model, cons_matrix);
 	set_cons_matrix_features(observation, cons_matrix, cons_biases);
 	set_variable_type_features(observation, model);
@@ -387,7 +597,33 @@ auto Hutter2011::extract(scip::Model& model, bool /* done */) -> std::optional<H
 	if (model.stage() >= SCIP_STAGE_SOLVING) {
 		return {};
 	}
-	return {{extract_features(model)}};
+	auto* const scip = model.get_scip_ptr();
+	auto const [cons_matrix, cons_biases] = scip::get_all_constraints(scip);
+	// Row sorted view of the constraint matrix
+	auto const cons_vars = utility::to_csr(cons_matrix);
+
+	auto const n_vars = static_cast<std::size_t>(SCIPgetNVars(scip));
+	auto const n_conss = static_cast<std::size_t>(SCIPgetNConss(scip));
+	auto const cache_key = std::tuple{model.id(), n_vars, n_conss};
+	if (!lp_relaxation.has_value() || (lp_relaxation->key != cache_key)) {
+		auto [solution, objective] = std::tuple<std::vector<SCIP_Real>, SCIP_Real>{};
+		if (direct_lp_relaxation) {
+			std::tie(solution, objective) = solve_lp_relaxation_direct(model, cons_vars, cons_biases);
+		} else {
+			std::tie(solution, objective) = solve_lp_relaxation(model);
+		}
+		lp_relaxation = LpRelaxation{cache_key, std::move(solution), objective};
+	}
+
+	return {{extract_features(
+		model,
+		cons_matrix,
+		cons_vars,
+		cons_biases,
+		lp_relaxation->solution,
+		lp_relaxation->objective,
+		approximate_degrees,
+		degree_sketch_size)}};
 }
 
 }  // namespace ecole::observation
@@ -1,11 +1,13 @@
+#include <algorithm>
 #include <cmath>
-#include <set>
+#include <cstddef>
+#include <memory>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <nonstd/span.hpp>
-#include <range/v3/numeric/accumulate.hpp>
-#include <range/v3/range/conversion.hpp>
 #include <range/v3/view/filter.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/zip.hpp>
@@ -176,6 +178,48 @@ auto extract_static_features(scip::Model& model) {
  * https://dl.acm.org/doi/10.5555/3015812.3015920
  */
 
+/**
+ * LP row data used by the dynamic features.
+ *
+ * The data is read from SCIP before computing the features of the candidates in parallel, so that no SCIP function
+ * is called concurrently.
+ */
+struct RowSnapshot {
+	SCIP_Real lhs;
+	SCIP_Real rhs;
+	SCIP_Real positive_coefs_sum;
+	SCIP_Real negative_coefs_sum;
+	std::size_t n_lp_nonz;
+	int lp_pos;
+	bool has_lhs;
+	bool has_rhs;
+	bool is_active;
+};
+
+/** Column data of a branching candidate used by the dynamic features. */
+struct CandidateSnapshot {
+	SCIP_Real floor_distance;
+	SCIP_Real pseudocost_up;
+	SCIP_Real pseudocost_down;
+	SCIP_Real n_cutoff_up;
+	SCIP_Real n_cutoff_down;
+	SCIP_Real n_branchings_up;
+	SCIP_Real n_branchings_down;
+	/** Index of the rows of the column in the snapshot of the rows. */
+	nonstd::span<std::size_t const> rows;
+	nonstd::span<SCIP_Real const> coefficients;
+};
+
+/** Read-only copy of the SCIP data needed for the dynamic features of all candidates. */
+struct Snapshot {
+	/** The LP rows, in the LP order, followed by the rows of the candidates that are not in the LP. */
+	std::vector<RowSnapshot> rows;
+	std::vector<CandidateSnapshot> candidates;
+	/** Storage of the rows and coefficients of all candidates, viewed by CandidateSnapshot. */
+	std::vector<std::size_t> candidates_rows;
+	std::vector<SCIP_Real> candidates_coefficients;
+};
+
 /**
  * Slack, ceil distances, and Pseudocosts.
  *
@@ -188,13 +232,11 @@ auto extract_static_features(scip::Model& model) {
  *     Upwards and downwards values, and their corresponding ratio, sum and product, weighted by the
  *     fractionality of xj.
  */
-template <typename Tensor>
-void set_slack_ceil_and_pseudocosts(Tensor&& out, SCIP* const scip, SCIP_VAR* const var, SCIP_COL* const col) noexcept {
-	auto const solval = SCIPcolGetPrimsol(col);
-	auto const floor_distance = SCIPfeasFrac(scip, solval);
+template <typename Tensor> void set_slack_ceil_and_pseudocosts(Tensor&& out, CandidateSnapshot const& cand) noexcept {
+	auto const floor_distance = cand.floor_distance;
 	auto const ceil_distance = 1. - floor_distance;
-	auto const weighted_pseudocost_up = ceil_distance * SCIPgetVarPseudocost(scip, var, SCIP_BRANCHDIR_UPWARDS);
-	auto const weighted_pseudocost_down = floor_distance * SCIPgetVarPseudocost(scip, var, SCIP_BRANCHDIR_DOWNWARDS);
+	auto const weighted_pseudocost_up = ceil_distance * cand.pseudocost_up;
+	auto const weighted_pseudocost_down = floor_distance * cand.pseudocost_down;
 	auto constexpr epsilon = 1e-5;
 	auto const wpu_approx = std::max(weighted_pseudocost_up, epsilon);
 	auto const wpd_approx = std::max(weighted_pseudocost_down, epsilon);
@@ -216,15 +258,11 @@ void set_slack_ceil_and_pseudocosts(Tensor&& out, SCIP* const scip, SCIP_VAR* co
  *
  * N.B. replaced by left, right infeasibility.
  */
-template <typename Tensor> void set_infeasibility_statistics(Tensor&& out, SCIP_VAR* const var) noexcept {
-	auto const n_infeasibles_up = SCIPvarGetCutoffSum(var, SCIP_BRANCHDIR_UPWARDS);
-	auto const n_infeasibles_down = SCIPvarGetCutoffSum(var, SCIP_BRANCHDIR_DOWNWARDS);
-	auto const n_branchings_up = static_cast<value_type>(SCIPvarGetNBranchings(var, SCIP_BRANCHDIR_UPWARDS));
-	auto const n_branchings_down = static_cast<value_type>(SCIPvarGetNBranchings(var, SCIP_BRANCHDIR_DOWNWARDS));
-	out[idx(Features::n_cutoff_up)] = n_infeasibles_up;
-	out[idx(Features::n_cutoff_down)] = n_infeasibles_down;
-	out[idx(Features::n_cutoff_up_ratio)] = safe_div(n_infeasibles_up, n_branchings_up);
-	out[idx(Features::n_cutoff_down_ratio)] = safe_div(n_infeasibles_down, n_branchings_down);
+template <typename Tensor> void set_infeasibility_statistics(Tensor&& out, CandidateSnapshot const& cand) noexcept {
+	out[idx(Features::n_cutoff_up)] = cand.n_cutoff_up;
+	out[idx(Features::n_cutoff_down)] = cand.n_cutoff_down;
+	out[idx(Features::n_cutoff_up_ratio)] = safe_div(cand.n_cutoff_up, cand.n_branchings_up);
+	out[idx(Features::n_cutoff_down_ratio)] = safe_div(cand.n_cutoff_down, cand.n_branchings_down);
 }
 
 /**
@@ -239,9 +277,12 @@ template <typename Tensor> void set_infeasibility_statistics(Tensor&& out, SCIP_
  * avoid passing the wrong ones.
  */
 template <typename Tensor>
-void set_dynamic_stats_for_constraint_degree(Tensor&& out, nonstd::span<SCIP_ROW*> const rows) noexcept {
-	auto row_get_lp_nnz = [](auto const row) { return static_cast<std::size_t>(SCIProwGetNLPNonz(row)); };
-	auto const stats = utility::compute_stats(rows | views::transform(row_get_lp_nnz));
+void set_dynamic_stats_for_constraint_degree(
+	Tensor&& out,
+	std::vector<RowSnapshot> const& rows,
+	CandidateSnapshot const& cand) noexcept {
+	auto row_get_lp_nnz = [&rows](auto const row_idx) { return rows[row_idx].n_lp_nonz; };
+	auto const stats = utility::compute_stats(cand.rows | views::transform(row_get_lp_nnz));
 	auto const root_deg_mean = out[idx(Features::rows_deg_mean)];
 	auto const root_deg_min = out[idx(Features::rows_deg_min)];
 	auto const root_deg_max = out[idx(Features::rows_deg_max)];
@@ -262,9 +303,8 @@ void set_dynamic_stats_for_constraint_degree(Tensor&& out, nonstd::span<SCIP_ROW
 template <typename Tensor>
 void set_min_max_for_ratios_constraint_coeffs_rhs(
 	Tensor&& out,
-	SCIP* const scip,
-	nonstd::span<SCIP_ROW*> const rows,
-	nonstd::span<SCIP_Real> const coefficients) noexcept {
+	std::vector<RowSnapshot> const& rows,
+	CandidateSnapshot const& cand) noexcept {
 
 	value_type positive_rhs_ratio_max = -1.;
 	value_type positive_rhs_ratio_min = 1.;
@@ -282,13 +322,14 @@ void set_min_max_for_ratios_constraint_coeffs_rhs(
 		}
 	};
 
-	for (auto const [row, coef] : views::zip(rows, coefficients)) {
-		if (auto const rhs = SCIProwGetRhs(row); !SCIPisInfinity(scip, std::abs(rhs))) {
-			rhs_ratio_updates(coef, rhs);
+	for (auto const [row_idx, coef] : views::zip(cand.rows, cand.coefficients)) {
+		auto const& row = rows[row_idx];
+		if (row.has_rhs) {
+			rhs_ratio_updates(coef, row.rhs);
 		}
-		if (auto const lhs = SCIProwGetLhs(row); !SCIPisInfinity(scip, std::abs(lhs))) {
+		if (row.has_lhs) {
 			// lhs constraints are multiply by -1 to be considered as rhs constraints.
-			rhs_ratio_updates(-coef, -lhs);
+			rhs_ratio_updates(-coef, -row.lhs);
 		}
 	}
 
@@ -309,8 +350,8 @@ void set_min_max_for_ratios_constraint_coeffs_rhs(
 template <typename Tensor>
 void set_min_max_for_one_to_all_coefficient_ratios(
 	Tensor&& out,
-	nonstd::span<SCIP_ROW*> const rows,
-	nonstd::span<SCIP_Real> const coefficients) noexcept {
+	std::vector<RowSnapshot> const& rows,
+	CandidateSnapshot const& cand) noexcept {
 
 	value_type positive_positive_ratio_max = 0;
 	value_type positive_positive_ratio_min = 1;
@@ -321,8 +362,9 @@ void set_min_max_for_one_to_all_coefficient_ratios(
 	value_type negative_negative_ratio_max = 0;
 	value_type negative_negative_ratio_min = 1;
 
-	for (auto const [row, coef] : views::zip(rows, coefficients)) {
-		auto const [positive_coeficients_sum, negative_coeficients_sum] = sum_positive_negative(scip::get_vals(row));
+	for (auto const [row_idx, coef] : views::zip(cand.rows, cand.coefficients)) {
+		auto const positive_coeficients_sum = rows[row_idx].positive_coefs_sum;
+		auto const negative_coeficients_sum = rows[row_idx].negative_coefs_sum;
 		if (coef > 0) {
 			auto const positive_ratio = coef / positive_coeficients_sum;
 			auto const negative_ratio = coef / (coef - negative_coeficients_sum);
@@ -360,8 +402,30 @@ auto row_is_active(SCIP* const scip, SCIP_ROW* const row) noexcept -> bool {
 	return SCIProwIsInLP(row) && (SCIPisEQ(scip, activity, rhs) || SCIPisEQ(scip, activity, lhs));
 }
 
+/** Read the data of a row used by the dynamic features, given the sums of its positive and negative coefficients. */
+auto make_row_snapshot(
+	SCIP* const scip,
+	SCIP_ROW* const row,
+	bool is_active,
+	SCIP_Real positive_sum,
+	SCIP_Real negative_sum) noexcept -> RowSnapshot {
+	auto const lhs = SCIProwGetLhs(row);
+	auto const rhs = SCIProwGetRhs(row);
+	return {
+		lhs,
+		rhs,
+		positive_sum,
+		negative_sum,
+		static_cast<std::size_t>(SCIProwGetNLPNonz(row)),
+		SCIProwGetLPPos(row),
+		!SCIPisInfinity(scip, std::abs(lhs)),
+		!SCIPisInfinity(scip, std::abs(rhs)),
+		is_active,
+	};
+}
+
 /**
- * Compute the weight necessary for the stats for active constraints coefficients.
+ * Read the LP rows and compute the weight necessary for the stats for active constraints coefficients.
  *
  * The four coefficients are
  *   - unit weight,
@@ -371,43 +435,54 @@ auto row_is_active(SCIP* const scip, SCIP_ROW* const row) noexcept -> bool {
  * They are computed for every row that is active, as defined by @ref row_is_active.
  * Weights for non activate rows are left as NaN and ununsed.
  * This is equivalent to an unsafe/unchecked masked tensor.
+ *
+ * The LP rows are stored first in the snapshot, in the LP order, so that their activity and coefficient sums are
+ * computed once per extraction and shared by all candidates.
  */
-auto stats_for_active_constraint_coefficients_weights(scip::Model& model) {
+void take_lp_rows_snapshot(Snapshot& snapshot, xt::xtensor<value_type, 2>& weights, scip::Model& model) {
 	auto* const scip = model.get_scip_ptr();
 	auto const lp_rows = model.lp_rows();
-	auto const branch_candidates = model.pseudo_branch_cands() | ranges::to<std::set>();
 
-	/** Check if a column is a branching candidate. */
-	auto is_candidate = [&branch_candidates](auto* col) { return branch_candidates.count(SCIPcolGetVar(col)) > 0; };
-
-	/** Compute the sum of absolute values in a range. */
-	auto sum_abs = [](auto range) {
-		return ranges::accumulate(range | views::transform([](auto x) { return std::abs(x); }), 0.);
-	};
-
-	/** Compute the sum of absolute value of column coefficient if the column is a branching candidate. */
-	auto sum_abs_if_candidate = [&is_candidate](auto const& row_cols, auto const& row_cols_vals) {
-		auto sum = value_type{0.};
-		for (auto const [col, val] : views::zip(row_cols, row_cols_vals)) {
-			if (is_candidate(col)) {
-				sum += std::abs(val);
-			}
-		}
-		return sum;
-	};
+	// Dense mask indexed by the variables problem index, not vector<bool> for speed
+	auto is_candidate = std::vector<char>(static_cast<std::size_t>(SCIPgetNVars(scip)), false);
+	for (auto* const var : model.pseudo_branch_cands()) {
+		is_candidate[static_cast<std::size_t>(SCIPvarGetProbindex(var))] = true;
+	}
 
 	/** Compute the inverse of a number or 1 if the number is zero. */
 	auto safe_inv = [](auto const x) { return x != 0. ? 1. / x : 1.; };
 
-	xt::xtensor<value_type, 2> weights{{lp_rows.size(), 4}, std::nan("")};
+	snapshot.rows.clear();
+	snapshot.rows.reserve(lp_rows.size());
+	weights.resize({lp_rows.size(), 4});
+	weights.fill(std::nan(""));
 	auto* weights_iter = weights.begin();
 
 	for (auto* const row : lp_rows) {
-		if (row_is_active(scip, row)) {
-			auto const row_cols_vals = scip::get_vals(row);
+		auto const is_active = row_is_active(scip, row);
+		// A single pass over the coefficients computes the sums of the snapshot and of the weights
+		auto positive_sum = SCIP_Real{0.};
+		auto negative_sum = SCIP_Real{0.};
+		auto abs_sum = value_type{0.};
+		auto candidates_abs_sum = value_type{0.};
+		for (auto const [col, val] : views::zip(scip::get_cols(row), scip::get_vals(row))) {
+			if (val > 0) {
+				positive_sum += val;
+			} else {
+				negative_sum += val;
+			}
+			if (is_active) {
+				abs_sum += std::abs(val);
+				if (is_candidate[static_cast<std::size_t>(SCIPcolGetVarProbindex(col))]) {
+					candidates_abs_sum += std::abs(val);
+				}
+			}
+		}
+		snapshot.rows.push_back(make_row_snapshot(scip, row, is_active, positive_sum, negative_sum));
+		if (is_active) {
 			*(weights_iter++) = 1.;
-			*(weights_iter++) = safe_inv(sum_abs(row_cols_vals));
-			*(weights_iter++) = safe_inv(sum_abs_if_candidate(scip::get_cols(row), row_cols_vals));
+			*(weights_iter++) = safe_inv(abs_sum);
+			*(weights_iter++) = safe_inv(candidates_abs_sum);
 			*(weights_iter++) = std::abs(SCIProwGetDualsol(row));
 		} else {
 			weights_iter += 4;
@@ -416,8 +491,67 @@ auto stats_for_active_constraint_coefficients_weights(scip::Model& model) {
 
 	// Make sure we iterated over as many element as there are in the tensor
 	assert(weights_iter == weights.cend());
+}
 
-	return weights;
+/**
+ * Read the SCIP data needed for the dynamic features of the candidates.
+ *
+ * Must be called after @ref take_lp_rows_snapshot.
+ * Rows in the LP are found from their LP position, while the other rows are read once even if shared by multiple
+ * candidates.
+ */
+void take_snapshot(Snapshot& snapshot, SCIP* const scip, nonstd::span<SCIP_VAR*> const branch_cands) {
+	snapshot.candidates.clear();
+	snapshot.candidates_rows.clear();
+	snapshot.candidates_coefficients.clear();
+
+	auto non_lp_row_indices = std::unordered_map<SCIP_ROW const*, std::size_t>{};
+	auto candidates_offsets = std::vector<std::size_t>{};
+	candidates_offsets.reserve(branch_cands.size() + 1);
+	candidates_offsets.push_back(0);
+	for (auto* const var : branch_cands) {
+		auto* const col = SCIPvarGetCol(var);
+		auto const solval = SCIPcolGetPrimsol(col);
+		snapshot.candidates.push_back({
+			SCIPfeasFrac(scip, solval),
+			SCIPgetVarPseudocost(scip, var, SCIP_BRANCHDIR_UPWARDS),
+			SCIPgetVarPseudocost(scip, var, SCIP_BRANCHDIR_DOWNWARDS),
+			SCIPvarGetCutoffSum(var, SCIP_BRANCHDIR_UPWARDS),
+			SCIPvarGetCutoffSum(var, SCIP_BRANCHDIR_DOWNWARDS),
+			static_cast<value_type>(SCIPvarGetNBranchings(var, SCIP_BRANCHDIR_UPWARDS)),
+			static_cast<value_type>(SCIPvarGetNBranchings(var, SCIP_BRANCHDIR_DOWNWARDS)),
+			{},
+			{},
+		});
+
+		for (auto* const row : scip::get_rows(col)) {
+			auto const lp_pos = SCIProwGetLPPos(row);
+			if (lp_pos >= 0) {
+				snapshot.candidates_rows.push_back(static_cast<std::size_t>(lp_pos));
+			} else {
+				auto const [iter, inserted] = non_lp_row_indices.try_emplace(row, snapshot.rows.size());
+				if (inserted) {
+					// Rows not in the LP are never active
+					auto const [positive_sum, negative_sum] = sum_positive_negative(scip::get_vals(row));
+					snapshot.rows.push_back(make_row_snapshot(scip, row, false, positive_sum, negative_sum));
+				}
+				snapshot.candidates_rows.push_back(iter->second);
+			}
+		}
+		auto const coefficients = scip::get_vals(col);
+		snapshot.candidates_coefficients.insert(
+			snapshot.candidates_coefficients.end(), coefficients.begin(), coefficients.end());
+		candidates_offsets.push_back(snapshot.candidates_rows.size());
+	}
+
+	// Views are set once the storage does not grow anymore
+	for (std::size_t cand_idx = 0; cand_idx < snapshot.candidates.size(); ++cand_idx) {
+		auto const offset = candidates_offsets[cand_idx];
+		auto const size = candidates_offsets[cand_idx + 1] - offset;
+		auto& cand = snapshot.candidates[cand_idx];
+		cand.rows = decltype(cand.rows){snapshot.candidates_rows.data() + offset, size};
+		cand.coefficients = decltype(cand.coefficients){snapshot.candidates_coefficients.data() + offset, size};
+	}
 }
 
 /**
@@ -434,9 +568,8 @@ auto stats_for_active_constraint_coefficients_weights(scip::Model& model) {
 template <typename Tensor>
 void set_stats_for_active_constraint_coefficients(
 	Tensor&& out,
-	SCIP* const scip,
-	nonstd::span<SCIP_ROW*> const rows,
-	nonstd::span<SCIP_Real> const coefficients,
+	std::vector<RowSnapshot> const& rows,
+	CandidateSnapshot const& cand,
 	xt::xtensor<value_type, 2> const& lp_rows_weights) noexcept {
 
 	auto weights_stats = std::array<utility::StatsFeatures<value_type>, 4>{};
@@ -446,10 +579,11 @@ void set_stats_for_active_constraint_coefficients(
 	}
 
 	std::size_t n_active_rows = 0UL;
-	for (auto const [row, coef] : views::zip(rows, coefficients)) {
-		auto const row_lp_idx = SCIProwGetLPPos(row);
+	for (auto const [row_idx, coef] : views::zip(cand.rows, cand.coefficients)) {
+		auto const& row = rows[row_idx];
+		auto const row_lp_idx = row.lp_pos;
 
-		if (row_is_active(scip, row)) {
+		if (row.is_active) {
 			n_active_rows++;
 
 			assert(row_lp_idx >= 0);
@@ -473,9 +607,10 @@ void set_stats_for_active_constraint_coefficients(
 			stats.mean = stats.sum / static_cast<value_type>(n_active_rows);
 		}
 
-		for (auto const [row, coef] : views::zip(rows, coefficients)) {
-			auto const row_lp_idx = SCIProwGetLPPos(row);
-			if (row_is_active(scip, row)) {
+		for (auto const [row_idx, coef] : views::zip(cand.rows, cand.coefficients)) {
+			auto const& row = rows[row_idx];
+			auto const row_lp_idx = row.lp_pos;
+			if (row.is_active) {
 				for (std::size_t weight_idx = 0; weight_idx < weights_stats.size(); ++weight_idx) {
 					auto const weight = lp_rows_weights(row_lp_idx, weight_idx);
 					assert(!std::isnan(weight));  // If NaN likely hit a maked value
@@ -526,25 +661,20 @@ void set_stats_for_active_constraint_coefficients(
 /**
  * Extract the dynamic features for a single branching candidate variable.
  *
- * The precomputed static features given as input parameters are wrapped in their strong type to
- * avoid passing the wrong ones.
+ * Only the snapshot is read, so that the features of different candidates can be computed in parallel.
  */
 template <typename Tensor>
 void set_dynamic_features(
 	Tensor&& out,
-	SCIP* const scip,
-	SCIP_VAR* const var,
-	xt::xtensor<value_type, 2> const& lp_rows_weights) {
-	auto* const col = SCIPvarGetCol(var);
-	auto const rows = scip::get_rows(col);
-	auto const coefficients = scip::get_vals(col);
-
-	set_slack_ceil_and_pseudocosts(out, scip, var, col);
-	set_infeasibility_statistics(out, var);
-	set_dynamic_stats_for_constraint_degree(out, rows);
-	set_min_max_for_ratios_constraint_coeffs_rhs(out, scip, rows, coefficients);
-	set_min_max_for_one_to_all_coefficient_ratios(out, rows, coefficients);
-	set_stats_for_active_constraint_coefficients(out, scip, rows, coefficients, lp_rows_weights);
+	Snapshot const& snapshot,
+	CandidateSnapshot const& cand,
+	xt::xtensor<value_type, 2> const& lp_rows_weights) noexcept {
+	set_slack_ceil_and_pseudocosts(out, cand);
+	set_infeasibility_statistics(out, cand);
+	set_dynamic_stats_for_constraint_degree(out, snapshot.rows, cand);
+	set_min_max_for_ratios_constraint_coeffs_rhs(out, snapshot.rows, cand);
+	set_min_max_for_one_to_all_coefficient_ratios(out, snapshot.rows, cand);
+	set_stats_for_active_constraint_coefficients(out, snapshot.rows, cand, lp_rows_weights);
 }
 
 /**
@@ -563,22 +693,46 @@ void set_precomputed_static_features(TensorOut&& var_features, TensorIn const& v
  *  Main extraction function  *
  ******************************/
 
-auto extract_all_features(scip::Model& model, bool pseudo, xt::xtensor<value_type, 2> const& static_features) {
+void set_all_features(
+	Khalil2016Obs& observation,
+	xt::xtensor<value_type, 2>& lp_rows_weights,
+	Snapshot& snapshot,
+	scip::Model& model,
+	bool pseudo,
+	bool compact,
+	xt::xtensor<value_type, 2> const& static_features,
+	utility::ThreadPool* pool,
+	std::size_t n_threads) {
 	auto const branch_cands = pseudo ? model.pseudo_branch_cands() : model.lp_branch_cands();
-	auto observation = xt::xtensor<value_type, 2>{{model.variables().size(), Khalil2016Obs::n_features}, std::nan("")};
+	auto const n_cands = branch_cands.size();
+	auto const n_rows = compact ? n_cands : model.variables().size();
+	observation.features.resize({n_rows, Khalil2016Obs::n_features});
+	observation.features.fill(std::nan(""));
+	observation.candidates.resize({n_cands});
 
 	auto* const scip = model.get_scip_ptr();
-	auto const lp_rows_weights = stats_for_active_constraint_coefficients_weights(model);
+	take_lp_rows_snapshot(snapshot, lp_rows_weights, model);
+	take_snapshot(snapshot, scip, branch_cands);
+	for (std::size_t cand_idx = 0; cand_idx < n_cands; ++cand_idx) {
+		observation.candidates[cand_idx] = static_cast<std::size_t>(SCIPvarGetProbindex(branch_cands[cand_idx]));
+	}
 
-	for (auto* var : branch_cands) {
-		auto const var_idx = SCIPvarGetProbindex(var);
-		auto var_features = xt::row(observation, var_idx);
-		auto var_static_features = xt::row(static_features, var_idx);
+	// Every candidate writes its own row, and only reads the snapshot, so they can be run in parallel
+	auto const set_candidate_features = [&](std::size_t cand_idx) {
+		auto const var_idx = observation.candidates[cand_idx];
+		auto const row_idx = compact ? cand_idx : var_idx;
+		auto var_features = xt::row(observation.features, static_cast<std::ptrdiff_t>(row_idx));
+		auto var_static_features = xt::row(static_features, static_cast<std::ptrdiff_t>(var_idx));
 		set_precomputed_static_features(var_features, var_static_features);
-		set_dynamic_features(var_features, scip, var, lp_rows_weights);
+		set_dynamic_features(var_features, snapshot, snapshot.candidates[cand_idx], lp_rows_weights);
+	};
+	if (pool != nullptr) {
+		utility::parallel_for(*pool, n_threads, n_cands, set_candidate_features);
+	} else {
+		for (std::size_t cand_idx = 0; cand_idx < n_cands; ++cand_idx) {
+			set_candidate_features(cand_idx);
+		}
 	}
-
-	return observation;
 }
 
 auto is_on_root_node(scip::Model& model) -> bool {
@@ -592,20 +746,44 @@ auto is_on_root_node(scip::Model& model) -> bool {
  *  Observation extracting function  *
  *************************************/
 
-Khalil2016::Khalil2016(bool pseudo_candidates_) noexcept : pseudo_candidates(pseudo_candidates_) {}
+Khalil2016::Khalil2016(bool pseudo_candidates_, bool compact_, std::size_t n_threads_) :
+	pseudo_candidates(pseudo_candidates_), compact(compact_), n_threads(std::max<std::size_t>(n_threads_, 1)) {
+	if (n_threads > 1) {
+		thread_pool = std::make_shared<utility::ThreadPool>(n_threads - 1);
+	}
+}
 
 void Khalil2016::before_reset(scip::Model& /* model */) {
 	static_features = decltype(static_features){};
 }
 
-auto Khalil2016::extract(scip::Model& model, bool /* done */) -> std::optional<Khalil2016Obs> {
-	if (model.stage() == SCIP_STAGE_SOLVING) {
-		if (is_on_root_node(model)) {
-			static_features = extract_static_features(model);
-		}
-		return {{extract_all_features(model, pseudo_candidates, static_features)}};
+auto Khalil2016::extract(scip::Model& model, bool done) -> std::optional<Khalil2016Obs> {
+	auto obs = Khalil2016Obs{};
+	if (extract_into(model, done, obs)) {
+		return obs;
 	}
 	return {};
 }
 
+auto Khalil2016::extract_into(scip::Model& model, bool /* done */, Khalil2016Obs& obs) -> bool {
+	if (model.stage() != SCIP_STAGE_SOLVING) {
+		return false;
+	}
+	if (is_on_root_node(model)) {
+		static_features = extract_static_features(model);
+	}
+	auto snapshot = Snapshot{};
+	set_all_features(
+		obs,
+		lp_rows_weights,
+		snapshot,
+		model,
+		pseudo_candidates,
+		compact,
+		static_features,
+		thread_pool.get(),
+		n_threads);
+	return true;
+}
+
 }  // namespace ecole::observation
@@ -2,9 +2,13 @@
 
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <utility>
+
 #include <scip/scip.h>
 #include <scip/struct_lp.h>
 #include <xtensor/xadapt.hpp>
+#include <xtensor/xmath.hpp>
 #include <xtensor/xnorm.hpp>
 #include <xtensor/xview.hpp>
 
@@ -22,12 +26,11 @@ namespace {
  *  Common helpers   *
  *********************/
 
-using xmatrix = decltype(MilpBipartiteObs::variable_features);
-using value_type = xmatrix::value_type;
-using coo_xmatrix = utility::coo_matrix<value_type>;
+/** Type used to compute the features, before they are stored in the type of the observation. */
+using value_type = SCIP_Real;
 
-using VariableFeatures = MilpBipartiteObs::VariableFeatures;
-using ConstraintFeatures = MilpBipartiteObs::ConstraintFeatures;
+using VariableFeatures = MilpBipartiteFeatures::VariableFeatures;
+using ConstraintFeatures = MilpBipartiteFeatures::ConstraintFeatures;
 
 /******************************************
  *  Variable extraction functions         *
@@ -109,7 +112,7 @@ void set_static_features_for_var(
 	}
 }
 
-void set_features_for_all_vars(xmatrix& out, scip::Model& model, bool normalize) {
+template <typename Matrix> void set_features_for_all_vars(Matrix& out, scip::Model& model, bool normalize) {
 	auto* const scip = model.get_scip_ptr();
 
 	// Contant reused in every iterations
@@ -128,26 +131,69 @@ template <typename T> auto vec_to_col(xt::xtensor<T, 1>&& t) -> xt::xtensor<T, 2
 	return xt::xtensor<T, 2>{std::move(t.storage()), {t.size(), 1}, {1, 0}};
 }
 
+/** Convert a tensor to the type of the observation, without copy if it is already of that type. */
+template <typename T, typename Tensor> auto cast_to(Tensor&& t) {
+	using Target = xt::xtensor<T, xt::get_rank<std::decay_t<Tensor>>::value>;
+	if constexpr (std::is_same_v<std::decay_t<Tensor>, Target>) {
+		return std::forward<Tensor>(t);
+	} else {
+		return Target(xt::cast<T>(t));
+	}
+}
+
+/** Convert the constraint matrix to the types and sparse format of the observation. */
+template <typename Value, typename Index>
+auto convert_edges(utility::coo_matrix<SCIP_Real>&& edges, utility::coo_matrix<Value, Index>& /*tag*/) {
+	utility::check_index_range<Index>(edges.shape, edges.nnz());
+	return utility::coo_matrix<Value, Index>{
+		cast_to<Value>(std::move(edges.values)),
+		cast_to<Index>(std::move(edges.indices)),
+		edges.shape,
+	};
+}
+
+template <typename Value, typename Index>
+auto convert_edges(utility::coo_matrix<SCIP_Real>&& edges, utility::csr_matrix<Value, Index>& /*tag*/) {
+	utility::check_index_range<Index>(edges.shape, edges.nnz());
+	// Constraints are produced row by row, the conversion only compresses the row indices
+	auto csr = utility::to_csr(edges);
+	return utility::csr_matrix<Value, Index>{
+		cast_to<Value>(std::move(csr.values)),
+		cast_to<Index>(std::move(csr.column_indices)),
+		cast_to<Index>(std::move(csr.row_pointers)),
+		csr.shape,
+	};
+}
+
 }  // namespace
 
 /*************************************
  *  Observation extracting function  *
  *************************************/
 
-auto MilpBipartite::extract(scip::Model& model, bool /* done */) const -> std::optional<MilpBipartiteObs> {
+template <typename Value, typename Index, template <typename, typename> typename SparseMatrix>
+auto BasicMilpBipartite<Value, Index, SparseMatrix>::extract(scip::Model& model, bool /* done */) const
+	-> std::optional<Observation> {
 	if (model.stage() < SCIP_STAGE_SOLVING) {
+		// Constraints are read in double precision, and only converted if the observation uses other types
 		auto [edge_features, constraint_features] = scip::get_all_constraints(model.get_scip_ptr(), normalize);
 
-		auto variable_features = xmatrix::from_shape({model.variables().size(), MilpBipartiteObs::n_variable_features});
-		set_features_for_all_vars(variable_features, model, normalize);
-
-		return MilpBipartiteObs{
-			std::move(variable_features),
-			vec_to_col(std::move(constraint_features)),
-			std::move(edge_features),
-		};
+		auto obs = Observation{};
+		obs.variable_features =
+			decltype(obs.variable_features)::from_shape({model.variables().size(), Observation::n_variable_features});
+		set_features_for_all_vars(obs.variable_features, model, normalize);
+		obs.constraint_features = vec_to_col(cast_to<Value>(std::move(constraint_features)));
+		obs.edge_features = convert_edges(std::move(edge_features), obs.edge_features);
+		return obs;
 	}
 	return {};
 }
 
+template class BasicMilpBipartite<double, std::size_t>;
+template class BasicMilpBipartite<double, std::int32_t>;
+template class BasicMilpBipartite<float, std::size_t>;
+template class BasicMilpBipartite<float, std::int32_t>;
+template class BasicMilpBipartite<double, std::int64_t, utility::csr_matrix>;
+template class BasicMilpBipartite<float, std::int32_t, utility::csr_matrix>;
+
 }  // namespace ecole::observation
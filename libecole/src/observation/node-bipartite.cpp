@@ -1,9 +1,19 @@
+#include <algorithm>
 #include <array>
+#include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include <objscip/objeventhdlr.h>
 #include <scip/scip.h>
 #include <scip/struct_lp.h>
 #include <xtensor/xview.hpp>
@@ -11,6 +21,7 @@
 #include "ecole/observation/node-bipartite.hpp"
 #include "ecole/scip/model.hpp"
 #include "ecole/scip/row.hpp"
+#include "ecole/scip/utils.hpp"
 #include "ecole/utility/unreachable.hpp"
 
 namespace ecole::observation {
@@ -21,11 +32,11 @@ namespace {
  *  Common helpers   *
  *********************/
 
-using xmatrix = decltype(NodeBipartiteObs::variable_features);
-using value_type = xmatrix::value_type;
+/** Type used to compute the features, before they are stored in the type of the observation. */
+using value_type = SCIP_Real;
 
-using VariableFeatures = NodeBipartiteObs::VariableFeatures;
-using RowFeatures = NodeBipartiteObs::RowFeatures;
+using VariableFeatures = NodeBipartiteFeatures::VariableFeatures;
+using RowFeatures = NodeBipartiteFeatures::RowFeatures;
 
 value_type constexpr cste = 5.;
 value_type constexpr nan = std::numeric_limits<value_type>::quiet_NaN();
@@ -124,6 +135,26 @@ void set_static_features_for_var(Features&& out, SCIP_VAR* const var, value_type
 	}
 }
 
+/**
+ * Set the dynamic features of a variable that change with the solver state rather than with its column.
+ *
+ * @param update_incumbent Whether to also update the features derived from the solutions found.
+ */
+template <typename Features>
+void set_global_dynamic_features_for_var(
+	Features&& out,
+	SCIP* const scip,
+	SCIP_VAR* const var,
+	SCIP_COL* const col,
+	value_type n_lps,
+	bool update_incumbent) {
+	out[idx(VariableFeatures::scaled_age)] = static_cast<value_type>(SCIPcolGetAge(col)) / (n_lps + cste);
+	if (update_incumbent) {
+		out[idx(VariableFeatures::incumbent_value)] = best_sol_val(scip, var).value_or(nan);
+		out[idx(VariableFeatures::average_incumbent_value)] = avg_sol(scip, var).value_or(nan);
+	}
+}
+
 template <typename Features>
 void set_dynamic_features_for_var(
 	Features&& out,
@@ -139,9 +170,7 @@ void set_dynamic_features_for_var(
 	out[idx(VariableFeatures::solution_frac)] = feas_frac(scip, var).value_or(0.);
 	out[idx(VariableFeatures::is_solution_at_lower_bound)] = static_cast<value_type>(is_prim_sol_at_lb(scip, col));
 	out[idx(VariableFeatures::is_solution_at_upper_bound)] = static_cast<value_type>(is_prim_sol_at_ub(scip, col));
-	out[idx(VariableFeatures::scaled_age)] = static_cast<value_type>(SCIPcolGetAge(col)) / (n_lps + cste);
-	out[idx(VariableFeatures::incumbent_value)] = best_sol_val(scip, var).value_or(nan);
-	out[idx(VariableFeatures::average_incumbent_value)] = avg_sol(scip, var).value_or(nan);
+	set_global_dynamic_features_for_var(out, scip, var, col, n_lps, true);
 	// On-hot encoding
 	out[idx(VariableFeatures::is_basis_lower)] = 0.;
 	out[idx(VariableFeatures::is_basis_basic)] = 0.;
@@ -165,7 +194,7 @@ void set_dynamic_features_for_var(
 	}
 }
 
-void set_features_for_all_vars(xmatrix& out, scip::Model& model, bool const update_static) {
+template <typename Matrix> void set_features_for_all_vars(Matrix& out, scip::Model& model, bool const update_static) {
 	auto* const scip = model.get_scip_ptr();
 
 	// Contant reused in every iterations
@@ -255,7 +284,7 @@ void set_dynamic_features_for_rhs_row(
 	out[idx(RowFeatures::scaled_age)] = static_cast<value_type>(SCIProwGetAge(row)) / (n_lps + cste);
 }
 
-auto set_features_for_all_rows(xmatrix& out, scip::Model& model, bool const update_static) {
+template <typename Matrix> auto set_features_for_all_rows(Matrix& out, scip::Model& model, bool const update_static) {
 	auto* const scip = model.get_scip_ptr();
 
 	auto const n_lps = static_cast<value_type>(SCIPgetNLPs(scip));
@@ -310,45 +339,100 @@ auto matrix_nnz(scip::Model& model) {
 	return nnz;
 }
 
-utility::coo_matrix<value_type> extract_edge_features(scip::Model& model) {
+/** Write one edge in a coordinate matrix. */
+template <typename T, typename I>
+void set_edge(
+	utility::coo_matrix<T, I>& edges,
+	std::size_t edge_idx,
+	std::size_t row_idx,
+	int col_idx,
+	value_type value) {
+	edges.indices(0, edge_idx) = static_cast<I>(row_idx);
+	edges.indices(1, edge_idx) = static_cast<I>(col_idx);
+	edges.values[edge_idx] = static_cast<T>(value);
+}
+
+/** Write one edge in a compressed sparse row matrix, the row is given by the row pointers. */
+template <typename T, typename I>
+void set_edge(
+	utility::csr_matrix<T, I>& edges,
+	std::size_t edge_idx,
+	std::size_t /*row_idx*/,
+	int col_idx,
+	value_type value) {
+	edges.column_indices[edge_idx] = static_cast<I>(col_idx);
+	edges.values[edge_idx] = static_cast<T>(value);
+}
+
+/** Mark where a row ends, which is only stored in compressed sparse row matrices. */
+template <typename T, typename I>
+void set_row_end(utility::coo_matrix<T, I>& /*edges*/, std::size_t /*row_idx*/, std::size_t /*edge_end*/) {}
+
+template <typename T, typename I>
+void set_row_end(utility::csr_matrix<T, I>& edges, std::size_t row_idx, std::size_t edge_end) {
+	edges.row_pointers[row_idx + 1] = static_cast<I>(edge_end);
+}
+
+/** Change the shape of a sparse matrix, reallocating only if its shape changed, values are left uninitialized. */
+template <typename T, typename I>
+void resize_edges(utility::coo_matrix<T, I>& edges, std::size_t /*n_rows*/, std::size_t nnz) {
+	edges.values.resize({nnz});
+	edges.indices.resize({2, nnz});
+}
+
+template <typename T, typename I>
+void resize_edges(utility::csr_matrix<T, I>& edges, std::size_t n_rows, std::size_t nnz) {
+	edges.values.resize({nnz});
+	edges.column_indices.resize({nnz});
+	edges.row_pointers.resize({n_rows + 1});
+	edges.row_pointers[0] = 0;
+}
+
+/**
+ * Write the edges of one side of an LP row, starting at the given edge position.
+ *
+ * @param sign Sign applied to the coefficients, negative for the left hand side.
+ * @return The number of edges written.
+ */
+template <typename SparseMatrix>
+auto set_edges_for_row(
+	SparseMatrix& edges,
+	std::size_t edge_idx,
+	std::size_t feature_row_idx,
+	SCIP_ROW* const row,
+	value_type sign) -> std::size_t {
+	auto const row_norm = static_cast<value_type>(row_l2_norm(row));
+	auto* const row_cols = SCIProwGetCols(row);
+	auto const* const row_vals = SCIProwGetVals(row);
+	auto const row_nnz = static_cast<std::size_t>(SCIProwGetNLPNonz(row));
+	for (std::size_t k = 0; k < row_nnz; ++k) {
+		set_edge(edges, edge_idx + k, feature_row_idx, SCIPcolGetVarProbindex(row_cols[k]), sign * row_vals[k] / row_norm);
+	}
+	set_row_end(edges, feature_row_idx, edge_idx + row_nnz);
+	return row_nnz;
+}
+
+/** Write the edges of all LP rows, reallocating the matrix only if its shape changed. */
+template <typename SparseMatrix> void set_edge_features(SparseMatrix& edges, scip::Model& model) {
 	auto* const scip = model.get_scip_ptr();
 
-	using coo_matrix = utility::coo_matrix<value_type>;
+	edges.shape = {n_ineq_rows(model), static_cast<std::size_t>(SCIPgetNVars(scip))};
 	auto const nnz = matrix_nnz(model);
-	auto values = decltype(coo_matrix::values)::from_shape({nnz});
-	auto indices = decltype(coo_matrix::indices)::from_shape({2, nnz});
+	utility::check_index_range<typename SparseMatrix::index_type>(edges.shape, nnz);
+	resize_edges(edges, edges.shape[0], nnz);
 
 	std::size_t i = 0;
 	std::size_t j = 0;
 	for (auto* const row : model.lp_rows()) {
-		auto const row_norm = static_cast<value_type>(row_l2_norm(row));
-		auto* const row_cols = SCIProwGetCols(row);
-		auto const* const row_vals = SCIProwGetVals(row);
-		auto const row_nnz = static_cast<std::size_t>(SCIProwGetNLPNonz(row));
 		if (scip::get_unshifted_lhs(scip, row).has_value()) {
-			for (std::size_t k = 0; k < row_nnz; ++k) {
-				indices(0, j + k) = i;
-				indices(1, j + k) = static_cast<std::size_t>(SCIPcolGetVarProbindex(row_cols[k]));
-				values[j + k] = -row_vals[k] / row_norm;
-			}
-			j += row_nnz;
+			j += set_edges_for_row(edges, j, i, row, -1.);
 			i++;
 		}
 		if (scip::get_unshifted_rhs(scip, row).has_value()) {
-			for (std::size_t k = 0; k < row_nnz; ++k) {
-				indices(0, j + k) = i;
-				indices(1, j + k) = static_cast<std::size_t>(SCIPcolGetVarProbindex(row_cols[k]));
-				values[j + k] = row_vals[k] / row_norm;
-			}
-			j += row_nnz;
+			j += set_edges_for_row(edges, j, i, row, 1.);
 			i++;
 		}
 	}
-
-	auto const n_rows = n_ineq_rows(model);
-	// Change this here for variables
-	auto const n_vars = static_cast<std::size_t>(SCIPgetNVars(scip));
-	return {values, indices, {n_rows, n_vars}};
 }
 
 auto is_on_root_node(scip::Model& model) -> bool {
@@ -356,22 +440,199 @@ auto is_on_root_node(scip::Model& model) -> bool {
 	return SCIPgetCurrentNode(scip) == SCIPgetRootNode(scip);
 }
 
-auto extract_observation_fully(scip::Model& model) -> NodeBipartiteObs {
-	auto obs = NodeBipartiteObs{
-		// Change this here for variables
-		xmatrix::from_shape({model.variables().size(), NodeBipartiteObs::n_variable_features}),
-		xmatrix::from_shape({n_ineq_rows(model), NodeBipartiteObs::n_row_features}),
-		extract_edge_features(model),
-	};
+/** Extract the observation in place, tensors are only reallocated if their shape changed. */
+template <typename Observation> void extract_observation_fully(scip::Model& model, Observation& obs) {
+	// Change this here for variables
+	obs.variable_features.resize({model.variables().size(), NodeBipartiteFeatures::n_variable_features});
+	obs.row_features.resize({n_ineq_rows(model), NodeBipartiteFeatures::n_row_features});
+	set_edge_features(obs.edge_features, model);
 	set_features_for_all_vars(obs.variable_features, model, true);
 	set_features_for_all_rows(obs.row_features, model, true);
-	return obs;
 }
 
-auto extract_observation_from_cache(scip::Model& model, NodeBipartiteObs obs) -> NodeBipartiteObs {
+template <typename Observation>
+void extract_observation_from_cache(scip::Model& model, Observation const& cache, Observation& obs) {
+	// Copy assignment reuses the memory of the output when the shapes are the same
+	obs = cache;
 	set_features_for_all_vars(obs.variable_features, model, false);
 	set_features_for_all_rows(obs.row_features, model, false);
-	return obs;
+}
+
+/*******************************************
+ *  Incremental extraction of the LP rows  *
+ *******************************************/
+
+/**
+ * Event handler recording the LP rows that changed since the previous observation.
+ *
+ * Rows deleted from the LP are reported by global events, while modifications of a row (coefficients, constant, and
+ * sides) are reported by row events, caught for as long as the row is in the LP.
+ * Added rows need not be recorded because they are always appended at the end of the LP.
+ * Columns entering or leaving the LP change the LP nonzeros of rows without any row event, hence are detected by the
+ * observation function itself.
+ */
+class RowEventHandler : public ::scip::ObjEventhdlr {
+public:
+	inline static auto constexpr base_name = "ecole::observation::RowEventHandler";
+	inline static auto row_event_handler_counter = 0;
+
+	RowEventHandler(SCIP* scip, char const* name) :
+		ObjEventhdlr{scip, name, "Event handler for changes of the LP rows"} {}
+
+	/** Catch LP rows events. */
+	SCIP_RETCODE scip_init(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) override;
+	/** Drop LP rows events. */
+	SCIP_RETCODE scip_exit(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) override;
+	/** Record the row that changed. */
+	SCIP_RETCODE scip_exec(SCIP* scip, SCIP_EVENTHDLR* eventhdlr, SCIP_EVENT* event, SCIP_EVENTDATA* eventdata) override;
+
+	/** SCIP indices of the rows deleted or modified since the last call to clear_changes. */
+	[[nodiscard]] auto get_changed_rows() const noexcept -> std::vector<int> const& { return changed_rows; }
+	auto clear_changes() noexcept -> void { changed_rows.clear(); }
+
+private:
+	static auto constexpr lp_events = SCIP_EVENTTYPE_ROWADDEDLP | SCIP_EVENTTYPE_ROWDELETEDLP;
+	static auto constexpr row_events =
+		SCIP_EVENTTYPE_ROWCOEFCHANGED | SCIP_EVENTTYPE_ROWCONSTCHANGED | SCIP_EVENTTYPE_ROWSIDECHANGED;
+
+	/** Position of the row events filter of every row in the LP, by SCIP row index. */
+	std::unordered_map<int, int> filter_positions;
+	std::vector<int> changed_rows;
+};
+
+auto RowEventHandler::scip_init(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) -> SCIP_RETCODE {
+	return SCIPcatchEvent(scip, lp_events, eventhdlr, nullptr, nullptr);
+}
+
+auto RowEventHandler::scip_exit(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) -> SCIP_RETCODE {
+	filter_positions.clear();
+	clear_changes();
+	return SCIPdropEvent(scip, lp_events, eventhdlr, nullptr, -1);
+}
+
+auto RowEventHandler::scip_exec(
+	SCIP* scip,
+	SCIP_EVENTHDLR* eventhdlr,
+	SCIP_EVENT* event,
+	SCIP_EVENTDATA* /*eventdata*/) -> SCIP_RETCODE {
+	auto* const row = SCIPeventGetRow(event);
+	auto const row_index = SCIProwGetIndex(row);
+	auto const event_type = SCIPeventGetType(event);
+	if (event_type == SCIP_EVENTTYPE_ROWADDEDLP) {
+		auto filter_pos = -1;
+		SCIP_CALL(SCIPcatchRowEvent(scip, row, row_events, eventhdlr, nullptr, &filter_pos));
+		filter_positions[row_index] = filter_pos;
+	} else if (event_type == SCIP_EVENTTYPE_ROWDELETEDLP) {
+		auto const iter = filter_positions.find(row_index);
+		// Rows are only dropped while solving, afterwards the LP is being freed.
+		if ((iter != filter_positions.end()) && (SCIPgetStage(scip) == SCIP_STAGE_SOLVING)) {
+			SCIP_CALL(SCIPdropRowEvent(scip, row, row_events, eventhdlr, nullptr, iter->second));
+		}
+		if (iter != filter_positions.end()) {
+			filter_positions.erase(iter);
+		}
+		changed_rows.push_back(row_index);
+	} else {
+		changed_rows.push_back(row_index);
+	}
+	return SCIP_OKAY;
+}
+
+auto get_row_event_handler(scip::Model& model, std::string const& name) -> RowEventHandler& {
+	auto* const base_handler = SCIPfindObjEventhdlr(model.get_scip_ptr(), name.c_str());
+	assert(base_handler != nullptr);
+	auto* const handler = dynamic_cast<RowEventHandler*>(base_handler);
+	assert(handler != nullptr);
+	return *handler;
+}
+
+/** Create a unique name for every observation function using the event handler. */
+auto make_row_event_handler_name() -> std::string {
+	static auto m = std::mutex{};
+	auto g = std::lock_guard{m};
+	auto name = RowEventHandler::base_name + std::to_string(RowEventHandler::row_event_handler_counter);
+	RowEventHandler::row_event_handler_counter++;
+	return name;
+}
+
+void add_row_event_handler(scip::Model& model, std::string const& name) {
+	auto handler = std::make_unique<RowEventHandler>(model.get_scip_ptr(), name.c_str());
+	scip::call(SCIPincludeObjEventhdlr, model.get_scip_ptr(), handler.get(), true);
+	// NOLINTNEXTLINE memory ownership is passed to SCIP
+	handler.release();
+}
+
+/** Update the SCIP indices of the LP columns, and return whether they changed. */
+auto update_lp_column_indices(std::vector<int>& indices, scip::Model& model) -> bool {
+	auto const lp_columns = model.lp_columns();
+	auto const same_columns = std::equal(
+		indices.begin(), indices.end(), lp_columns.begin(), lp_columns.end(), [](auto const index, auto* const col) {
+			return index == SCIPcolGetIndex(col);
+		});
+	if (!same_columns) {
+		indices.resize(lp_columns.size());
+		std::transform(
+			lp_columns.begin(), lp_columns.end(), indices.begin(), [](auto* const col) { return SCIPcolGetIndex(col); });
+	}
+	return !same_columns;
+}
+
+/** Change the number of rows of a matrix, keeping the first ``n_kept`` rows. */
+template <typename Matrix> void resize_rows(Matrix& matrix, std::size_t n_rows, std::size_t n_kept) {
+	if (matrix.shape()[0] == n_rows) {
+		return;
+	}
+	auto resized = Matrix::from_shape({n_rows, matrix.shape()[1]});
+	auto const kept = xt::range(0, n_kept);
+	xt::view(resized, kept, xt::all()) = xt::view(matrix, kept, xt::all());
+	matrix = std::move(resized);
+}
+
+/** Change the number of non zeros of a sparse matrix, keeping the first ``n_kept`` ones. */
+template <typename T, typename I>
+void resize_nnz(
+	utility::coo_matrix<T, I>& matrix,
+	std::size_t /*n_rows*/,
+	std::size_t nnz,
+	std::size_t /*n_kept_rows*/,
+	std::size_t n_kept) {
+	using coo_matrix = utility::coo_matrix<T, I>;
+	if (matrix.nnz() == nnz) {
+		return;
+	}
+	auto values = decltype(coo_matrix::values)::from_shape({nnz});
+	auto indices = decltype(coo_matrix::indices)::from_shape({2, nnz});
+	auto const kept = xt::range(0, n_kept);
+	xt::view(values, kept) = xt::view(matrix.values, kept);
+	xt::view(indices, xt::all(), kept) = xt::view(matrix.indices, xt::all(), kept);
+	matrix.values = std::move(values);
+	matrix.indices = std::move(indices);
+}
+
+/** Change the number of rows and non zeros of a sparse matrix, keeping the first ``n_kept_rows`` rows. */
+template <typename T, typename I>
+void resize_nnz(
+	utility::csr_matrix<T, I>& matrix,
+	std::size_t n_rows,
+	std::size_t nnz,
+	std::size_t n_kept_rows,
+	std::size_t n_kept) {
+	using csr_matrix = utility::csr_matrix<T, I>;
+	if (matrix.nnz() != nnz) {
+		auto values = decltype(csr_matrix::values)::from_shape({nnz});
+		auto column_indices = decltype(csr_matrix::column_indices)::from_shape({nnz});
+		auto const kept = xt::range(0, n_kept);
+		xt::view(values, kept) = xt::view(matrix.values, kept);
+		xt::view(column_indices, kept) = xt::view(matrix.column_indices, kept);
+		matrix.values = std::move(values);
+		matrix.column_indices = std::move(column_indices);
+	}
+	if (matrix.row_pointers.size() != n_rows + 1) {
+		auto row_pointers = decltype(csr_matrix::row_pointers)::from_shape({n_rows + 1});
+		auto const kept = xt::range(0, n_kept_rows + 1);
+		xt::view(row_pointers, kept) = xt::view(matrix.row_pointers, kept);
+		matrix.row_pointers = std::move(row_pointers);
+	}
 }
 
 }  // namespace
@@ -380,25 +641,255 @@ auto extract_observation_from_cache(scip::Model& model, NodeBipartiteObs obs) ->
  *  Observation extracting function  *
  *************************************/
 
-auto NodeBipartite::before_reset(scip::Model& /* model */) -> void {
+template <typename Value, typename Index, template <typename, typename> typename SparseMatrix>
+BasicNodeBipartite<Value, Index, SparseMatrix>::BasicNodeBipartite(bool cache, bool incremental, bool track_columns) :
+	use_cache{cache}, use_incremental{incremental}, use_column_tracking{track_columns} {
+	if (use_incremental) {
+		event_handler_name = make_row_event_handler_name();
+	}
+}
+
+template <typename Value, typename Index, template <typename, typename> typename SparseMatrix>
+auto BasicNodeBipartite<Value, Index, SparseMatrix>::before_reset(scip::Model& model) -> void {
 	cache_computed = false;
+	column_states.clear();
+	row_duals.clear();
+	n_sols_found = 0;
+	if (use_incremental) {
+		row_slots.clear();
+		lp_column_indices.clear();
+		add_row_event_handler(model, event_handler_name);
+	}
+}
+
+template <typename Value, typename Index, template <typename, typename> typename SparseMatrix>
+auto BasicNodeBipartite<Value, Index, SparseMatrix>::extract_incrementally(scip::Model& model) -> void {
+	auto& handler = get_row_event_handler(model, event_handler_name);
+	auto first_slot = row_slots.size();
+	// The edges of all rows are rebuilt if the LP columns changed, since no row event reports it
+	if (update_lp_column_indices(lp_column_indices, model)) {
+		first_slot = 0;
+	}
+	if (!cache_computed) {
+		first_slot = 0;
+		the_cache.variable_features =
+			decltype(the_cache.variable_features)::from_shape({model.variables().size(), Observation::n_variable_features});
+		update_variable_features(model, true);
+	} else {
+		update_variable_features(model, false);
+		if (!handler.get_changed_rows().empty()) {
+			auto slot_of_row = std::unordered_map<int, std::size_t>{};
+			slot_of_row.reserve(row_slots.size());
+			for (std::size_t slot = 0; slot < row_slots.size(); ++slot) {
+				slot_of_row.emplace(row_slots[slot].lp_row_index, slot);
+			}
+			for (auto const row_index : handler.get_changed_rows()) {
+				if (auto const iter = slot_of_row.find(row_index); iter != slot_of_row.end()) {
+					first_slot = std::min(first_slot, iter->second);
+				}
+			}
+		}
+	}
+	handler.clear_changes();
+
+	// Rows are only appended to the LP, or deleted without reordering the others, so all rows before the first one
+	// that changed are unchanged.
+	if ((first_slot < row_slots.size()) || (row_slots.size() != model.lp_rows().size())) {
+		update_row_slots(model, first_slot);
+	}
+	set_features_for_all_rows(the_cache.row_features, model, false);
+	cache_computed = true;
+}
+
+template <typename Value, typename Index, template <typename, typename> typename SparseMatrix>
+auto BasicNodeBipartite<Value, Index, SparseMatrix>::update_row_slots(scip::Model& model, std::size_t first_slot)
+	-> void {
+	auto* const scip = model.get_scip_ptr();
+	auto const lp_rows = model.lp_rows();
+
+	// Offsets where the first row to update starts
+	auto n_kept_feature_rows = std::size_t{0};
+	auto n_kept_edges = std::size_t{0};
+	if (first_slot < row_slots.size()) {
+		n_kept_feature_rows = row_slots[first_slot].feature_row;
+		n_kept_edges = row_slots[first_slot].edge_offset;
+	} else if (cache_computed) {
+		n_kept_feature_rows = the_cache.row_features.shape()[0];
+		n_kept_edges = the_cache.edge_features.nnz();
+	}
+	row_slots.resize(first_slot);
+
+	// Find the new layout
+	auto n_feature_rows = n_kept_feature_rows;
+	auto n_edges = n_kept_edges;
+	for (auto slot = first_slot; slot < lp_rows.size(); ++slot) {
+		auto* const row = lp_rows[slot];
+		row_slots.push_back({SCIProwGetIndex(row), n_feature_rows, n_edges});
+		auto const has_lhs = scip::get_unshifted_lhs(scip, row).has_value();
+		auto const has_rhs = scip::get_unshifted_rhs(scip, row).has_value();
+		auto const n_sides = static_cast<std::size_t>(has_lhs) + static_cast<std::size_t>(has_rhs);
+		n_feature_rows += n_sides;
+		n_edges += n_sides * static_cast<std::size_t>(SCIProwGetNLPNonz(row));
+	}
+	if (!cache_computed) {
+		the_cache.row_features = decltype(the_cache.row_features)::from_shape({0, Observation::n_row_features});
+		resize_edges(the_cache.edge_features, 0, 0);
+	}
+	auto const edges_shape = std::array{n_feature_rows, model.variables().size()};
+	utility::check_index_range<Index>(edges_shape, n_edges);
+	resize_rows(the_cache.row_features, n_feature_rows, n_kept_feature_rows);
+	resize_nnz(the_cache.edge_features, n_feature_rows, n_edges, n_kept_feature_rows, n_kept_edges);
+	the_cache.edge_features.shape = edges_shape;
+
+	// Fill the rows that changed
+	for (auto slot = first_slot; slot < lp_rows.size(); ++slot) {
+		auto* const row = lp_rows[slot];
+		auto const row_norm = static_cast<value_type>(row_l2_norm(row));
+		auto feature_row = row_slots[slot].feature_row;
+		auto edge_idx = row_slots[slot].edge_offset;
+		if (scip::get_unshifted_lhs(scip, row).has_value()) {
+			auto features = xt::row(the_cache.row_features, static_cast<std::ptrdiff_t>(feature_row));
+			set_static_features_for_lhs_row(features, scip, row, row_norm);
+			edge_idx += set_edges_for_row(the_cache.edge_features, edge_idx, feature_row, row, -1.);
+			feature_row++;
+		}
+		if (scip::get_unshifted_rhs(scip, row).has_value()) {
+			auto features = xt::row(the_cache.row_features, static_cast<std::ptrdiff_t>(feature_row));
+			set_static_features_for_rhs_row(features, scip, row, row_norm);
+			edge_idx += set_edges_for_row(the_cache.edge_features, edge_idx, feature_row, row, 1.);
+			feature_row++;
+		}
+	}
 }
 
-auto NodeBipartite::extract(scip::Model& model, bool /* done */) -> std::optional<NodeBipartiteObs> {
-	if (model.stage() == SCIP_STAGE_SOLVING) {
-		if (use_cache) {
-			if (is_on_root_node(model)) {
-				the_cache = extract_observation_fully(model);
-				cache_computed = true;
-				return the_cache;
+template <typename Value, typename Index, template <typename, typename> typename SparseMatrix>
+auto BasicNodeBipartite<Value, Index, SparseMatrix>::update_variable_features(
+	scip::Model& model,
+	bool update_static) -> void {
+	if (!use_column_tracking) {
+		set_features_for_all_vars(the_cache.variable_features, model, update_static);
+		return;
+	}
+	if (update_static) {
+		// Force all variables to be recomputed
+		column_states.clear();
+	}
+	update_changed_variable_features(model, update_static);
+}
+
+template <typename Value, typename Index, template <typename, typename> typename SparseMatrix>
+auto BasicNodeBipartite<Value, Index, SparseMatrix>::update_changed_variable_features(
+	scip::Model& model,
+	bool update_static) -> void {
+	auto* const scip = model.get_scip_ptr();
+	auto const variables = model.variables();
+	auto const n_vars = variables.size();
+	auto changed = std::vector<char>(n_vars, column_states.size() != n_vars);  // Not vector<bool> for speed
+	column_states.resize(n_vars);
+
+	// Reduced costs only change with the dual values of the rows of the column.
+	// The LP rows are compared by position, and all variables are recomputed if they differ.
+	auto const lp_rows = model.lp_rows();
+	auto const same_rows = std::equal(
+		row_duals.begin(), row_duals.end(), lp_rows.begin(), lp_rows.end(), [](auto const& dual, auto* const row) {
+			return dual.lp_row_index == SCIProwGetIndex(row);
+		});
+	if (!same_rows) {
+		std::fill(changed.begin(), changed.end(), true);
+		row_duals.resize(lp_rows.size());
+	}
+	for (std::size_t row_idx = 0; row_idx < lp_rows.size(); ++row_idx) {
+		auto* const row = lp_rows[row_idx];
+		auto const dual_sol = SCIProwGetDualsol(row);
+		if (same_rows && (dual_sol != row_duals[row_idx].dual_solution)) {
+			auto* const row_cols = SCIProwGetCols(row);
+			auto const row_nnz = static_cast<std::size_t>(SCIProwGetNLPNonz(row));
+			for (std::size_t k = 0; k < row_nnz; ++k) {
+				changed[static_cast<std::size_t>(SCIPcolGetVarProbindex(row_cols[k]))] = true;
 			}
-			if (cache_computed) {
-				return extract_observation_from_cache(model, the_cache);
+		}
+		row_duals[row_idx] = {SCIProwGetIndex(row), dual_sol};
+	}
+
+	auto const new_n_sols_found = SCIPgetNSolsFound(scip);
+	auto const update_incumbent = (new_n_sols_found != n_sols_found);
+	n_sols_found = new_n_sols_found;
+
+	auto const n_lps = static_cast<value_type>(SCIPgetNLPs(scip));
+	auto const obj_norm = obj_l2_norm(scip);
+	for (std::size_t var_idx = 0; var_idx < n_vars; ++var_idx) {
+		auto* const var = variables[var_idx];
+		auto* const col = SCIPvarGetCol(var);
+		auto features = xt::row(the_cache.variable_features, static_cast<std::ptrdiff_t>(var_idx));
+		auto const state = ColumnState{
+			SCIPcolGetLb(col), SCIPcolGetUb(col), SCIPcolGetPrimsol(col), static_cast<int>(SCIPcolGetBasisStatus(col))};
+		auto& old_state = column_states[var_idx];
+		auto const same_bounds =
+			(state.lower_bound == old_state.lower_bound) && (state.upper_bound == old_state.upper_bound);
+		auto const same_solution =
+			(state.primal_solution == old_state.primal_solution) && (state.basis_status == old_state.basis_status);
+		if (changed[var_idx] || !same_bounds || !same_solution) {
+			if (update_static) {
+				set_static_features_for_var(features, var, obj_norm);
 			}
+			set_dynamic_features_for_var(features, scip, var, col, obj_norm, n_lps);
+			old_state = state;
+		} else {
+			set_global_dynamic_features_for_var(features, scip, var, col, n_lps, update_incumbent);
 		}
-		return extract_observation_fully(model);
+	}
+}
+
+template <typename Value, typename Index, template <typename, typename> typename SparseMatrix>
+auto BasicNodeBipartite<Value, Index, SparseMatrix>::extract(scip::Model& model, bool done)
+	-> std::optional<Observation> {
+	auto obs = Observation{};
+	if (extract_into(model, done, obs)) {
+		return obs;
 	}
 	return {};
 }
 
+template <typename Value, typename Index, template <typename, typename> typename SparseMatrix>
+auto BasicNodeBipartite<Value, Index, SparseMatrix>::extract_into(
+	scip::Model& model,
+	bool /* done */,
+	Observation& obs) -> bool {
+	if (model.stage() != SCIP_STAGE_SOLVING) {
+		return false;
+	}
+	if (use_incremental) {
+		extract_incrementally(model);
+		obs = the_cache;
+		return true;
+	}
+	if (use_cache) {
+		if (is_on_root_node(model)) {
+			extract_observation_fully(model, the_cache);
+			cache_computed = true;
+			obs = the_cache;
+			return true;
+		}
+		if (cache_computed) {
+			if (use_column_tracking) {
+				update_variable_features(model, false);
+				obs = the_cache;
+				set_features_for_all_rows(obs.row_features, model, false);
+				return true;
+			}
+			extract_observation_from_cache(model, the_cache, obs);
+			return true;
+		}
+	}
+	extract_observation_fully(model, obs);
+	return true;
+}
+
+template class BasicNodeBipartite<double, std::size_t>;
+template class BasicNodeBipartite<double, std::int32_t>;
+template class BasicNodeBipartite<float, std::size_t>;
+template class BasicNodeBipartite<float, std::int32_t>;
+template class BasicNodeBipartite<double, std::int64_t, utility::csr_matrix>;
+template class BasicNodeBipartite<float, std::int32_t, utility::csr_matrix>;
+
 }  // namespace ecole::observation
@@ -1,6 +1,7 @@
 #include <cmath>
 #include <cstddef>
 #include <optional>
+#include <type_traits>
 
 #include <nonstd/span.hpp>
 #include <range/v3/view/zip.hpp>
@@ -51,4 +52,65 @@ std::optional<xt::xtensor<double, 1>> Pseudocosts::extract(scip::Model& model, b
 	return pseudocosts;
 }
 
+/*******************************************
+ *  Implementation of ExtendedPseudocosts  *
+ *******************************************/
+
+namespace {
+
+using Features = ExtendedPseudocostsObs::Features;
+
+/** Convert an enum to its underlying index. */
+template <typename E> constexpr auto idx(E e) {
+	return static_cast<std::underlying_type_t<E>>(e);
+}
+
+/** Write the features of a candidate in a single pass over its pseudocost data. */
+template <typename Tensor>
+void set_pseudocost_features(Tensor&& out, SCIP* const scip, SCIP_VAR* const var, SCIP_Real lp_val) {
+	auto constexpr down = SCIP_BRANCHDIR_DOWNWARDS;
+	auto constexpr up = SCIP_BRANCHDIR_UPWARDS;
+	auto constexpr all_runs = FALSE;
+	auto constexpr confidence_level = SCIP_CONFIDENCELEVEL_HIGH;
+	out[idx(Features::pseudocost_down)] = SCIPgetVarPseudocostVal(scip, var, SCIPfeasFloor(scip, lp_val) - lp_val);
+	out[idx(Features::pseudocost_up)] = SCIPgetVarPseudocostVal(scip, var, SCIPfeasCeil(scip, lp_val) - lp_val);
+	out[idx(Features::count_down)] = SCIPgetVarPseudocostCount(scip, var, down);
+	out[idx(Features::count_up)] = SCIPgetVarPseudocostCount(scip, var, up);
+	out[idx(Features::variance_down)] = SCIPgetVarPseudocostVariance(scip, var, down, all_runs);
+	out[idx(Features::variance_up)] = SCIPgetVarPseudocostVariance(scip, var, up, all_runs);
+	out[idx(Features::confidence_down)] =
+		SCIPcalculatePscostConfidenceBound(scip, var, down, all_runs, confidence_level);
+	out[idx(Features::confidence_up)] = SCIPcalculatePscostConfidenceBound(scip, var, up, all_runs, confidence_level);
+	out[idx(Features::score)] = SCIPgetVarPseudocostScore(scip, var, lp_val);
+}
+
+}  // namespace
+
+auto ExtendedPseudocosts::extract(scip::Model& model, bool done) -> std::optional<ExtendedPseudocostsObs> {
+	auto obs = ExtendedPseudocostsObs{};
+	if (extract_into(model, done, obs)) {
+		return obs;
+	}
+	return {};
+}
+
+auto ExtendedPseudocosts::extract_into(scip::Model& model, bool /* done */, ExtendedPseudocostsObs& obs) -> bool {
+	if (model.stage() != SCIP_STAGE_SOLVING) {
+		return false;
+	}
+
+	auto* const scip = model.get_scip_ptr();
+	auto const [cands, lp_values] = scip_get_lp_branch_cands(scip);
+
+	obs.features.resize({cands.size(), ExtendedPseudocostsObs::n_features});
+	obs.candidates.resize({cands.size()});
+	for (std::size_t cand_idx = 0; cand_idx < cands.size(); ++cand_idx) {
+		obs.candidates[cand_idx] = static_cast<std::size_t>(SCIPvarGetProbindex(cands[cand_idx]));
+		auto features = xt::row(obs.features, static_cast<std::ptrdiff_t>(cand_idx));
+		set_pseudocost_features(features, scip, cands[cand_idx], lp_values[cand_idx]);
+	}
+
+	return true;
+}
+
 }  // namespace ecole::observation
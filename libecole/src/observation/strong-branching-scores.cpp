@@ -1,82 +1,122 @@
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include <nonstd/span.hpp>
-#include <range/v3/view/zip.hpp>
-#include <scip/scipdefplugins.h>
-#include <scip/struct_branch.h>
+#include <scip/scip.h>
 
 #include "ecole/observation/strong-branching-scores.hpp"
 #include "ecole/scip/model.hpp"
-#include "ecole/scip/utils.hpp"
+#include "ecole/scip/strong-branching.hpp"
 
 namespace ecole::observation {
 
-namespace views = ranges::views;
-
 namespace {
 
-/** get vanilla full strong branching scores and variables */
-auto scip_get_vanillafullstrong_data(SCIP* const scip) noexcept {
-	SCIP_VAR** cands = nullptr;
-	SCIP_Real* cands_scores = nullptr;
-	int n_cands = 0;
-	SCIPgetVanillafullstrongData(scip, &cands, &cands_scores, &n_cands, nullptr, nullptr);
-	return std::tuple{
-		nonstd::span{cands, static_cast<std::size_t>(n_cands)},
-		nonstd::span{cands_scores, static_cast<std::size_t>(n_cands)},
-	};
+/**
+ * Keep the candidates with the best pseudocost score.
+ *
+ * Ties are broken by keeping the candidates first in the candidate order, so that the selection is deterministic.
+ */
+auto select_best_pseudocosts(SCIP* const scip, std::vector<SCIP_VAR*>& cands, std::size_t n_selected) -> void {
+	auto scores = std::vector<SCIP_Real>(cands.size());
+	auto order = std::vector<std::size_t>(cands.size());
+	for (std::size_t i = 0; i < cands.size(); ++i) {
+		scores[i] = SCIPgetVarPseudocostScore(scip, cands[i], SCIPvarGetLPSol(cands[i]));
+		order[i] = i;
+	}
+	auto const better = [&scores](auto i, auto j) { return scores[i] > scores[j] || (scores[i] == scores[j] && i < j); };
+	std::partial_sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(n_selected), order.end(), better);
+	order.resize(n_selected);
+	std::sort(order.begin(), order.end());
+	for (std::size_t i = 0; i < n_selected; ++i) {
+		cands[i] = cands[order[i]];
+	}
+	cands.resize(n_selected);
+}
+
+/** Keep a uniformly sampled subset of the candidates, in their original order. */
+auto select_sample(std::vector<SCIP_VAR*>& cands, std::size_t n_selected, RandomGenerator& rng) -> void {
+	auto selected = std::vector<SCIP_VAR*>{};
+	selected.reserve(n_selected);
+	std::sample(cands.begin(), cands.end(), std::back_inserter(selected), n_selected, rng);
+	cands = std::move(selected);
 }
 
 }  // namespace
 
-StrongBranchingScores::StrongBranchingScores(bool pseudo_candidates_) : pseudo_candidates(pseudo_candidates_) {}
+StrongBranchingScores::StrongBranchingScores(
+	bool pseudo_candidates_,
+	std::optional<std::size_t> max_candidates_,
+	bool sample_candidates_,
+	int lp_iteration_limit_,
+	std::optional<std::size_t> n_threads_) :
+	pseudo_candidates(pseudo_candidates_),
+	max_candidates(max_candidates_),
+	sample_candidates(sample_candidates_),
+	lp_iteration_limit(lp_iteration_limit_),
+	n_threads(n_threads_) {}
+
+auto StrongBranchingScores::before_reset(scip::Model& model) -> void {
+	if (sample_candidates) {
+		rng.seed(static_cast<Seed>(model.get_param<int>("randomization/randomseedshift")));
+	}
+}
 
-std::optional<xt::xtensor<double, 1>> StrongBranchingScores::extract(scip::Model& model, bool /* done */) const {
+std::optional<xt::xtensor<double, 1>> StrongBranchingScores::extract(scip::Model& model, bool done) {
 	if (model.stage() != SCIP_STAGE_SOLVING) {
 		return {};
 	}
+	auto strong_branching_scores = xt::xtensor<double, 1>::from_shape({model.variables().size()});
+	extract_into(model, done, {strong_branching_scores.data(), strong_branching_scores.size()});
+	return strong_branching_scores;
+}
+
+auto StrongBranchingScores::extract_into(scip::Model& model, bool /* done */, nonstd::span<double> out) -> bool {
+	if (model.stage() != SCIP_STAGE_SOLVING) {
+		return false;
+	}
 
 	auto* const scip = model.get_scip_ptr();
-
-	/* store original SCIP parameters */
-	auto const integralcands = model.get_param<bool>("branching/vanillafullstrong/integralcands");
-	auto const scoreall = model.get_param<bool>("branching/vanillafullstrong/scoreall");
-	auto const collectscores = model.get_param<bool>("branching/vanillafullstrong/collectscores");
-	auto const donotbranch = model.get_param<bool>("branching/vanillafullstrong/donotbranch");
-	auto const idempotent = model.get_param<bool>("branching/vanillafullstrong/idempotent");
-
-	/* set parameters for vanilla full strong branching  */
-	model.set_param("branching/vanillafullstrong/integralcands", pseudo_candidates);
-	model.set_param("branching/vanillafullstrong/scoreall", true);
-	model.set_param("branching/vanillafullstrong/collectscores", true);
-	model.set_param("branching/vanillafullstrong/donotbranch", true);
-	model.set_param("branching/vanillafullstrong/idempotent", true);
-
-	/* execute vanilla full strong branching */
-	auto* branchrule = SCIPfindBranchrule(scip, "vanillafullstrong");
-	SCIP_RESULT result;
-	scip::call(branchrule->branchexeclp, scip, branchrule, false, &result);
-	assert(result == SCIP_DIDNOTRUN);
-	auto const [cands, cands_scores] = scip_get_vanillafullstrong_data(scip);
-
-	/* restore model parameters */
-	model.set_param("branching/vanillafullstrong/integralcands", integralcands);
-	model.set_param("branching/vanillafullstrong/scoreall", scoreall);
-	model.set_param("branching/vanillafullstrong/collectscores", collectscores);
-	model.set_param("branching/vanillafullstrong/donotbranch", donotbranch);
-	model.set_param("branching/vanillafullstrong/idempotent", idempotent);
-
-	/* Store strong branching scores in tensor */
 	auto const nb_vars = static_cast<std::size_t>(SCIPgetNVars(scip));
-	auto strong_branching_scores = xt::xtensor<double, 1>({nb_vars}, std::nan(""));
+	if (out.size() != nb_vars) {
+		throw std::invalid_argument{"The output buffer must have one element per variable."};
+	}
 
-	for (auto const [var, score] : views::zip(cands, cands_scores)) {
-		auto const var_index = static_cast<std::size_t>(SCIPvarGetProbindex(var));
-		strong_branching_scores[var_index] = static_cast<double>(score);
+	/* Select the candidates to score */
+	auto const all_cands = pseudo_candidates ? model.pseudo_branch_cands() : model.lp_branch_cands();
+	auto cands = std::vector<SCIP_VAR*>(all_cands.begin(), all_cands.end());
+	if (max_candidates.has_value() && (cands.size() > max_candidates.value())) {
+		if (sample_candidates) {
+			select_sample(cands, max_candidates.value(), rng);
+		} else {
+			select_best_pseudocosts(scip, cands, max_candidates.value());
+		}
 	}
 
-	return strong_branching_scores;
+	/* Execute strong branching directly, without going through the vanillafullstrong parameters */
+	auto results = [&] {
+		if (n_threads.has_value()) {
+			return scip::strong_branch_parallel(scip, cands, n_threads.value(), lp_iteration_limit);
+		}
+		return scip::strong_branch(scip, cands, lp_iteration_limit);
+	}();
+
+	/* Store strong branching scores in the output */
+	std::fill(out.begin(), out.end(), std::nan(""));
+	for (auto const& result : results) {
+		auto const var_index = static_cast<std::size_t>(SCIPvarGetProbindex(result.var));
+		out[var_index] = static_cast<double>(result.score);
+	}
+
+	/* Let the dynamics reuse the results when branching on one of the candidates */
+	model.strong_branching_cache().store(scip, std::move(results));
+
+	return true;
 }
 
 }  // namespace ecole::observation
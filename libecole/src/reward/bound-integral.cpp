@@ -1,7 +1,8 @@
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <mutex>
-#include <vector>
+#include <utility>
 
 #include "scip/scip.h"
 #include "scip/type_event.h"
@@ -16,45 +17,162 @@ namespace ecole::reward {
 
 namespace {
 
+/* Get the primal bound of the scip model */
+auto get_primal_bound(SCIP* scip) {
+	switch (SCIPgetStage(scip)) {
+	case SCIP_STAGE_TRANSFORMED:
+	case SCIP_STAGE_INITPRESOLVE:
+	case SCIP_STAGE_PRESOLVING:
+	case SCIP_STAGE_EXITPRESOLVE:
+	case SCIP_STAGE_PRESOLVED:
+	case SCIP_STAGE_INITSOLVE:
+	case SCIP_STAGE_SOLVING:
+	case SCIP_STAGE_SOLVED:
+		return SCIPgetPrimalbound(scip);
+	default:
+		return SCIPgetObjlimit(scip);
+	}
+}
+
+/* Get the dual bound of the scip model */
+auto get_dual_bound(SCIP* scip) {
+	switch (SCIPgetStage(scip)) {
+	case SCIP_STAGE_TRANSFORMED:
+	case SCIP_STAGE_INITPRESOLVE:
+	case SCIP_STAGE_PRESOLVING:
+	case SCIP_STAGE_EXITPRESOLVE:
+	case SCIP_STAGE_PRESOLVED:
+	case SCIP_STAGE_INITSOLVE:
+	case SCIP_STAGE_SOLVING:
+	case SCIP_STAGE_SOLVED:
+		return SCIPgetDualbound(scip);
+	default:
+		if (SCIPgetObjsense(scip) == SCIP_OBJSENSE_MINIMIZE) {
+			return -SCIPinfinity(scip);
+		}
+		return SCIPinfinity(scip);
+	}
+}
+
+auto time_now(bool wall) -> std::chrono::nanoseconds {
+	if (wall) {
+		return std::chrono::steady_clock::now().time_since_epoch();
+	}
+	return utility::cpu_clock::now().time_since_epoch();
+}
+
+auto is_lp_event(SCIP_EVENTTYPE event) {
+	return event & SCIP_EVENTTYPE_LPEVENT;
+}
+
+auto is_bestsol_event(SCIP_EVENTTYPE event) {
+	return event & SCIP_EVENTTYPE_BESTSOLFOUND;
+}
+
+/*****************************
+ *  Definition of Integrand  *
+ *****************************/
+
+/** The function of the primal and dual bounds integrated over time. */
+struct Integrand {
+	Bound bound;
+	SCIP_Real offset;
+	SCIP_Real initial_primal_bound;
+	SCIP_Real initial_dual_bound;
+	SCIP_Objsense obj_sense;
+
+	[[nodiscard]] auto uses_primal() const noexcept { return bound != Bound::dual; }
+	[[nodiscard]] auto uses_dual() const noexcept { return bound != Bound::primal; }
+
+	[[nodiscard]] auto operator()(SCIP_Real primal_bound, SCIP_Real dual_bound) const noexcept -> SCIP_Real {
+		auto const minimize = obj_sense == SCIP_OBJSENSE_MINIMIZE;
+		switch (bound) {
+		case Bound::dual:
+			if (minimize) {
+				return offset - std::max(dual_bound, initial_dual_bound);
+			}
+			return -(offset - std::min(dual_bound, initial_dual_bound));
+		case Bound::primal:
+			if (minimize) {
+				return -(offset - std::min(primal_bound, initial_primal_bound));
+			}
+			return offset - std::max(primal_bound, initial_primal_bound);
+		case Bound::primal_dual:
+		default:
+			if (minimize) {
+				return -(std::max(dual_bound, initial_dual_bound) - std::min(primal_bound, initial_primal_bound));
+			}
+			return std::min(dual_bound, initial_dual_bound) - std::max(primal_bound, initial_primal_bound);
+		}
+	}
+};
+
 /*****************************************
  *  Declaration of IntegralEventHanlder  *
  *****************************************/
 
+/**
+ * Accumulate the integral of the bounds as events arrive.
+ *
+ * The integrand is piecewise constant, so the integral is only accounted for when a bound changes, or when it is
+ * extracted.
+ * Events that leave the bounds unchanged cost no clock read.
+ * With a non zero time quantum, bound changes are accounted for at most once per quantum, as measured by a coarse
+ * clock, and the precise clock is only read then.
+ * The coarse time of the first change left pending is kept, so that the previous bounds are only integrated up to
+ * that change, and the bounds that changed again within the quantum are only attributed to the latest ones.
+ */
 class IntegralEventHandler : public ::scip::ObjEventhdlr {
 public:
 	inline static auto constexpr base_name = "ecole::reward::IntegralEventHandler";
 	inline static auto integral_reward_function_counter = 0;
 
-	IntegralEventHandler(SCIP* scip, bool wall_, bool extract_primal_, bool extract_dual_, const char* name_) :
+	IntegralEventHandler(
+		SCIP* scip,
+		Integrand integrand_,
+		bool wall_,
+		std::chrono::nanoseconds time_quantum_,
+		const char* name_) :
 		ObjEventhdlr(scip, name_, "Event handler for primal and dual integrals"),
+		integrand{integrand_},
 		wall{wall_},
-		extract_primal{extract_primal_},
-		extract_dual{extract_dual_} {}
+		time_quantum{time_quantum_} {}
 
 	~IntegralEventHandler() override = default;
 
-	[[nodiscard]] std::vector<std::chrono::nanoseconds> const& get_times() const noexcept { return times; }
-	[[nodiscard]] std::vector<SCIP_Real> const& get_primal_bounds() const noexcept { return primal_bounds; }
-	[[nodiscard]] std::vector<SCIP_Real> const& get_dual_bounds() const noexcept { return dual_bounds; }
-
 	/** Catch primal and dual related events. */
 	SCIP_RETCODE scip_init(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) override;
 	/** Drop primal and dual related events. */
 	SCIP_RETCODE scip_exit(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) override;
-	/* Call extract_metrics() to obtain bounds/times at events. */
+	/* Call record_event() to update the bounds. */
 	SCIP_RETCODE scip_exec(SCIP* scip, SCIP_EVENTHDLR* eventhdlr, SCIP_EVENT* event, SCIP_EVENTDATA* eventdata) override;
 
-	/** Get and adds primal/dual bounds and times to vectors. */
-	void extract_metrics(SCIP* scip, SCIP_EVENTTYPE event_type = 0);
-	void clear_bounds();
+	/** Start integrating from the current bounds and time. */
+	void start(SCIP* scip);
+	/** Update the bounds changed by the event. */
+	void record_event(SCIP* scip, SCIP_EVENTTYPE event_type);
+	/** Return the integral accumulated since the previous call (or start), up to the given time. */
+	auto pop_integral(std::chrono::nanoseconds now) -> SCIP_Real;
 
 private:
+	Integrand integrand;
 	bool wall;
-	bool extract_primal;
-	bool extract_dual;
-	std::vector<std::chrono::nanoseconds> times;
-	std::vector<SCIP_Real> primal_bounds;
-	std::vector<SCIP_Real> dual_bounds;
+	std::chrono::nanoseconds time_quantum;
+	/** Bounds integrated since last_time. */
+	SCIP_Real primal_bound = 0.;
+	SCIP_Real dual_bound = 0.;
+	/** Bounds reported by the latest events, not yet accounted for. */
+	SCIP_Real latest_primal_bound = 0.;
+	SCIP_Real latest_dual_bound = 0.;
+	std::chrono::nanoseconds last_time{0};
+	utility::coarse_clock::time_point last_coarse_time;
+	/** Whether the latest bounds changed within the quantum, and the coarse time of the first change. */
+	bool has_pending_change = false;
+	utility::coarse_clock::time_point pending_coarse_time;
+	SCIP_Real integral = 0.;
+
+	void accumulate_until(std::chrono::nanoseconds now);
+	void integrate_until(std::chrono::nanoseconds time);
 };
 
 /********************************************
@@ -62,20 +180,20 @@ private:
  ********************************************/
 
 auto IntegralEventHandler::scip_init(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) -> SCIP_RETCODE {
-	if (extract_primal) {
+	if (integrand.uses_primal()) {
 		SCIP_CALL(SCIPcatchEvent(scip, SCIP_EVENTTYPE_BESTSOLFOUND, eventhdlr, nullptr, nullptr));
 	}
-	if (extract_dual) {
+	if (integrand.uses_dual()) {
 		SCIP_CALL(SCIPcatchEvent(scip, SCIP_EVENTTYPE_LPEVENT, eventhdlr, nullptr, nullptr));
 	}
 	return SCIP_OKAY;
 }
 
 auto IntegralEventHandler::scip_exit(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) -> SCIP_RETCODE {
-	if (extract_primal) {
+	if (integrand.uses_primal()) {
 		SCIP_CALL(SCIPdropEvent(scip, SCIP_EVENTTYPE_BESTSOLFOUND, eventhdlr, nullptr, -1));
 	}
-	if (extract_dual) {
+	if (integrand.uses_dual()) {
 		SCIP_CALL(SCIPdropEvent(scip, SCIP_EVENTTYPE_LPEVENT, eventhdlr, nullptr, -1));
 	}
 	return SCIP_OKAY;
@@ -86,162 +204,84 @@ auto IntegralEventHandler::scip_exec(
 	SCIP_EVENTHDLR* /*eventhdlr*/,
 	SCIP_EVENT* event,
 	SCIP_EVENTDATA* /*eventdata*/) -> SCIP_RETCODE {
-	extract_metrics(scip, SCIPeventGetType(event));
+	record_event(scip, SCIPeventGetType(event));
 	return SCIP_OKAY;
 }
 
-/* Get the primal bound of the scip model */
-auto get_primal_bound(SCIP* scip) {
-	switch (SCIPgetStage(scip)) {
-	case SCIP_STAGE_TRANSFORMED:
-	case SCIP_STAGE_INITPRESOLVE:
-	case SCIP_STAGE_PRESOLVING:
-	case SCIP_STAGE_EXITPRESOLVE:
-	case SCIP_STAGE_PRESOLVED:
-	case SCIP_STAGE_INITSOLVE:
-	case SCIP_STAGE_SOLVING:
-	case SCIP_STAGE_SOLVED:
-		return SCIPgetPrimalbound(scip);
-	default:
-		return SCIPgetObjlimit(scip);
+void IntegralEventHandler::start(SCIP* scip) {
+	if (integrand.uses_primal()) {
+		latest_primal_bound = get_primal_bound(scip);
 	}
-}
-
-/* Get the dual bound of the scip model */
-auto get_dual_bound(SCIP* scip) {
-	switch (SCIPgetStage(scip)) {
-	case SCIP_STAGE_TRANSFORMED:
-	case SCIP_STAGE_INITPRESOLVE:
-	case SCIP_STAGE_PRESOLVING:
-	case SCIP_STAGE_EXITPRESOLVE:
-	case SCIP_STAGE_PRESOLVED:
-	case SCIP_STAGE_INITSOLVE:
-	case SCIP_STAGE_SOLVING:
-	case SCIP_STAGE_SOLVED:
-		return SCIPgetDualbound(scip);
-	default:
-		if (SCIPgetObjsense(scip) == SCIP_OBJSENSE_MINIMIZE) {
-			return -SCIPinfinity(scip);
-		}
-		return SCIPinfinity(scip);
+	if (integrand.uses_dual()) {
+		latest_dual_bound = get_dual_bound(scip);
 	}
+	primal_bound = latest_primal_bound;
+	dual_bound = latest_dual_bound;
+	last_time = time_now(wall);
+	last_coarse_time = utility::coarse_clock::now();
+	has_pending_change = false;
+	integral = 0.;
 }
 
-auto time_now(bool wall) -> std::chrono::nanoseconds {
-	if (wall) {
-		return std::chrono::steady_clock::now().time_since_epoch();
+void IntegralEventHandler::record_event(SCIP* scip, SCIP_EVENTTYPE event_type) {
+	if (integrand.uses_primal() && is_bestsol_event(event_type)) {
+		latest_primal_bound = get_primal_bound(scip);
 	}
-	return utility::cpu_clock::now().time_since_epoch();
-}
-
-auto is_lp_event(SCIP_EVENTTYPE event) {
-	return event & SCIP_EVENTTYPE_LPEVENT;
+	if (integrand.uses_dual() && is_lp_event(event_type)) {
+		latest_dual_bound = get_dual_bound(scip);
+	}
+	if ((latest_primal_bound == primal_bound) && (latest_dual_bound == dual_bound)) {
+		return;
+	}
+	if (time_quantum.count() > 0) {
+		auto const coarse_now = utility::coarse_clock::now();
+		if (coarse_now - last_coarse_time < time_quantum) {
+			if (!has_pending_change) {
+				has_pending_change = true;
+				pending_coarse_time = coarse_now;
+			}
+			return;
+		}
+	}
+	accumulate_until(time_now(wall));
 }
 
-auto is_bestsol_event(SCIP_EVENTTYPE event) {
-	return event & SCIP_EVENTTYPE_BESTSOLFOUND;
+auto IntegralEventHandler::pop_integral(std::chrono::nanoseconds now) -> SCIP_Real {
+	accumulate_until(now);
+	return std::exchange(integral, 0.);
 }
 
-void IntegralEventHandler::extract_metrics(SCIP* scip, SCIP_EVENTTYPE event_type) {
-	if (extract_primal) {
-		if ((is_bestsol_event(event_type)) || (primal_bounds.empty())) {
-			primal_bounds.push_back(get_primal_bound(scip));
-		} else {
-			primal_bounds.push_back(primal_bounds.back());
-		}
+void IntegralEventHandler::accumulate_until(std::chrono::nanoseconds now) {
+	if (has_pending_change) {
+		// The time of the pending change on the integration clock, estimated from the coarse time elapsed until then
+		auto const change_time =
+			std::clamp(last_time + (pending_coarse_time - last_coarse_time), last_time, std::max(last_time, now));
+		integrate_until(change_time);
+		primal_bound = latest_primal_bound;
+		dual_bound = latest_dual_bound;
+		has_pending_change = false;
 	}
-	if (extract_dual) {
-		if ((is_lp_event(event_type)) || (dual_bounds.empty())) {
-			dual_bounds.push_back(get_dual_bound(scip));
-		} else {
-			dual_bounds.push_back(dual_bounds.back());
-		}
+	integrate_until(now);
+	if (time_quantum.count() > 0) {
+		last_coarse_time = utility::coarse_clock::now();
 	}
-	times.push_back(time_now(wall));
+	primal_bound = latest_primal_bound;
+	dual_bound = latest_dual_bound;
 }
 
-void IntegralEventHandler::clear_bounds() {
-	if (extract_dual) {
-		auto last_dual = dual_bounds.back();
-		dual_bounds.clear();
-		dual_bounds.push_back(last_dual);
-	}
-	if (extract_primal) {
-		auto last_primal = primal_bounds.back();
-		primal_bounds.clear();
-		primal_bounds.push_back(last_primal);
+void IntegralEventHandler::integrate_until(std::chrono::nanoseconds time) {
+	// The time cached in the step statistics can be older than the last event
+	if (time <= last_time) {
+		return;
 	}
-	auto last_time = times.back();
-	times.clear();
-	times.push_back(last_time);
+	integral += integrand(primal_bound, dual_bound) * std::chrono::duration<double>(time - last_time).count();
+	last_time = time;
 }
 
 /*************************************
  *  Implementation of BoundIntegral  *
  *************************************/
 
-auto compute_dual_integral(
-	std::vector<SCIP_Real> const& dual_bounds,
-	std::vector<std::chrono::nanoseconds> const& times,
-	SCIP_Real const offset,
-	SCIP_Real const initial_dual_bound,
-	SCIP_Objsense obj_sense) {
-	SCIP_Real dual_integral = 0.0;
-	for (std::size_t i = 0; i < dual_bounds.size() - 1; ++i) {
-		auto const time_diff = std::chrono::duration<double>(times[i + 1] - times[i]).count();
-		auto const dual_bound = dual_bounds[i];
-		if (obj_sense == SCIP_OBJSENSE_MINIMIZE) {
-			dual_integral += (offset - std::max(dual_bound, initial_dual_bound)) * time_diff;
-		} else {
-			dual_integral += -(offset - std::min(dual_bound, initial_dual_bound)) * time_diff;
-		}
-	}
-	return dual_integral;
-}
-
-auto compute_primal_integral(
-	std::vector<SCIP_Real> const& primal_bounds,
-	std::vector<std::chrono::nanoseconds> const& times,
-	SCIP_Real const offset,
-	SCIP_Real const initial_primal_bound,
-	SCIP_Objsense obj_sense) {
-	SCIP_Real primal_integral = 0.0;
-	for (std::size_t i = 0; i < primal_bounds.size() - 1; ++i) {
-		auto const time_diff = std::chrono::duration<double>(times[i + 1] - times[i]).count();
-		auto const primal_bound = primal_bounds[i];
-		if (obj_sense == SCIP_OBJSENSE_MINIMIZE) {
-			primal_integral += -(offset - std::min(primal_bound, initial_primal_bound)) * time_diff;
-		} else {
-			primal_integral += (offset - std::max(primal_bound, initial_primal_bound)) * time_diff;
-		}
-	}
-	return primal_integral;
-}
-
-auto compute_primal_dual_integral(
-	std::vector<SCIP_Real> const& primal_bounds,
-	std::vector<SCIP_Real> const& dual_bounds,
-	std::vector<std::chrono::nanoseconds> const& times,
-	SCIP_Real const initial_primal_bound,
-	SCIP_Real const initial_dual_bound,
-	SCIP_Objsense obj_sense) {
-	SCIP_Real primal_dual_integral = 0.0;
-
-	for (std::size_t i = 0; i < primal_bounds.size() - 1; ++i) {
-		auto const time_diff = std::chrono::duration<double>(times[i + 1] - times[i]).count();
-		auto const dual_bound = dual_bounds[i];
-		auto const primal_bound = primal_bounds[i];
-		if (obj_sense == SCIP_OBJSENSE_MINIMIZE) {
-			primal_dual_integral +=
-				-(std::max(dual_bound, initial_dual_bound) - std::min(primal_bound, initial_primal_bound)) * time_diff;
-		} else {
-			primal_dual_integral +=
-				(std::min(dual_bound, initial_dual_bound) - std::max(primal_bound, initial_primal_bound)) * time_diff;
-		}
-	}
-	return primal_dual_integral;
-}
-
 /** Return the integral event handler */
 auto get_eventhdlr(scip::Model& model, const char* name) -> auto& {
 	auto* const base_handler = SCIPfindObjEventhdlr(model.get_scip_ptr(), name);
@@ -252,8 +292,13 @@ auto get_eventhdlr(scip::Model& model, const char* name) -> auto& {
 }
 
 /** Add the integral event handler to the model. */
-void add_eventhdlr(scip::Model& model, bool wall, bool extract_primal, bool extract_dual, const char* name) {
-	auto handler = std::make_unique<IntegralEventHandler>(model.get_scip_ptr(), wall, extract_primal, extract_dual, name);
+void add_eventhdlr(
+	scip::Model& model,
+	Integrand const& integrand,
+	bool wall,
+	std::chrono::nanoseconds time_quantum,
+	const char* name) {
+	auto handler = std::make_unique<IntegralEventHandler>(model.get_scip_ptr(), integrand, wall, time_quantum, name);
 	scip::call(SCIPincludeObjEventhdlr, model.get_scip_ptr(), handler.get(), true);
 	// NOLINTNEXTLINE memory ownership is passed to SCIP
 	handler.release();
@@ -287,7 +332,11 @@ auto default_primal_dual_bound_function(scip::Model& model) -> std::tuple<Reward
 }  // namespace
 
 template <Bound bound>
-ecole::reward::BoundIntegral<bound>::BoundIntegral(bool wall_, const BoundFunction& bound_function_) : wall{wall_} {
+ecole::reward::BoundIntegral<bound>::BoundIntegral(
+	bool wall_,
+	const BoundFunction& bound_function_,
+	double time_quantum_) :
+	time_quantum{time_quantum_}, wall{wall_} {
 	if constexpr (bound == Bound::dual) {
 		bound_function = bound_function_ ? bound_function_ : default_dual_bound_function;
 	} else if constexpr (bound == Bound::primal) {
@@ -306,43 +355,23 @@ template <Bound bound> void BoundIntegral<bound>::before_reset(scip::Model& mode
 	// Initalize bounds and event handler
 	if constexpr (bound == Bound::dual) {
 		std::tie(offset, initial_dual_bound) = bound_function(model);
-		add_eventhdlr(model, wall, false, true, name.c_str());
 	} else if constexpr (bound == Bound::primal) {
 		std::tie(offset, initial_primal_bound) = bound_function(model);
-		add_eventhdlr(model, wall, true, false, name.c_str());
 	} else if constexpr (bound == Bound::primal_dual) {
 		std::tie(initial_primal_bound, initial_dual_bound) = bound_function(model);
-		add_eventhdlr(model, wall, true, true, name.c_str());
 	}
+	auto const integrand =
+		Integrand{bound, offset, initial_primal_bound, initial_dual_bound, SCIPgetObjsense(model.get_scip_ptr())};
+	auto const quantum = std::chrono::duration<double>{time_quantum};
+	add_eventhdlr(model, integrand, wall, std::chrono::duration_cast<std::chrono::nanoseconds>(quantum), name.c_str());
 
-	// Extract metrics before resetting to get initial reference point
-	get_eventhdlr(model, name.c_str()).extract_metrics(model.get_scip_ptr());
+	// Start integrating before resetting to get initial reference point
+	get_eventhdlr(model, name.c_str()).start(model.get_scip_ptr());
 }
 
 template <Bound bound> Reward BoundIntegral<bound>::extract(scip::Model& model, bool /*done*/) {
-	// Get info from event handler
-	auto& handler = get_eventhdlr(model, name.c_str());
-	handler.extract_metrics(model.get_scip_ptr());
-
-	auto const& dual_bounds = handler.get_dual_bounds();
-	auto const& primal_bounds = handler.get_primal_bounds();
-	auto const& times = handler.get_times();
-	auto const obj_sense = SCIPgetObjsense(model.get_scip_ptr());
-
-	// Compute primal integral and difference
-	SCIP_Real integral = 0.;
-	if constexpr (bound == Bound::dual) {
-		integral = compute_dual_integral(dual_bounds, times, offset, initial_dual_bound, obj_sense);
-	} else if constexpr (bound == Bound::primal) {
-		integral = compute_primal_integral(primal_bounds, times, offset, initial_primal_bound, obj_sense);
-	} else if constexpr (bound == Bound::primal_dual) {
-		integral = compute_primal_dual_integral(
-			primal_bounds, dual_bounds, times, initial_primal_bound, initial_dual_bound, obj_sense);
-	}
-
-	// Reset arrays for storing bounds
-	handler.clear_bounds();
-	return static_cast<Reward>(integral);
+	auto const now = model.statistics().time(wall);
+	return static_cast<Reward>(get_eventhdlr(model, name.c_str()).pop_integral(now));
 }
 
 template class BoundIntegral<Bound::primal>;
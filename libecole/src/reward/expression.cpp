@@ -0,0 +1,451 @@
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "ecole/reward/expression.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole::reward {
+
+namespace {
+
+using Operator = Expression::Operator;
+
+/** Functions of the formula taking one argument, which are also available as methods. */
+auto unary_operator(std::string_view name) -> std::optional<Operator> {
+	static auto const operators = std::map<std::string_view, Operator>{
+		{"abs", Operator::absolute},
+		{"exp", Operator::exp},
+		{"log", Operator::log},
+		{"log2", Operator::log2},
+		{"log10", Operator::log10},
+		{"sqrt", Operator::sqrt},
+		{"floor", Operator::floor},
+		{"ceil", Operator::ceil},
+		{"cumsum", Operator::cumsum},
+	};
+	if (auto const iter = operators.find(name); iter != operators.end()) {
+		return iter->second;
+	}
+	return {};
+}
+
+/** Create a reward function of the formula from its name and whether it uses wall time. */
+auto make_function(std::string_view name, bool wall) -> std::optional<Expression::Function> {
+	if (name == "IsDone") {
+		return IsDone{};
+	}
+	if (name == "LpIterations") {
+		return LpIterations{};
+	}
+	if (name == "NNodes") {
+		return NNodes{};
+	}
+	if (name == "SolvingTime") {
+		return SolvingTime{wall};
+	}
+	if (name == "DualIntegral") {
+		return DualIntegral{wall};
+	}
+	if (name == "PrimalIntegral") {
+		return PrimalIntegral{wall};
+	}
+	if (name == "PrimalDualIntegral") {
+		return PrimalDualIntegral{wall};
+	}
+	return {};
+}
+
+/** Whether a reward function of the formula accepts the ``wall`` argument. */
+auto measures_time(Expression::Function const& function) -> bool {
+	return !(
+		std::holds_alternative<IsDone>(function) || std::holds_alternative<LpIterations>(function) ||
+		std::holds_alternative<NNodes>(function));
+}
+
+/**
+ * Recursive descent parser of formulas, emitting the plan while parsing.
+ *
+ * The grammar, from lowest to highest precedence, is
+ *   sum     := product (('+' | '-') product)*
+ *   product := unary (('*' | '/') unary)*
+ *   unary   := ('-' | '+') unary | power
+ *   power   := postfix ('**' unary)?
+ *   postfix := primary ('.' name '(' ')')*
+ *   primary := number | name '(' arguments ')' | '(' sum ')'
+ */
+class Parser {
+public:
+	Parser(std::string_view formula) : m_formula{formula} {}
+
+	auto parse() -> Expression {
+		parse_sum();
+		skip_spaces();
+		if (m_pos != m_formula.size()) {
+			fail("unexpected character");
+		}
+		return m_builder.build(std::string{m_formula});
+	}
+
+private:
+	std::string_view m_formula;
+	std::size_t m_pos = 0;
+	Expression::Builder m_builder;
+	/** Index of the functions already added, by name and use of wall time. */
+	std::map<std::pair<std::string, bool>, std::size_t> m_function_indices;
+
+	[[noreturn]] auto fail(std::string_view reason) const -> void {
+		throw std::invalid_argument{fmt::format("Invalid reward formula at position {}: {}.", m_pos, reason)};
+	}
+
+	auto skip_spaces() noexcept -> void {
+		while ((m_pos < m_formula.size()) && (std::isspace(static_cast<unsigned char>(m_formula[m_pos])) != 0)) {
+			++m_pos;
+		}
+	}
+
+	/** Whether the given token comes next. */
+	auto peek(std::string_view token) noexcept -> bool {
+		skip_spaces();
+		return m_formula.substr(m_pos, token.size()) == token;
+	}
+
+	/** Consume the given token if it comes next. */
+	auto accept(std::string_view token) -> bool {
+		if (peek(token)) {
+			m_pos += token.size();
+			return true;
+		}
+		return false;
+	}
+
+	auto expect(std::string_view token) -> void {
+		if (!accept(token)) {
+			fail(fmt::format("expected '{}'", token));
+		}
+	}
+
+	auto parse_name() -> std::string_view {
+		skip_spaces();
+		auto const start = m_pos;
+		while ((m_pos < m_formula.size()) &&
+					 ((std::isalnum(static_cast<unsigned char>(m_formula[m_pos])) != 0) || (m_formula[m_pos] == '_'))) {
+			++m_pos;
+		}
+		if (m_pos == start) {
+			fail("expected a name");
+		}
+		return m_formula.substr(start, m_pos - start);
+	}
+
+	auto parse_sum() -> void {
+		parse_product();
+		while (true) {
+			if (accept("+")) {
+				parse_product();
+				m_builder.push_operator(Operator::add);
+			} else if (accept("-")) {
+				parse_product();
+				m_builder.push_operator(Operator::subtract);
+			} else {
+				return;
+			}
+		}
+	}
+
+	auto parse_product() -> void {
+		parse_unary();
+		// Not to be confused with the power operator
+		while (!peek("**")) {
+			if (accept("*")) {
+				parse_unary();
+				m_builder.push_operator(Operator::multiply);
+			} else if (accept("/")) {
+				parse_unary();
+				m_builder.push_operator(Operator::divide);
+			} else {
+				return;
+			}
+		}
+	}
+
+	auto parse_unary() -> void {
+		if (accept("-")) {
+			parse_unary();
+			m_builder.push_operator(Operator::negate);
+		} else if (accept("+")) {
+			parse_unary();
+		} else {
+			parse_power();
+		}
+	}
+
+	auto parse_power() -> void {
+		parse_postfix();
+		if (accept("**")) {
+			// Right associative, and binding less tightly than a unary operator on its right, as in Python
+			parse_unary();
+			m_builder.push_operator(Operator::power);
+		}
+	}
+
+	auto parse_postfix() -> void {
+		parse_primary();
+		while (accept(".")) {
+			auto const name = parse_name();
+			auto const op = unary_operator(name);
+			if (!op.has_value()) {
+				fail(fmt::format("unknown method '{}'", name));
+			}
+			expect("(");
+			expect(")");
+			m_builder.push_operator(op.value());
+		}
+	}
+
+	auto parse_primary() -> void {
+		skip_spaces();
+		if (accept("(")) {
+			parse_sum();
+			expect(")");
+		} else if ((m_pos < m_formula.size()) && (std::isalpha(static_cast<unsigned char>(m_formula[m_pos])) != 0)) {
+			parse_call(parse_name());
+		} else {
+			parse_number();
+		}
+	}
+
+	auto parse_number() -> void {
+		auto const start = std::string{m_formula.substr(m_pos)};
+		char* end = nullptr;
+		auto const value = std::strtod(start.c_str(), &end);
+		if (end == start.c_str()) {
+			fail("expected a number, a function, or a parenthesis");
+		}
+		m_pos += static_cast<std::size_t>(end - start.c_str());
+		m_builder.push_constant(value);
+	}
+
+	auto parse_call(std::string_view name) -> void {
+		expect("(");
+		if (auto const op = unary_operator(name); op.has_value()) {
+			parse_sum();
+			expect(")");
+			m_builder.push_operator(op.value());
+		} else if ((name == "min") || (name == "max")) {
+			auto const op = (name == "min") ? Operator::minimum : Operator::maximum;
+			parse_sum();
+			while (accept(",")) {
+				parse_sum();
+				m_builder.push_operator(op);
+			}
+			expect(")");
+		} else {
+			auto const wall = parse_wall();
+			expect(")");
+			push_function(name, wall);
+		}
+	}
+
+	/** Parse the optional ``wall=True`` or ``wall=False`` argument of reward functions. */
+	auto parse_wall() -> bool {
+		skip_spaces();
+		if ((m_pos < m_formula.size()) && (m_formula[m_pos] == ')')) {
+			return false;
+		}
+		if (parse_name() != "wall") {
+			fail("expected the argument 'wall'");
+		}
+		expect("=");
+		auto const value = parse_name();
+		if ((value == "True") || (value == "true")) {
+			return true;
+		}
+		if ((value == "False") || (value == "false")) {
+			return false;
+		}
+		fail("expected True or False");
+	}
+
+	auto push_function(std::string_view name, bool wall) -> void {
+		auto const key = std::pair{std::string{name}, wall};
+		auto iter = m_function_indices.find(key);
+		if (iter == m_function_indices.end()) {
+			auto function = make_function(name, wall);
+			if (!function.has_value()) {
+				fail(fmt::format("unknown reward function '{}'", name));
+			}
+			if (wall && !measures_time(function.value())) {
+				fail(fmt::format("reward function '{}' does not accept the argument 'wall'", name));
+			}
+			iter = m_function_indices.emplace(key, m_builder.add_function(std::move(function).value())).first;
+		}
+		m_builder.push_function(iter->second);
+	}
+};
+
+auto apply(Operator op, Reward left, Reward right) noexcept -> Reward {
+	switch (op) {
+	case Operator::add:
+		return left + right;
+	case Operator::subtract:
+		return left - right;
+	case Operator::multiply:
+		return left * right;
+	case Operator::divide:
+		return left / right;
+	case Operator::power:
+		return std::pow(left, right);
+	case Operator::minimum:
+		return std::min(left, right);
+	case Operator::maximum:
+		return std::max(left, right);
+	default:
+		return std::nan("");
+	}
+}
+
+auto apply(Operator op, Reward value) noexcept -> Reward {
+	switch (op) {
+	case Operator::negate:
+		return -value;
+	case Operator::absolute:
+		return std::abs(value);
+	case Operator::exp:
+		return std::exp(value);
+	case Operator::log:
+		return std::log(value);
+	case Operator::log2:
+		return std::log2(value);
+	case Operator::log10:
+		return std::log10(value);
+	case Operator::sqrt:
+		return std::sqrt(value);
+	case Operator::floor:
+		return std::floor(value);
+	case Operator::ceil:
+		return std::ceil(value);
+	default:
+		return std::nan("");
+	}
+}
+
+}  // namespace
+
+/*******************************************
+ *  Implementation of Expression::Builder  *
+ *******************************************/
+
+auto Expression::Builder::add_function(Function function) -> std::size_t {
+	m_functions.push_back(std::move(function));
+	return m_functions.size() - 1;
+}
+
+auto Expression::Builder::push_function(std::size_t index) -> void {
+	if (index >= m_functions.size()) {
+		throw std::invalid_argument{fmt::format("No reward function with index {}.", index)};
+	}
+	push({Instruction::Kind::function, Operator::add, index});
+}
+
+auto Expression::Builder::push_constant(Reward value) -> void {
+	push({Instruction::Kind::constant, Operator::add, 0, value});
+}
+
+auto Expression::Builder::push_operator(Operator op) -> void {
+	if (m_depth < arity(op)) {
+		throw std::invalid_argument{"Not enough operands for the operator."};
+	}
+	auto const index = (op == Operator::cumsum) ? m_n_accumulators++ : 0;
+	m_plan.push_back({Instruction::Kind::operation, op, index});
+	m_depth -= arity(op) - 1;
+}
+
+auto Expression::Builder::build(std::string formula) -> Expression {
+	if (m_depth != 1) {
+		throw std::invalid_argument{fmt::format("The expression results in {} values rather than one.", m_depth)};
+	}
+	return {
+		std::exchange(m_functions, {}),
+		std::exchange(m_plan, {}),
+		std::exchange(m_n_accumulators, 0),
+		std::exchange(m_max_depth, 0),
+		std::move(formula)};
+}
+
+auto Expression::Builder::push(Instruction instruction) -> void {
+	m_plan.push_back(instruction);
+	++m_depth;
+	m_max_depth = std::max(m_max_depth, m_depth);
+}
+
+/**********************************
+ *  Implementation of Expression  *
+ **********************************/
+
+Expression::Expression() : Expression{"0"} {}
+
+Expression::Expression(std::string_view formula) : Expression{Parser{formula}.parse()} {}
+
+Expression::Expression(
+	std::vector<Function> functions,
+	std::vector<Instruction> plan,
+	std::size_t n_accumulators,
+	std::size_t max_depth,
+	std::string formula) :
+	m_functions{std::move(functions)},
+	m_plan{std::move(plan)},
+	m_formula{std::move(formula)},
+	m_values(m_functions.size()),
+	m_stack(max_depth),
+	m_accumulators(n_accumulators) {}
+
+auto Expression::before_reset(scip::Model& model) -> void {
+	for (auto& function : m_functions) {
+		std::visit([&model](auto& func) { func.before_reset(model); }, function);
+	}
+	std::fill(m_accumulators.begin(), m_accumulators.end(), 0.);
+}
+
+auto Expression::extract(scip::Model& model, bool done) -> Reward {
+	std::transform(m_functions.begin(), m_functions.end(), m_values.begin(), [&](auto& function) {
+		return std::visit([&](auto& func) { return func.extract(model, done); }, function);
+	});
+
+	// Index past the top of the stack
+	auto top = std::size_t{0};
+	for (auto const& instruction : m_plan) {
+		switch (instruction.kind) {
+		case Instruction::Kind::constant:
+			m_stack[top++] = instruction.value;
+			break;
+		case Instruction::Kind::function:
+			m_stack[top++] = m_values[instruction.index];
+			break;
+		case Instruction::Kind::operation:
+			if (instruction.op == Operator::cumsum) {
+				m_stack[top - 1] = (m_accumulators[instruction.index] += m_stack[top - 1]);
+			} else if (arity(instruction.op) == 2) {
+				--top;
+				m_stack[top - 1] = apply(instruction.op, m_stack[top - 1], m_stack[top]);
+			} else {
+				m_stack[top - 1] = apply(instruction.op, m_stack[top - 1]);
+			}
+			break;
+		}
+	}
+	return m_stack[0];
+}
+
+}  // namespace ecole::reward
@@ -20,8 +20,8 @@ void SolvingTime::before_reset(scip::Model& /* model */) {
 	solving_time_offset = time_now(wall);
 }
 
-Reward SolvingTime::extract(scip::Model& /* model */, bool /* done */) {
-	auto const now = time_now(wall);
+Reward SolvingTime::extract(scip::Model& model, bool /* done */) {
+	auto const now = model.statistics().time(wall);
 	// Casting to seconds represented as a Reward (no ratio).
 	auto const solving_time_diff = std::chrono::duration<Reward>{now - solving_time_offset}.count();
 	solving_time_offset = now;
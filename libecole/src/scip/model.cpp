@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstdlib>
@@ -27,7 +28,16 @@ Model::Model() : Model{std::make_unique<Scimpl>()} {
 
 Model::Model(Model&&) noexcept = default;
 
-Model::Model(std::unique_ptr<Scimpl>&& other_scimpl) : scimpl(std::move(other_scimpl)) {
+namespace {
+
+auto next_model_id() noexcept -> std::uint64_t {
+	static auto counter = std::atomic<std::uint64_t>{0};
+	return counter++;
+}
+
+}  // namespace
+
+Model::Model(std::unique_ptr<Scimpl>&& other_scimpl) : scimpl(std::move(other_scimpl)), m_id{next_model_id()} {
 	set_messagehdlr_quiet(true);
 }
 
@@ -58,6 +68,10 @@ bool Model::operator!=(Model const& other) const noexcept {
 	return !(*this == other);
 }
 
+auto Model::id() const noexcept -> std::uint64_t {
+	return m_id;
+}
+
 Model Model::from_file(std::filesystem::path const& filename) {
 	auto model = Model{};
 	model.read_problem(filename.c_str());
@@ -307,4 +321,43 @@ auto Model::solve_iter_continue(SCIP_RESULT result) -> std::optional<callback::D
 	return scimpl->solve_iter_continue(result);
 }
 
+auto Model::solve_iter_resume(SCIP_RESULT result) -> void {
+	scimpl->solve_iter_resume(result);
+}
+
+auto Model::solve_iter_wait() -> std::optional<callback::DynamicCall> {
+	return scimpl->solve_iter_wait();
+}
+
+auto Model::strong_branching_cache() noexcept -> StrongBranchingCache& {
+	return m_strong_branching_cache;
+}
+
+auto Model::statistics() noexcept -> Statistics& {
+	return m_statistics;
+}
+
+auto Model::prepare_concurrent_reads() -> void {
+	auto* const scip = get_scip_ptr();
+	auto const stage = SCIPgetStage(scip);
+	if ((stage < SCIP_STAGE_TRANSFORMED) || (stage > SCIP_STAGE_SOLVING)) {
+		return;
+	}
+	SCIPgetObjNorm(scip);
+	if ((stage != SCIP_STAGE_SOLVING) || !SCIPhasCurrentNodeLP(scip)) {
+		return;
+	}
+	// LP data is only available, and the branching candidates only computed, on a solved LP
+	if (SCIPgetLPSolstat(scip) != SCIP_LPSOLSTAT_OPTIMAL) {
+		return;
+	}
+	lp_branch_cands();
+	for (auto* const row : lp_rows()) {
+		SCIPgetRowLPActivity(scip, row);
+	}
+	for (auto* const col : lp_columns()) {
+		SCIPgetColRedcost(scip, col);
+	}
+}
+
 }  // namespace ecole::scip
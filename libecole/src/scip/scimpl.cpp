@@ -17,6 +17,7 @@
 #include "ecole/scip/scimpl.hpp"
 #include "ecole/scip/utils.hpp"
 #include "ecole/utility/coroutine.hpp"
+#include "ecole/utility/profiler.hpp"
 
 namespace ecole::scip {
 
@@ -37,6 +38,14 @@ using Executor = typename Controller::Executor;
 template <callback::Type type>
 auto include_reverse_callback(SCIP* scip, std::weak_ptr<Executor> executor, callback::Constructor<type> args) -> void;
 
+/** Record the time SCIP spent solving since the executor last took control, when the Profiler is enabled. */
+auto record_solving(Executor const& executor) noexcept -> void {
+	if (executor.resumed_ticks() != 0) {
+		utility::Profiler::record(
+			"solving", utility::ProfileCategory::solving, executor.resumed_ticks(), utility::profile_ticks());
+	}
+}
+
 /**
  * In a callback send Callback type and wait for result.
  *
@@ -51,6 +60,8 @@ auto handle_executor(SCIP* scip, std::weak_ptr<Executor>& weak_executor, callbac
 		return {SCIP_OKAY, SCIP_DIDNOTRUN};
 	}
 	try {
+		auto executor = weak_executor.lock();
+		record_solving(*executor);
 		return std::visit(
 			[&](auto result_or_stop) -> std::tuple<SCIP_RETCODE, SCIP_RESULT> {
 				using StopToken = Executor::StopToken;
@@ -60,7 +71,7 @@ auto handle_executor(SCIP* scip, std::weak_ptr<Executor>& weak_executor, callbac
 					return {SCIP_OKAY, result_or_stop};
 				}
 			},
-			weak_executor.lock()->yield(call));
+			executor->yield(call));
 	} catch (...) {
 		return {SCIP_ERROR, SCIP_DIDNOTRUN};
 	}
@@ -253,12 +264,23 @@ auto Scimpl::solve_iter(nonstd::span<callback::DynamicConstructor const> arg_pac
 			std::visit([&](auto args) { include_reverse_callback(scip_ptr, executor, args); }, pack);
 		}
 		scip::call(SCIPsolve, scip_ptr);
+		if (auto const executor_ptr = executor.lock(); executor_ptr != nullptr) {
+			record_solving(*executor_ptr);
+		}
 	});
 	return m_controller->wait();
 }
 
 auto Scimpl::solve_iter_continue(SCIP_RESULT result) -> std::optional<callback::DynamicCall> {
+	solve_iter_resume(result);
+	return solve_iter_wait();
+}
+
+auto Scimpl::solve_iter_resume(SCIP_RESULT result) -> void {
 	m_controller->resume(result);
+}
+
+auto Scimpl::solve_iter_wait() -> std::optional<callback::DynamicCall> {
 	return m_controller->wait();
 }
 
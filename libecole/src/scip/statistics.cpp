@@ -0,0 +1,77 @@
+#include <chrono>
+#include <mutex>
+#include <utility>
+
+#include "ecole/scip/statistics.hpp"
+#include "ecole/utility/chrono.hpp"
+
+namespace ecole::scip {
+
+Statistics::Statistics(Statistics&& other) noexcept {
+	*this = std::move(other);
+}
+
+auto Statistics::operator=(Statistics&& other) noexcept -> Statistics& {
+	m_in_step = other.m_in_step;
+	m_n_lp_iterations = other.m_n_lp_iterations;
+	m_n_total_nodes = other.m_n_total_nodes;
+	m_wall_time = other.m_wall_time;
+	m_cpu_time = other.m_cpu_time;
+	return *this;
+}
+
+auto Statistics::begin_step() noexcept -> void {
+	end_step();
+	m_in_step = true;
+}
+
+auto Statistics::end_step() noexcept -> void {
+	m_in_step = false;
+	invalidate();
+}
+
+auto Statistics::invalidate() noexcept -> void {
+	m_n_lp_iterations.reset();
+	m_n_total_nodes.reset();
+	m_wall_time.reset();
+	m_cpu_time.reset();
+}
+
+template <typename T, typename Func> auto Statistics::get(std::optional<T>& cached, Func&& read) -> T {
+	if (!m_in_step) {
+		return std::forward<Func>(read)();
+	}
+	auto const lk = std::lock_guard{m_mutex};
+	if (!cached.has_value()) {
+		cached = std::forward<Func>(read)();
+	}
+	return cached.value();
+}
+
+auto Statistics::n_lp_iterations(SCIP* const scip) -> SCIP_Longint {
+	return get(m_n_lp_iterations, [scip]() -> SCIP_Longint {
+		switch (SCIPgetStage(scip)) {
+		// Only stages when the following call is authorized
+		case SCIP_STAGE_PRESOLVING:
+		case SCIP_STAGE_PRESOLVED:
+		case SCIP_STAGE_SOLVING:
+		case SCIP_STAGE_SOLVED:
+			return SCIPgetNLPIterations(scip);
+		default:
+			return 0;
+		}
+	});
+}
+
+auto Statistics::n_total_nodes(SCIP* const scip) -> SCIP_Longint {
+	return get(m_n_total_nodes, [scip] { return SCIPgetNTotalNodes(scip); });
+}
+
+auto Statistics::time(bool wall) -> std::chrono::nanoseconds {
+	if (wall) {
+		return get(m_wall_time, [] { return std::chrono::steady_clock::now().time_since_epoch(); });
+	}
+	return get(m_cpu_time, [] { return utility::cpu_clock::now().time_since_epoch(); });
+}
+
+}  // namespace ecole::scip
@@ -0,0 +1,381 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+#include <lpi/lpi.h>
+
+#include "ecole/scip/strong-branching.hpp"
+#include "ecole/scip/utils.hpp"
+#include "ecole/utility/thread-pool.hpp"
+
+namespace ecole::scip {
+
+auto strong_branch(SCIP* const scip, nonstd::span<SCIP_VAR* const> cands, int lp_iteration_limit)
+	-> std::vector<StrongBranchingResult> {
+	auto results = std::vector<StrongBranchingResult>{};
+	results.reserve(cands.size());
+	auto const lp_objective = SCIPgetLPObjval(scip);
+
+	scip::call(SCIPstartStrongbranch, scip, false);
+	for (auto* const var : cands) {
+		auto result = StrongBranchingResult{};
+		result.var = var;
+		SCIP_Bool down_valid = FALSE;
+		SCIP_Bool up_valid = FALSE;
+		SCIP_Bool down_infeasible = FALSE;
+		SCIP_Bool up_infeasible = FALSE;
+		SCIP_Bool lp_error = FALSE;
+		// Integral candidates only happen with pseudo candidates
+		auto* const get_strongbranch =
+			SCIPisFeasIntegral(scip, SCIPvarGetLPSol(var)) ? SCIPgetVarStrongbranchInt : SCIPgetVarStrongbranchFrac;
+		scip::call(
+			get_strongbranch,
+			scip,
+			var,
+			lp_iteration_limit,
+			true,
+			&result.down,
+			&result.up,
+			&down_valid,
+			&up_valid,
+			&down_infeasible,
+			&up_infeasible,
+			nullptr,
+			nullptr,
+			&lp_error);
+		if (lp_error == TRUE) {
+			break;
+		}
+		result.down = std::max(result.down, lp_objective);
+		result.up = std::max(result.up, lp_objective);
+		result.down_valid = down_valid == TRUE;
+		result.up_valid = up_valid == TRUE;
+		result.down_infeasible = down_infeasible == TRUE;
+		result.up_infeasible = up_infeasible == TRUE;
+		result.score = SCIPgetBranchScore(scip, var, result.down - lp_objective, result.up - lp_objective);
+		results.push_back(result);
+	}
+	scip::call(SCIPendStrongbranch, scip);
+
+	return results;
+}
+
+namespace {
+
+/** Free an LP interface when going out of scope. */
+struct LpiDeleter {
+	void operator()(SCIP_LPI* ptr) { scip::call(SCIPlpiFree, &ptr); }
+};
+
+using LpiPtr = std::unique_ptr<SCIP_LPI, LpiDeleter>;
+
+/** A copy of the LP of the current node in the format of the LP interface, so that it can be read from any thread. */
+struct LpCopy {
+	std::vector<SCIP_Real> objective;
+	std::vector<SCIP_Real> lower_bounds;
+	std::vector<SCIP_Real> upper_bounds;
+	std::vector<SCIP_Real> lhs;
+	std::vector<SCIP_Real> rhs;
+	std::vector<int> row_begins;
+	std::vector<int> col_indices;
+	std::vector<SCIP_Real> values;
+	std::vector<int> col_basis;
+	std::vector<int> row_basis;
+	/** Difference between the objective value of the node LP in SCIP and in the copy, due to loose variables. */
+	SCIP_Real objective_offset = 0.;
+	SCIP_MESSAGEHDLR* message_handler = nullptr;
+};
+
+auto copy_lp(SCIP* const scip) -> LpCopy {
+	auto lp = LpCopy{};
+	lp.message_handler = SCIPgetMessagehdlr(scip);
+
+	SCIP_LPI* scip_lpi = nullptr;
+	scip::call(SCIPgetLPI, scip, &scip_lpi);
+	auto const lpi_infinity = SCIPlpiInfinity(scip_lpi);
+	auto const to_lpi_bound = [scip, lpi_infinity](SCIP_Real bound, SCIP_Real constant) {
+		if (SCIPisInfinity(scip, std::abs(bound))) {
+			return bound > 0 ? lpi_infinity : -lpi_infinity;
+		}
+		return bound - constant;
+	};
+
+	SCIP_COL** cols = nullptr;
+	int n_cols = 0;
+	scip::call(SCIPgetLPColsData, scip, &cols, &n_cols);
+	lp.objective_offset = SCIPgetLPObjval(scip);
+	for (auto* const col : nonstd::span<SCIP_COL*>{cols, static_cast<std::size_t>(n_cols)}) {
+		lp.objective.push_back(SCIPcolGetObj(col));
+		lp.lower_bounds.push_back(to_lpi_bound(SCIPcolGetLb(col), 0.));
+		lp.upper_bounds.push_back(to_lpi_bound(SCIPcolGetUb(col), 0.));
+		lp.objective_offset -= SCIPcolGetObj(col) * SCIPcolGetPrimsol(col);
+	}
+
+	SCIP_ROW** rows = nullptr;
+	int n_rows = 0;
+	scip::call(SCIPgetLPRowsData, scip, &rows, &n_rows);
+	for (auto* const row : nonstd::span<SCIP_ROW*>{rows, static_cast<std::size_t>(n_rows)}) {
+		auto const constant = SCIProwGetConstant(row);
+		lp.lhs.push_back(to_lpi_bound(SCIProwGetLhs(row), constant));
+		lp.rhs.push_back(to_lpi_bound(SCIProwGetRhs(row), constant));
+		lp.row_begins.push_back(static_cast<int>(lp.col_indices.size()));
+		auto const n_nonzeros = static_cast<std::size_t>(SCIProwGetNNonz(row));
+		auto* const* const row_cols = SCIProwGetCols(row);
+		auto const* const row_values = SCIProwGetVals(row);
+		for (std::size_t k = 0; k < n_nonzeros; ++k) {
+			// Columns outside of the LP are not in the LP solver either
+			auto const col_pos = SCIPcolGetLPPos(row_cols[k]);
+			if (col_pos >= 0) {
+				lp.col_indices.push_back(col_pos);
+				lp.values.push_back(row_values[k]);
+			}
+		}
+	}
+
+	lp.col_basis.resize(static_cast<std::size_t>(n_cols));
+	lp.row_basis.resize(static_cast<std::size_t>(n_rows));
+	scip::call(SCIPlpiGetBase, scip_lpi, lp.col_basis.data(), lp.row_basis.data());
+	return lp;
+}
+
+auto make_lpi(LpCopy const& lp, int lp_iteration_limit) -> LpiPtr {
+	auto lpi = LpiPtr{};
+	{
+		SCIP_LPI* lpi_raw = nullptr;
+		scip::call(SCIPlpiCreate, &lpi_raw, lp.message_handler, "ecole_strong_branching", SCIP_OBJSEN_MINIMIZE);
+		lpi.reset(lpi_raw);
+	}
+	scip::call(
+		SCIPlpiAddCols,
+		lpi.get(),
+		static_cast<int>(lp.objective.size()),
+		lp.objective.data(),
+		lp.lower_bounds.data(),
+		lp.upper_bounds.data(),
+		nullptr,
+		0,
+		nullptr,
+		nullptr,
+		nullptr);
+	scip::call(
+		SCIPlpiAddRows,
+		lpi.get(),
+		static_cast<int>(lp.lhs.size()),
+		lp.lhs.data(),
+		lp.rhs.data(),
+		nullptr,
+		static_cast<int>(lp.values.size()),
+		lp.row_begins.data(),
+		lp.col_indices.data(),
+		lp.values.data());
+	scip::call(SCIPlpiSetIntpar, lpi.get(), SCIP_LPPAR_LPITLIM, lp_iteration_limit);
+	return lpi;
+}
+
+/** Outcome of solving a child LP with the LP interface. */
+struct ChildSolution {
+	SCIP_Real objective = 0.;
+	bool valid = false;
+	bool infeasible = false;
+};
+
+/**
+ * Solve the node LP with the bounds of one column changed, starting from the basis of the node.
+ *
+ * The state of the LP solver is cleared beforehand, so that the solution does not depend on the children solved
+ * previously.
+ * Nothing is returned if the LP solver fails.
+ */
+auto solve_child(SCIP_LPI* const lpi, LpCopy const& lp, int col_pos, SCIP_Real lower_bound, SCIP_Real upper_bound)
+	-> std::optional<ChildSolution> {
+	if (lower_bound > upper_bound) {
+		return ChildSolution{0., true, true};
+	}
+
+	scip::call(SCIPlpiClearState, lpi);
+	scip::call(SCIPlpiSetBase, lpi, lp.col_basis.data(), lp.row_basis.data());
+	scip::call(SCIPlpiChgBounds, lpi, 1, &col_pos, &lower_bound, &upper_bound);
+	auto const retcode = SCIPlpiSolveDual(lpi);
+	auto child = std::optional<ChildSolution>{};
+	if (retcode == SCIP_OKAY) {
+		if (SCIPlpiIsPrimalInfeasible(lpi) == TRUE) {
+			child = ChildSolution{0., true, true};
+		} else if ((SCIPlpiIsOptimal(lpi) == TRUE) || (SCIPlpiIsIterlimExc(lpi) == TRUE)) {
+			// With the dual simplex, the objective value is a bound, but only reported valid once optimal
+			child = ChildSolution{0., SCIPlpiIsOptimal(lpi) == TRUE, false};
+			scip::call(SCIPlpiGetObjval, lpi, &child->objective);
+		}
+	}
+	auto const col_idx = static_cast<std::size_t>(col_pos);
+	scip::call(SCIPlpiChgBounds, lpi, 1, &col_pos, &lp.lower_bounds[col_idx], &lp.upper_bounds[col_idx]);
+	return child;
+}
+
+/** The bounds of the column of a candidate in its down and up children. */
+struct CandidateBounds {
+	int col_pos = -1;
+	SCIP_Real down_upper_bound = 0.;
+	SCIP_Real up_lower_bound = 0.;
+};
+
+auto candidate_bounds(SCIP* const scip, SCIP_VAR* const var) -> CandidateBounds {
+	auto bounds = CandidateBounds{};
+	bounds.col_pos = SCIPcolGetLPPos(SCIPvarGetCol(var));
+	auto const value = SCIPvarGetLPSol(var);
+	// Integral candidates only happen with pseudo candidates, the value is then excluded from both children
+	if (SCIPisFeasIntegral(scip, value) == TRUE) {
+		bounds.down_upper_bound = SCIPfeasRound(scip, value) - 1.;
+		bounds.up_lower_bound = SCIPfeasRound(scip, value) + 1.;
+	} else {
+		bounds.down_upper_bound = SCIPfeasFloor(scip, value);
+		bounds.up_lower_bound = SCIPfeasCeil(scip, value);
+	}
+	return bounds;
+}
+
+/** The objective value, validity, and infeasibility of a child, as given by SCIP strong branching. */
+auto child_outcome(SCIP* const scip, ChildSolution const& child, SCIP_Real objective_offset, SCIP_Real lp_objective)
+	-> std::tuple<SCIP_Real, bool, bool> {
+	auto const cutoff_bound = SCIPgetCutoffbound(scip);
+	if (child.infeasible) {
+		return {std::max(cutoff_bound, lp_objective), true, true};
+	}
+	auto const objective = std::max(child.objective + objective_offset, lp_objective);
+	// Children that cannot improve on the incumbent are infeasible
+	if (child.valid && (SCIPisGE(scip, objective, cutoff_bound) == TRUE)) {
+		return {objective, true, true};
+	}
+	return {objective, child.valid, false};
+}
+
+}  // namespace
+
+auto strong_branch_parallel(
+	SCIP* const scip,
+	nonstd::span<SCIP_VAR* const> cands,
+	std::size_t n_threads,
+	int lp_iteration_limit) -> std::vector<StrongBranchingResult> {
+	auto const lp_objective = SCIPgetLPObjval(scip);
+	auto const lp = copy_lp(scip);
+
+	// Everything read from SCIP is gathered beforehand so that the worker threads never call it
+	auto bounds = std::vector<CandidateBounds>(cands.size());
+	std::transform(cands.begin(), cands.end(), bounds.begin(), [scip](auto* var) { return candidate_bounds(scip, var); });
+
+	// One LP copy per worker, the candidates being split in strided chunks
+	auto down_children = std::vector<std::optional<ChildSolution>>(cands.size());
+	auto up_children = std::vector<std::optional<ChildSolution>>(cands.size());
+	auto const n_workers = std::min(std::max<std::size_t>(n_threads, 1), cands.size());
+	utility::parallel_for(utility::ThreadPool::global(), n_workers, n_workers, [&](std::size_t worker) {
+		auto const lpi = make_lpi(lp, lp_iteration_limit);
+		for (auto i = worker; i < cands.size(); i += n_workers) {
+			auto const& [col_pos, down_upper_bound, up_lower_bound] = bounds[i];
+			if (col_pos < 0) {
+				continue;
+			}
+			auto const col_idx = static_cast<std::size_t>(col_pos);
+			down_children[i] = solve_child(lpi.get(), lp, col_pos, lp.lower_bounds[col_idx], down_upper_bound);
+			up_children[i] = solve_child(lpi.get(), lp, col_pos, up_lower_bound, lp.upper_bounds[col_idx]);
+		}
+	});
+
+	// Merged in the candidate order, stopping at the first LP failure as the serial strong branching does
+	auto results = std::vector<StrongBranchingResult>{};
+	results.reserve(cands.size());
+	for (std::size_t i = 0; i < cands.size(); ++i) {
+		// Candidates that are not LP columns were not solved
+		if (bounds[i].col_pos < 0) {
+			continue;
+		}
+		if (!down_children[i].has_value() || !up_children[i].has_value()) {
+			break;
+		}
+		auto result = StrongBranchingResult{};
+		result.var = cands[i];
+		std::tie(result.down, result.down_valid, result.down_infeasible) =
+			child_outcome(scip, *down_children[i], lp.objective_offset, lp_objective);
+		std::tie(result.up, result.up_valid, result.up_infeasible) =
+			child_outcome(scip, *up_children[i], lp.objective_offset, lp_objective);
+		result.score = SCIPgetBranchScore(scip, result.var, result.down - lp_objective, result.up - lp_objective);
+		results.push_back(result);
+	}
+	return results;
+}
+
+auto branch_var(SCIP* const scip, StrongBranchingResult const& result) -> SCIP_RESULT {
+	auto* const var = result.var;
+	auto const lp_solution = SCIPvarGetLPSol(var);
+	// Integral candidates have a third child where the variable is fixed to its value
+	auto const is_integral = SCIPisFeasIntegral(scip, lp_solution) == TRUE;
+	// The strong branching objective values are only bounds of the children if all columns are in the LP
+	auto const all_cols_in_lp = SCIPallColsInLP(scip) == TRUE;
+
+	if (all_cols_in_lp) {
+		if (result.down_infeasible && result.up_infeasible && !is_integral) {
+			return SCIP_CUTOFF;
+		}
+		if (result.down_infeasible || result.up_infeasible) {
+			if (result.down_infeasible) {
+				auto const new_lb = is_integral ? SCIPfeasRound(scip, lp_solution) : SCIPfeasCeil(scip, lp_solution);
+				scip::call(SCIPchgVarLb, scip, var, new_lb);
+			}
+			if (result.up_infeasible) {
+				auto const new_ub = is_integral ? SCIPfeasRound(scip, lp_solution) : SCIPfeasFloor(scip, lp_solution);
+				scip::call(SCIPchgVarUb, scip, var, new_ub);
+			}
+			return SCIP_REDUCEDDOM;
+		}
+	}
+
+	SCIP_NODE* down_child = nullptr;
+	SCIP_NODE* up_child = nullptr;
+	scip::call(SCIPbranchVar, scip, var, &down_child, nullptr, &up_child);
+	if (all_cols_in_lp) {
+		if ((down_child != nullptr) && result.down_valid) {
+			scip::call(SCIPupdateNodeLowerbound, scip, down_child, result.down);
+		}
+		if ((up_child != nullptr) && result.up_valid) {
+			scip::call(SCIPupdateNodeLowerbound, scip, up_child, result.up);
+		}
+	}
+	return SCIP_BRANCHED;
+}
+
+/********************************************
+ *  Implementation of StrongBranchingCache  *
+ *******************************************/
+
+namespace {
+
+auto current_node_number(SCIP* const scip) noexcept -> SCIP_Longint {
+	auto* const node = SCIPgetCurrentNode(scip);
+	return node != nullptr ? SCIPnodeGetNumber(node) : -1;
+}
+
+}  // namespace
+
+auto StrongBranchingCache::store(SCIP* const scip, std::vector<StrongBranchingResult> results) -> void {
+	m_node_number = current_node_number(scip);
+	m_n_lps = SCIPgetNLPs(scip);
+	m_results = std::move(results);
+}
+
+auto StrongBranchingCache::find(SCIP* const scip, SCIP_VAR const* var) const -> StrongBranchingResult const* {
+	if ((m_node_number != current_node_number(scip)) || (m_n_lps != SCIPgetNLPs(scip))) {
+		return nullptr;
+	}
+	auto const iter =
+		std::find_if(m_results.begin(), m_results.end(), [var](auto const& result) { return result.var == var; });
+	return iter != m_results.end() ? &(*iter) : nullptr;
+}
+
+auto StrongBranchingCache::clear() noexcept -> void {
+	m_node_number = -1;
+	m_n_lps = -1;
+	m_results.clear();
+}
+
+}  // namespace ecole::scip
@@ -1,4 +1,5 @@
 #include <cerrno>
+#include <chrono>
 #include <ctime>
 #include <system_error>
 
@@ -25,4 +26,18 @@ auto cpu_clock::now() -> time_point {
 	return time_point{std::chrono::seconds{spec.tv_sec} + std::chrono::nanoseconds{spec.tv_nsec}};
 }
 
+auto coarse_clock::now() -> time_point {
+#ifdef CLOCK_MONOTONIC_COARSE
+	// Linux specific, read without a system call with the resolution of the scheduler tick.
+	struct timespec spec;
+	if (clock_gettime(CLOCK_MONOTONIC_COARSE, &spec) != 0) {
+		throw std::system_error{{errno, std::generic_category()}};
+	}
+	return time_point{std::chrono::seconds{spec.tv_sec} + std::chrono::nanoseconds{spec.tv_nsec}};
+#else
+	auto const since_epoch = std::chrono::steady_clock::now().time_since_epoch();
+	return time_point{std::chrono::duration_cast<duration>(since_epoch)};
+#endif
+}
+
 }  // namespace ecole::utility
@@ -0,0 +1,52 @@
+#include <mutex>
+
+#include "ecole/utility/coroutine.hpp"
+
+namespace ecole::utility {
+
+namespace {
+
+/** Process wide options for coroutines, protected against concurrent access. */
+class DefaultCoroutineOptions {
+public:
+	static auto get() -> DefaultCoroutineOptions& {
+		static auto instance = DefaultCoroutineOptions{};
+		return instance;
+	}
+
+	auto options() -> CoroutineOptions {
+		auto const lk = std::lock_guard{m_mutex};
+		return m_options;
+	}
+
+	auto set_options(CoroutineOptions const& options) -> void {
+		auto const lk = std::lock_guard{m_mutex};
+		m_options = options;
+	}
+
+private:
+	std::mutex m_mutex;
+	CoroutineOptions m_options = build_time_options();
+
+	DefaultCoroutineOptions() = default;
+
+	static auto build_time_options() noexcept -> CoroutineOptions {
+		auto options = CoroutineOptions{};
+#ifdef ECOLE_COROUTINE_BACKEND_FIBER
+		options.backend = CoroutineBackend::fiber;
+#endif
+		return options;
+	}
+};
+
+}  // namespace
+
+auto default_coroutine_options() -> CoroutineOptions {
+	return DefaultCoroutineOptions::get().options();
+}
+
+auto set_default_coroutine_options(CoroutineOptions const& options) -> void {
+	DefaultCoroutineOptions::get().set_options(options);
+}
+
+}  // namespace ecole::utility
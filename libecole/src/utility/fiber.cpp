@@ -0,0 +1,91 @@
+// MacOS only exposes the ucontext API when asking for X/Open compliance
+#if defined(__APPLE__) && !defined(_XOPEN_SOURCE)
+#define _XOPEN_SOURCE 600  // NOLINT(bugprone-reserved-identifier)
+#endif
+
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <system_error>
+#include <utility>
+
+#include <ucontext.h>
+
+#include "ecole/utility/fiber.hpp"
+
+namespace ecole::utility {
+
+namespace {
+
+/** State of a fiber, kept out of the header to not leak the platform context API. */
+struct FiberState {
+	std::function<void()> func;
+	std::unique_ptr<std::byte[]> stack;  // NOLINT(cppcoreguidelines-avoid-c-arrays) raw stack memory
+	ucontext_t caller_context;
+	ucontext_t fiber_context;
+	bool finished = false;
+};
+
+void check_context_call(int return_code) {
+	if (return_code != 0) {
+		throw std::system_error{errno, std::generic_category()};
+	}
+}
+
+/**
+ * Entry point of every fiber.
+ *
+ * The address of the state is split in two halves because ``makecontext`` only forwards ``int`` arguments.
+ * Returning from this function switches to ``uc_link``, which is the context that last resumed the fiber.
+ */
+void fiber_entry(unsigned int high, unsigned int low) noexcept {
+	auto address = static_cast<std::uintptr_t>(low);
+	if constexpr (sizeof(std::uintptr_t) > sizeof(unsigned int)) {
+		address |= static_cast<std::uintptr_t>(high) << (8U * sizeof(unsigned int));
+	}
+	auto* const state = reinterpret_cast<FiberState*>(address);  // NOLINT(performance-no-int-to-ptr)
+	state->func();
+	state->finished = true;
+}
+
+}  // namespace
+
+struct Fiber::Context : FiberState {};
+
+Fiber::Fiber(std::function<void()> func, std::size_t stack_size) : m_context{std::make_unique<Context>()} {
+	auto& context = *m_context;
+	context.func = std::move(func);
+	// Not using make_unique to avoid zeroing the whole stack, which would needlessly commit its memory pages.
+	context.stack = std::unique_ptr<std::byte[]>{new std::byte[stack_size]};  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+
+	check_context_call(getcontext(&context.fiber_context));
+	context.fiber_context.uc_stack.ss_sp = context.stack.get();
+	context.fiber_context.uc_stack.ss_size = stack_size;
+	context.fiber_context.uc_link = &context.caller_context;
+
+	auto const address = reinterpret_cast<std::uintptr_t>(static_cast<FiberState*>(&context));
+	auto const low = static_cast<unsigned int>(address);
+	auto high = 0U;
+	if constexpr (sizeof(std::uintptr_t) > sizeof(unsigned int)) {
+		high = static_cast<unsigned int>(address >> (8U * sizeof(unsigned int)));
+	}
+	// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-type-vararg)
+	makecontext(&context.fiber_context, reinterpret_cast<void (*)()>(&fiber_entry), 2, high, low);
+}
+
+Fiber::~Fiber() = default;
+
+auto Fiber::resume() -> void {
+	assert(!m_context->finished);
+	check_context_call(swapcontext(&m_context->caller_context, &m_context->fiber_context));
+}
+
+auto Fiber::suspend() -> void {
+	check_context_call(swapcontext(&m_context->fiber_context, &m_context->caller_context));
+}
+
+auto Fiber::is_finished() const noexcept -> bool {
+	return m_context->finished;
+}
+
+}  // namespace ecole::utility
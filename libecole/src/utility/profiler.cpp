@@ -0,0 +1,352 @@
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+#include <fmt/format.h>
+
+#include "ecole/utility/profiler.hpp"
+
+namespace ecole::utility {
+
+std::atomic<bool> Profiler::enabled_flag{false};
+
+namespace {
+
+struct Event {
+	char const* name = nullptr;
+	std::uint64_t start_ticks = 0;
+	std::uint64_t end_ticks = 0;
+	ProfileCategory category = ProfileCategory::coroutine;
+
+	[[nodiscard]] auto duration_ticks() const noexcept -> std::uint64_t {
+		// Timestamp counters of different cores may be slightly out of sync
+		return std::max(end_ticks, start_ticks) - start_ticks;
+	}
+};
+
+/**
+ * Ring buffer of the events of a single thread.
+ *
+ * Only the owning thread pushes events, so no lock is needed.
+ */
+class EventBuffer {
+public:
+	EventBuffer(std::size_t capacity, std::size_t thread_index) :
+		m_events(std::max(capacity, std::size_t{1})), m_thread_index{thread_index} {}
+
+	auto push(Event const& event) noexcept -> void {
+		auto const n_pushed = m_n_pushed.load(std::memory_order_relaxed);
+		m_events[n_pushed % m_events.size()] = event;
+		m_n_pushed.store(n_pushed + 1, std::memory_order_release);
+	}
+
+	/** Copy the events still in the buffer, from oldest to newest. */
+	[[nodiscard]] auto events() const -> std::vector<Event> {
+		auto const n_pushed = m_n_pushed.load(std::memory_order_acquire);
+		auto const n_kept = std::min(n_pushed, m_events.size());
+		auto events = std::vector<Event>{};
+		events.reserve(n_kept);
+		for (auto i = n_pushed - n_kept; i < n_pushed; ++i) {
+			events.push_back(m_events[i % m_events.size()]);
+		}
+		return events;
+	}
+
+	auto clear() noexcept -> void { m_n_pushed.store(0, std::memory_order_release); }
+
+	[[nodiscard]] auto thread_index() const noexcept -> std::size_t { return m_thread_index; }
+
+private:
+	std::vector<Event> m_events;
+	std::atomic<std::size_t> m_n_pushed = 0;
+	std::size_t m_thread_index;
+};
+
+/** State shared by all threads, only accessed outside of the recording of events. */
+struct Registry {
+	std::mutex mutex;
+	std::vector<std::shared_ptr<EventBuffer>> buffers;
+	// Nodes of a set are never moved, so the names remain valid
+	std::set<std::string, std::less<>> names;
+	std::size_t buffer_capacity = std::size_t{1} << 16U;  // NOLINT(readability-magic-numbers)
+};
+
+auto registry() -> Registry& {
+	// Never destroyed because threads may still record events at exit
+	static auto* const reg = new Registry{};  // NOLINT(cppcoreguidelines-owning-memory)
+	return *reg;
+}
+
+/** The buffer of the calling thread, kept alive by the registry after the thread terminates. */
+auto thread_buffer() -> EventBuffer& {
+	thread_local auto const buffer = [] {
+		auto& reg = registry();
+		auto const lk = std::lock_guard{reg.mutex};
+		auto new_buffer = std::make_shared<EventBuffer>(reg.buffer_capacity, reg.buffers.size());
+		reg.buffers.push_back(new_buffer);
+		return new_buffer;
+	}();
+	return *buffer;
+}
+
+/** Number of profile_ticks in a microsecond, measured once. */
+auto ticks_per_us() -> double {
+	static auto const ratio = [] {
+		using Clock = std::chrono::steady_clock;
+		auto const time_before = Clock::now();
+		auto const ticks_before = profile_ticks();
+		std::this_thread::sleep_for(std::chrono::milliseconds{10});  // NOLINT(readability-magic-numbers)
+		auto const ticks_after = profile_ticks();
+		auto const time_after = Clock::now();
+		auto const elapsed_us = std::chrono::duration<double, std::micro>(time_after - time_before).count();
+		return static_cast<double>(ticks_after - ticks_before) / elapsed_us;
+	}();
+	return ratio;
+}
+
+struct ThreadEvents {
+	std::size_t thread_index;
+	std::vector<Event> events;
+};
+
+auto collect_events() -> std::vector<ThreadEvents> {
+	auto& reg = registry();
+	auto const lk = std::lock_guard{reg.mutex};
+	auto threads = std::vector<ThreadEvents>{};
+	threads.reserve(reg.buffers.size());
+	for (auto const& buffer : reg.buffers) {
+		threads.push_back({buffer->thread_index(), buffer->events()});
+	}
+	return threads;
+}
+
+auto category_name(ProfileCategory category) -> char const* {
+	switch (category) {
+	case ProfileCategory::coroutine:
+		return "coroutine";
+	case ProfileCategory::solving:
+		return "solving";
+	case ProfileCategory::observation:
+		return "observation";
+	case ProfileCategory::reward:
+		return "reward";
+	case ProfileCategory::information:
+		return "information";
+	case ProfileCategory::python:
+		return "python";
+	default:
+		return "unknown";
+	}
+}
+
+auto json_escape(std::string_view str) -> std::string {
+	auto escaped = std::string{};
+	escaped.reserve(str.size());
+	for (auto const c : str) {
+		if ((c == '"') || (c == '\\')) {
+			escaped += '\\';
+			escaped += c;
+		} else if (static_cast<unsigned char>(c) < 0x20U) {  // NOLINT(readability-magic-numbers)
+			escaped += fmt::format("\\u{:04x}", static_cast<unsigned>(c));
+		} else {
+			escaped += c;
+		}
+	}
+	return escaped;
+}
+
+/** Names in folded stacks cannot contain the frame separator, nor the space before the count. */
+auto folded_name(std::string_view str) -> std::string {
+	auto name = std::string{str};
+	std::replace(name.begin(), name.end(), ';', '_');
+	std::replace(name.begin(), name.end(), ' ', '_');
+	return name;
+}
+
+/** Readable name of a type from std::type_info::name, which is mangled with GCC and Clang. */
+auto demangle(char const* name) -> std::string {
+#ifdef __GNUG__
+	auto status = 0;
+	auto const demangled =
+		std::unique_ptr<char, decltype(&std::free)>{abi::__cxa_demangle(name, nullptr, nullptr, &status), &std::free};
+	if ((status == 0) && (demangled != nullptr)) {
+		return demangled.get();
+	}
+#endif
+	return name;
+}
+
+/** Remove the namespace and class qualifiers of all names, including template arguments. */
+auto without_namespaces(std::string_view name) -> std::string {
+	auto const is_identifier = [](char c) { return (std::isalnum(static_cast<unsigned char>(c)) != 0) || (c == '_'); };
+	auto result = std::string{};
+	for (std::size_t i = 0; i < name.size(); ++i) {
+		if (name.compare(i, 2, "::") == 0) {
+			// Qualifiers are identifiers, or ``(anonymous namespace)``
+			auto const open = result.rfind('(');
+			if (!result.empty() && (result.back() == ')') && (open != std::string::npos)) {
+				result.erase(open);
+			}
+			while (!result.empty() && is_identifier(result.back())) {
+				result.pop_back();
+			}
+			++i;
+		} else {
+			result += name[i];
+		}
+	}
+	return result;
+}
+
+auto open_file(std::filesystem::path const& filename) -> std::ofstream {
+	auto file = std::ofstream{filename};
+	if (!file) {
+		throw std::runtime_error{fmt::format("Could not open file {}.", filename.string())};
+	}
+	return file;
+}
+
+}  // namespace
+
+auto Profiler::enable() -> void {
+	// Calibrate now rather than when exporting events
+	ticks_per_us();
+	enabled_flag.store(true, std::memory_order_relaxed);
+}
+
+auto Profiler::disable() -> void {
+	enabled_flag.store(false, std::memory_order_relaxed);
+}
+
+auto Profiler::clear() -> void {
+	auto& reg = registry();
+	auto const lk = std::lock_guard{reg.mutex};
+	for (auto const& buffer : reg.buffers) {
+		buffer->clear();
+	}
+}
+
+auto Profiler::set_buffer_capacity(std::size_t capacity) -> void {
+	auto& reg = registry();
+	auto const lk = std::lock_guard{reg.mutex};
+	reg.buffer_capacity = capacity;
+}
+
+auto Profiler::record(
+	char const* name,
+	ProfileCategory category,
+	std::uint64_t start_ticks,
+	std::uint64_t end_ticks) noexcept -> void {
+	try {
+		thread_buffer().push({name, start_ticks, end_ticks, category});
+	} catch (...) {
+		// The buffer of the thread could not be allocated, the event is dropped
+	}
+}
+
+auto Profiler::intern(std::string_view name) -> char const* {
+	auto& reg = registry();
+	auto const lk = std::lock_guard{reg.mutex};
+	auto iter = reg.names.find(name);
+	if (iter == reg.names.end()) {
+		iter = reg.names.emplace(name).first;
+	}
+	return iter->c_str();
+}
+
+auto Profiler::intern(std::type_info const& type) -> char const* {
+	return intern(without_namespaces(demangle(type.name())));
+}
+
+auto Profiler::write_chrome_trace(std::ostream& out) -> void {
+	auto const threads = collect_events();
+	auto origin = std::numeric_limits<std::uint64_t>::max();
+	for (auto const& thread : threads) {
+		for (auto const& event : thread.events) {
+			origin = std::min(origin, event.start_ticks);
+		}
+	}
+
+	auto const scale = ticks_per_us();
+	auto separator = "";
+	out << R"({"displayTimeUnit":"ns","traceEvents":[)";
+	for (auto const& thread : threads) {
+		for (auto const& event : thread.events) {
+			out << separator;
+			out << fmt::format(
+				R"({{"name":"{}","cat":"{}","ph":"X","pid":0,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+				json_escape(event.name),
+				category_name(event.category),
+				thread.thread_index,
+				static_cast<double>(event.start_ticks - origin) / scale,
+				static_cast<double>(event.duration_ticks()) / scale);
+			separator = ",";
+		}
+	}
+	out << "]}\n";
+}
+
+auto Profiler::write_chrome_trace(std::filesystem::path const& filename) -> void {
+	auto file = open_file(filename);
+	write_chrome_trace(file);
+}
+
+auto Profiler::write_flame_graph(std::ostream& out) -> void {
+	// Time spent in every stack, excluding the events nested in it
+	auto self_ticks = std::map<std::string, double>{};
+	for (auto& thread : collect_events()) {
+		auto& events = thread.events;
+		// Enclosing events come before the events they contain
+		std::sort(events.begin(), events.end(), [](auto const& a, auto const& b) {
+			return (a.start_ticks < b.start_ticks) || ((a.start_ticks == b.start_ticks) && (a.end_ticks > b.end_ticks));
+		});
+		// Enclosing events of the current one, with their end and their stack
+		auto stack = std::vector<std::pair<std::uint64_t, std::string>>{};
+		for (auto const& event : events) {
+			while (!stack.empty() && (stack.back().first <= event.start_ticks)) {
+				stack.pop_back();
+			}
+			auto const duration = static_cast<double>(event.duration_ticks());
+			auto path = folded_name(event.name);
+			if (!stack.empty()) {
+				self_ticks[stack.back().second] -= duration;
+				path = stack.back().second + ';' + path;
+			}
+			self_ticks[path] += duration;
+			stack.emplace_back(event.end_ticks, std::move(path));
+		}
+	}
+
+	auto const scale = ticks_per_us();
+	for (auto const& [path, ticks] : self_ticks) {
+		if (auto const us = std::llround(ticks / scale); us > 0) {
+			out << path << ' ' << us << '\n';
+		}
+	}
+}
+
+auto Profiler::write_flame_graph(std::filesystem::path const& filename) -> void {
+	auto file = open_file(filename);
+	write_flame_graph(file);
+}
+
+}  // namespace ecole::utility
@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <stdexcept>
+#include <system_error>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "ecole/utility/thread-pool.hpp"
+
+namespace ecole::utility {
+
+namespace {
+
+#ifdef __linux__
+
+/** Restrict the thread to the given CPU, or remove all restrictions if none is given. */
+void set_affinity(std::thread& thread, std::vector<std::size_t> const& cpus, std::size_t cpu_index) {
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	if (cpus.empty()) {
+		for (std::size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+			CPU_SET(cpu, &cpu_set);
+		}
+	} else {
+		CPU_SET(cpus[cpu_index % cpus.size()], &cpu_set);
+	}
+	auto const return_code = pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set), &cpu_set);
+	if (return_code != 0) {
+		throw std::system_error{return_code, std::generic_category(), "Could not set thread affinity"};
+	}
+}
+
+#else
+
+void set_affinity(std::thread& /*thread*/, std::vector<std::size_t> const& cpus, std::size_t /*cpu_index*/) {
+	if (!cpus.empty()) {
+		throw std::runtime_error{"Thread affinity is not supported on this platform."};
+	}
+}
+
+#endif
+
+}  // namespace
+
+auto ThreadPool::global() -> ThreadPool& {
+	// Never destroyed because executors still running at exit would block forever.
+	// NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+	static auto* const pool = new ThreadPool{std::thread::hardware_concurrency(), Start::lazy};
+	return *pool;
+}
+
+ThreadPool::ThreadPool(std::size_t size, Start start) : m_start{start} {
+	resize(size);
+}
+
+ThreadPool::~ThreadPool() {
+	auto lk = std::unique_lock{m_mutex};
+	m_stopping = true;
+	m_task_signal.notify_all();
+	m_retire_signal.wait(lk, [this] { return m_workers.empty(); });
+	join_finished_workers(lk);
+}
+
+auto ThreadPool::size() const -> std::size_t {
+	auto const lk = std::unique_lock{m_mutex};
+	return m_size;
+}
+
+auto ThreadPool::n_workers() const -> std::size_t {
+	auto const lk = std::unique_lock{m_mutex};
+	return m_workers.size();
+}
+
+auto ThreadPool::resize(std::size_t size) -> void {
+	auto lk = std::unique_lock{m_mutex};
+	m_size = size;
+	while ((m_start == Start::eager) && (m_n_idle < m_size)) {
+		start_worker(lk);
+	}
+	// Let exceeding idle workers terminate
+	m_task_signal.notify_all();
+	join_finished_workers(lk);
+}
+
+auto ThreadPool::pin(std::vector<std::size_t> cpus) -> void {
+	auto const lk = std::unique_lock{m_mutex};
+	m_cpus = std::move(cpus);
+	for (auto& worker : m_workers) {
+		set_affinity(worker.thread, m_cpus, worker.cpu_index);
+	}
+}
+
+auto ThreadPool::push(std::unique_ptr<Task> task) -> void {
+	auto lk = std::unique_lock{m_mutex};
+	m_tasks.push_back(std::move(task));
+	// Idle workers take one task each, including the ones already in the queue
+	if (m_n_idle >= m_tasks.size()) {
+		m_task_signal.notify_one();
+	} else {
+		start_worker(lk);
+	}
+	join_finished_workers(lk);
+}
+
+auto ThreadPool::start_worker(std::unique_lock<std::mutex> const& /*lk*/) -> void {
+	// The worker is counted idle until it takes its first task
+	++m_n_idle;
+	auto& worker = m_workers.emplace_back(Worker{std::thread{[this] { work(); }}, m_n_started++});
+	if (!m_cpus.empty()) {
+		set_affinity(worker.thread, m_cpus, worker.cpu_index);
+	}
+}
+
+auto ThreadPool::join_finished_workers(std::unique_lock<std::mutex>& lk) -> void {
+	auto finished_workers = std::move(m_finished_workers);
+	m_finished_workers.clear();
+	lk.unlock();
+	for (auto& thread : finished_workers) {
+		thread.join();
+	}
+	lk.lock();
+}
+
+auto ThreadPool::work() -> void {
+	auto lk = std::unique_lock{m_mutex};
+	while (true) {
+		m_task_signal.wait(lk, [this] { return !m_tasks.empty() || m_stopping || (m_n_idle > m_size); });
+		--m_n_idle;
+		if (m_tasks.empty()) {
+			break;
+		}
+		auto task = std::move(m_tasks.front());
+		m_tasks.pop_front();
+		lk.unlock();
+		task->run();
+		lk.lock();
+		++m_n_idle;
+		lk.unlock();
+		task->publish();
+		task.reset();
+		lk.lock();
+	}
+
+	// Retire, the thread is joined by the next call to the pool
+	auto const is_self = [id = std::this_thread::get_id()](auto const& worker) { return worker.thread.get_id() == id; };
+	auto const self_iter = std::find_if(m_workers.begin(), m_workers.end(), is_self);
+	m_finished_workers.push_back(std::move(self_iter->thread));
+	m_workers.erase(self_iter);
+	m_retire_signal.notify_all();
+}
+
+}  // namespace ecole::utility
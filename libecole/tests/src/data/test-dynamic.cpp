@@ -1,3 +1,7 @@
+#include <array>
+#include <type_traits>
+#include <utility>
+
 #include <catch2/catch.hpp>
 
 #include "ecole/data/dynamic.hpp"
@@ -34,3 +38,48 @@ TEST_CASE("Dynamic function is polymorphic", "[unit][data]") {
 		REQUIRE(data == double_val + 1);
 	}
 }
+
+namespace {
+
+/** A data function too large to be stored inline. */
+struct LargeDataFunc : IntDataFunc {
+	std::array<char, 1024> padding = {};  // NOLINT(readability-magic-numbers)
+
+	using MockFunction<int>::MockFunction;
+};
+
+}  // namespace
+
+TEST_CASE("Dynamic function stores small functions inline and large ones on the heap", "[unit][data]") {
+	using Data = int;
+	STATIC_REQUIRE(DynamicFunction<Data>::is_stored_inline<IntDataFunc>);
+	STATIC_REQUIRE_FALSE(DynamicFunction<Data>::is_stored_inline<LargeDataFunc>);
+
+	auto model = get_model();
+	auto const make_func = [](bool large, Data val) {
+		return large ? DynamicFunction<Data>{LargeDataFunc{val}} : DynamicFunction<Data>{IntDataFunc{val}};
+	};
+	auto const large = GENERATE(true, false);
+	auto data_func = make_func(large, 1);
+	data_func.before_reset(model);
+
+	SECTION("Copies are independent") {
+		auto copy = data_func;
+		copy.before_reset(model);
+		REQUIRE(data_func.extract(model, false) == 2);
+		REQUIRE(copy.extract(model, false) == 3);
+	}
+
+	SECTION("Moves keep the wrapped function") {
+		auto moved = std::move(data_func);
+		REQUIRE(moved.extract(model, false) == 2);
+		moved = make_func(!large, 4);  // NOLINT(readability-magic-numbers)
+		REQUIRE(moved.extract(model, false) == 4);
+	}
+
+	SECTION("Copy assign over a function of a different type") {
+		auto other = make_func(!large, 4);  // NOLINT(readability-magic-numbers)
+		other = data_func;
+		REQUIRE(other.extract(model, false) == 2);
+	}
+}
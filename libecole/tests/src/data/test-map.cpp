@@ -1,3 +1,5 @@
+#include <cstddef>
+#include <map>
 #include <string>
 #include <type_traits>
 
@@ -26,3 +28,19 @@ TEST_CASE("Combine data extraction functions into a map", "[data]") {
 	REQUIRE(data.at("a") == 2);
 	REQUIRE(data.at("b") == 3);
 }
+
+TEST_CASE("Extract read only data functions concurrently into a map", "[data]") {
+	auto const n_threads = GENERATE(std::size_t{1}, std::size_t{2}, std::size_t{8});
+	auto data_func = MapFunction<std::string, ReadOnlyIntDataFunc>{{{"a", {1}}, {"b", {2}}, {"c", {3}}}, n_threads};
+	auto model = get_model();
+
+	data_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	auto const data = data_func.extract(model, false);
+	REQUIRE(data == std::map<std::string, int>{{"a", 2}, {"b", 3}, {"c", 4}});
+}
+
+TEST_CASE("MapFunction is read only if its functions are", "[unit][data]") {
+	STATIC_REQUIRE(ecole::trait::is_read_only_data_function_v<MapFunction<std::string, ReadOnlyIntDataFunc>>);
+	STATIC_REQUIRE_FALSE(ecole::trait::is_read_only_data_function_v<MapFunction<std::string, IntDataFunc>>);
+}
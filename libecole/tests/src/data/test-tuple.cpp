@@ -1,8 +1,16 @@
+#include <cstddef>
+#include <tuple>
 #include <type_traits>
 
 #include <catch2/catch.hpp>
+#include <scip/scip.h>
+#include <xtensor/xmath.hpp>
 
 #include "ecole/data/tuple.hpp"
+#include "ecole/observation/pseudocosts.hpp"
+#include "ecole/observation/strong-branching-scores.hpp"
+#include "ecole/reward/lp-iterations.hpp"
+#include "ecole/scip/statistics.hpp"
 
 #include "conftest.hpp"
 #include "data/mock-function.hpp"
@@ -10,6 +18,19 @@
 
 using namespace ecole::data;
 
+namespace {
+
+/** Data function modifying the model by solving it. */
+struct SolveFunction {
+	auto before_reset(ecole::scip::Model& /*model*/) -> void {}
+	auto extract(ecole::scip::Model& model, bool /*done*/) -> int {
+		model.solve();
+		return 0;
+	}
+};
+
+}  // namespace
+
 TEST_CASE("Data TupleFunction unit tests", "[unit][data]") {
 	ecole::data::unit_tests(TupleFunction{IntDataFunc{}, DoubleDataFunc{}});
 }
@@ -25,3 +46,50 @@ TEST_CASE("Combine data functions into a tuple", "[data]") {
 	REQUIRE(std::get<0>(data) == 1);
 	REQUIRE(std::get<1>(data) == 2.0);  // NOLINT(readability-magic-numbers)
 }
+
+TEST_CASE("Extract read only data functions concurrently into a tuple", "[data]") {
+	auto const n_threads = GENERATE(std::size_t{1}, std::size_t{3});
+	auto data_func = TupleFunction<ReadOnlyIntDataFunc, IntDataFunc, ReadOnlyIntDataFunc>{{{0}, {1}, {2}}, n_threads};
+	auto model = get_model();
+
+	data_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	REQUIRE(data_func.extract(model, false) == std::tuple{1, 2, 3});
+}
+
+TEST_CASE("TupleFunction is read only if all its functions are", "[unit][data]") {
+	STATIC_REQUIRE(ecole::trait::is_read_only_data_function_v<TupleFunction<ReadOnlyIntDataFunc, ReadOnlyIntDataFunc>>);
+	STATIC_REQUIRE_FALSE(ecole::trait::is_read_only_data_function_v<TupleFunction<ReadOnlyIntDataFunc, IntDataFunc>>);
+}
+
+TEST_CASE("Statistics are read again after data functions that modify the model", "[data]") {
+	using ecole::reward::LpIterations;
+	auto data_func = TupleFunction<LpIterations, SolveFunction, LpIterations>{};
+	auto model = get_model();
+
+	data_func.before_reset(model);
+	auto const step = ecole::scip::StatisticsStep{model.statistics()};
+	auto const data = data_func.extract(model, false);
+	REQUIRE(std::get<0>(data) == 0);
+	REQUIRE(std::get<2>(data) == static_cast<double>(SCIPgetNLPIterations(model.get_scip_ptr())));
+	REQUIRE(std::get<2>(data) > 0);
+}
+
+TEST_CASE("Concurrent extraction of observations matches sequential extraction", "[data][slow]") {
+	using ecole::observation::ExtendedPseudocosts;
+	using ecole::observation::Pseudocosts;
+	using ecole::observation::StrongBranchingScores;
+	using Function = TupleFunction<Pseudocosts, StrongBranchingScores, ExtendedPseudocosts>;
+	auto sequential_func = Function{};
+	auto concurrent_func = Function{{}, 3};
+	auto model = get_model();
+
+	sequential_func.before_reset(model);
+	concurrent_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	auto const [pscosts, sb_scores, ext_pscosts] = sequential_func.extract(model, false);
+	auto const [concurrent_pscosts, concurrent_sb_scores, concurrent_ext_pscosts] = concurrent_func.extract(model, false);
+	REQUIRE(xt::all(xt::isclose(pscosts.value(), concurrent_pscosts.value(), 0., 0., true)));
+	REQUIRE(xt::all(xt::isclose(sb_scores.value(), concurrent_sb_scores.value(), 0., 0., true)));
+	REQUIRE(xt::all(xt::isclose(ext_pscosts->features, concurrent_ext_pscosts->features, 0., 0., true)));
+}
@@ -1,8 +1,12 @@
+#include <cstddef>
 #include <type_traits>
+#include <vector>
 
 #include <catch2/catch.hpp>
 
 #include "ecole/data/vector.hpp"
+#include "ecole/reward/lp-iterations.hpp"
+#include "ecole/scip/statistics.hpp"
 
 #include "conftest.hpp"
 #include "data/mock-function.hpp"
@@ -25,3 +29,44 @@ TEST_CASE("Combine data extraction functions into a vector", "[data]") {
 	REQUIRE(data[0] == 2);
 	REQUIRE(data[1] == 3);
 }
+
+TEST_CASE("Extract read only data functions concurrently into a vector", "[data]") {
+	STATIC_REQUIRE(ecole::trait::is_read_only_data_function_v<ReadOnlyIntDataFunc>);
+	STATIC_REQUIRE_FALSE(ecole::trait::is_read_only_data_function_v<IntDataFunc>);
+	auto const n_threads = GENERATE(std::size_t{1}, std::size_t{2}, std::size_t{8});
+	auto data_func = VectorFunction<ReadOnlyIntDataFunc>{{{1}, {2}, {3}}, n_threads};
+	auto model = get_model();
+
+	data_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	REQUIRE(data_func.extract(model, false) == std::vector{2, 3, 4});
+}
+
+TEST_CASE("Extract nested read only vector functions concurrently", "[data]") {
+	using Inner = VectorFunction<ReadOnlyIntDataFunc>;
+	STATIC_REQUIRE(ecole::trait::is_read_only_data_function_v<Inner>);
+	STATIC_REQUIRE_FALSE(ecole::trait::is_read_only_data_function_v<VectorFunction<IntDataFunc>>);
+	auto const n_threads = GENERATE(std::size_t{1}, std::size_t{3});
+	auto const inner = Inner{{{1}, {2}, {3}}, n_threads};
+	auto data_func = VectorFunction<Inner>{{inner, inner}, n_threads};
+	auto model = get_model();
+
+	data_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	REQUIRE(data_func.extract(model, false) == std::vector<std::vector<int>>{{2, 3, 4}, {2, 3, 4}});
+}
+
+TEST_CASE("Vector of rewards read the solver statistics once per step", "[data]") {
+	using ecole::reward::LpIterations;
+	STATIC_REQUIRE_FALSE(ecole::trait::is_model_modifying_data_function_v<LpIterations>);
+	STATIC_REQUIRE_FALSE(ecole::trait::is_model_modifying_data_function_v<VectorFunction<LpIterations>>);
+	auto data_func = VectorFunction<LpIterations>{std::vector<LpIterations>(3)};
+	auto model = get_model();
+
+	data_func.before_reset(model);
+	auto const step = ecole::scip::StatisticsStep{model.statistics()};
+	REQUIRE(model.statistics().n_lp_iterations(model.get_scip_ptr()) == 0);
+	// Solving outside of a data function does not invalidate the statistics, so only cached values are returned
+	model.solve();
+	REQUIRE(data_func.extract(model, false) == std::vector<ecole::reward::Reward>{0., 0., 0.});
+}
@@ -1,12 +1,18 @@
+#include <algorithm>
+#include <cstddef>
 #include <stdexcept>
 #include <tuple>
 
 #include <catch2/catch.hpp>
+#include <scip/scip.h>
 #include <xtensor/xmath.hpp>
 #include <xtensor/xsort.hpp>
 
 #include "ecole/dynamics/branching.hpp"
 #include "ecole/exception.hpp"
+#include "ecole/observation/strong-branching-scores.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/strong-branching.hpp"
 
 #include "conftest.hpp"
 #include "dynamics/unit-tests.hpp"
@@ -48,6 +54,16 @@ TEST_CASE("BranchingDynamics functional tests", "[dynamics]") {
 		REQUIRE(model.is_solved());
 	}
 
+	SECTION("Solve instance asynchronously") {
+		auto [done, action_set] = dyn.reset_dynamics(model);
+		while (!done) {
+			REQUIRE(action_set.has_value());
+			dyn.step_dynamics_async(model, action_set.value()[0]);
+			std::tie(done, action_set) = dyn.step_dynamics_wait(model);
+		}
+		REQUIRE(model.is_solved());
+	}
+
 	SECTION("Throw on invalid branching variable") {
 		auto const [done, action_set] = dyn.reset_dynamics(model);
 		REQUIRE_FALSE(done);
@@ -65,6 +81,60 @@ TEST_CASE("BranchingDynamics functional tests", "[dynamics]") {
 	}
 }
 
+TEST_CASE("BranchingDynamics reuses strong branching results", "[dynamics]") {
+	auto dyn = dynamics::BranchingDynamics{false, true};
+	auto obs_func = observation::StrongBranchingScores{};
+	auto model = get_model();
+
+	obs_func.before_reset(model);
+	auto [done, action_set] = dyn.reset_dynamics(model);
+	while (!done) {
+		REQUIRE(action_set.has_value());
+		auto const scores = obs_func.extract(model, done).value();
+		auto const& cands = action_set.value();
+		auto const best = std::max_element(cands.begin(), cands.end(), [&scores](auto a, auto b) {
+			return scores(a) < scores(b);
+		});
+		std::tie(done, action_set) = dyn.step_dynamics(model, *best);
+	}
+	REQUIRE(model.is_solved());
+}
+
+TEST_CASE("BranchingDynamics sets children lower bounds from strong branching", "[dynamics]") {
+	auto dyn = dynamics::BranchingDynamics{false, true};
+	auto obs_func = observation::StrongBranchingScores{};
+	auto model = get_model();
+	auto* const scip = model.get_scip_ptr();
+
+	obs_func.before_reset(model);
+	auto [done, action_set] = dyn.reset_dynamics(model);
+	REQUIRE_FALSE(done);
+	REQUIRE(obs_func.extract(model, done).has_value());
+	REQUIRE(SCIPallColsInLP(scip));
+	auto const root_objective = SCIPgetLPObjval(scip);
+
+	// The candidate whose worse child improves the most on the root bound
+	auto best_var = std::size_t{0};
+	auto best_bound = root_objective;
+	for (auto const var_idx : action_set.value()) {
+		auto const* const result = model.strong_branching_cache().find(scip, model.variables()[var_idx]);
+		REQUIRE(result != nullptr);
+		if (result->down_valid && result->up_valid && !result->down_infeasible && !result->up_infeasible) {
+			auto const children_bound = std::min(result->down, result->up);
+			if (children_bound > best_bound) {
+				best_var = var_idx;
+				best_bound = children_bound;
+			}
+		}
+	}
+	REQUIRE(best_bound > root_objective);
+
+	// Without reusing the strong branching result, the child not yet solved would keep the root bound
+	std::tie(done, action_set) = dyn.step_dynamics(model, best_var);
+	REQUIRE_FALSE(done);
+	REQUIRE(SCIPgetLowerbound(scip) >= Approx(best_bound));
+}
+
 TEST_CASE("BranchingDynamics handles limits", "[dynamics]") {
 	bool const pseudo_candidates = GENERATE(true, false);
 	auto dyn = dynamics::BranchingDynamics{pseudo_candidates};
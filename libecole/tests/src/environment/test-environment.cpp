@@ -101,6 +101,16 @@ TEST_CASE("Environments have MDP API", "[env]") {
 		}
 	}
 
+	SECTION("Call reset, step_async, recv, and delete") {
+		auto [obs, action_set, reward, done, info] = env.reset(problem_file);
+		env.step_async(some_action);
+		REQUIRE_THROWS_AS(env.step(some_action), MarkovError);
+		std::tie(obs, action_set, reward, done, info) = env.recv();
+		REQUIRE(env.dynamics().calls == std::vector{Calls::seed, Calls::reset, Calls::step});
+		REQUIRE(env.dynamics().last_action == some_action);
+		REQUIRE_THROWS_AS(env.recv(), MarkovError);
+	}
+
 	SECTION("Cannot transition without reseting") { REQUIRE_THROWS_AS(env.step(some_action), MarkovError); }
 
 	SECTION("Cannot transition past termination") {
@@ -0,0 +1,151 @@
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/dynamics/branching.hpp"
+#include "ecole/environment/vector.hpp"
+#include "ecole/information/nothing.hpp"
+#include "ecole/none.hpp"
+#include "ecole/observation/node-bipartite.hpp"
+#include "ecole/observation/nothing.hpp"
+#include "ecole/reward/constant.hpp"
+#include "ecole/reward/lp-iterations.hpp"
+#include "ecole/utility/coroutine.hpp"
+
+#include "conftest.hpp"
+#include "utility/coroutine-options.hpp"
+
+/****************************************
+ *  Mocking some classes for unit test  *
+ ****************************************/
+
+namespace ecole::dynamics {
+
+/**
+ * Dummy dynamics where the action is the number of remaining steps before the terminal state.
+ */
+struct CountdownDynamics {
+	using Action = std::size_t;
+	using ActionSet = std::size_t;
+
+	std::size_t n_resets = 0;
+	std::thread::id thread;
+	bool changed_thread = false;
+
+	auto set_dynamics_random_state(scip::Model& /*model*/, RandomGenerator& /*rng*/) -> void {}
+
+	auto reset_dynamics(scip::Model& /*model*/) -> std::tuple<bool, ActionSet> {
+		record_thread();
+		++n_resets;
+		return {false, n_resets};
+	}
+
+	auto step_dynamics(scip::Model& /*model*/, std::size_t const& action) -> std::tuple<bool, ActionSet> {
+		record_thread();
+		return {action == 0, n_resets};
+	}
+
+	/** Catch assertions are not thread safe, so the thread is checked after the transition. */
+	auto record_thread() -> void {
+		auto const current = std::this_thread::get_id();
+		changed_thread = changed_thread || ((thread != std::thread::id{}) && (thread != current));
+		thread = current;
+	}
+};
+
+}  // namespace ecole::dynamics
+
+/****************************
+ *  Test VectorEnvironment  *
+ ****************************/
+
+using namespace ecole;
+
+using TestVectorEnv = environment::
+	VectorEnvironment<dynamics::CountdownDynamics, observation::Nothing, reward::Constant, information::Nothing>;
+
+TEST_CASE("Vector environments transition all environments", "[env]") {
+	auto constexpr n_envs = std::size_t{5};
+	auto const n_threads = GENERATE(std::size_t{1}, std::size_t{3}, std::size_t{8});
+	auto n_instances = std::size_t{0};
+	auto const instance_source = [&n_instances] {
+		++n_instances;
+		return scip::Model::from_file(problem_file);
+	};
+	auto env = TestVectorEnv{std::vector<TestVectorEnv::Environment>(n_envs), instance_source, n_threads};
+	REQUIRE(env.size() == n_envs);
+
+	SECTION("Reset all environments") {
+		auto const transition = env.reset();
+		REQUIRE(n_instances == n_envs);
+		REQUIRE(transition.action_sets == std::vector<std::size_t>(n_envs, 1));
+		REQUIRE(transition.rewards.size() == n_envs);
+		for (std::size_t i = 0; i < n_envs; ++i) {
+			REQUIRE_FALSE(transition.dones(i));
+		}
+	}
+
+	SECTION("Automatically reset finished environments") {
+		env.reset();
+		auto const transition = env.step({0, 1, 0, 1, 1});
+		REQUIRE(n_instances == n_envs + 2);
+		REQUIRE(transition.dones(0));
+		REQUIRE_FALSE(transition.dones(1));
+		REQUIRE(transition.action_sets == std::vector<std::size_t>{2, 1, 2, 1, 1});
+	}
+
+	SECTION("Transition every environment on the same thread") {
+		env.reset();
+		for (std::size_t i = 0; i < n_envs; ++i) {
+			env.step({1, 0, 1, 0, 1});
+		}
+		for (auto& sub_env : env.environments()) {
+			REQUIRE_FALSE(sub_env.dynamics().changed_thread);
+		}
+	}
+
+	SECTION("Reject wrong number of actions") {
+		env.reset();
+		REQUIRE_THROWS_AS(env.step({1, 1}), std::invalid_argument);
+	}
+}
+
+TEST_CASE("Vector environments run branching environments in parallel", "[env][slow]") {
+	using BranchingVectorEnv = environment::VectorEnvironment<
+		dynamics::BranchingDynamics,
+		observation::NodeBipartite,
+		reward::LpIterations,
+		information::Nothing>;
+	auto constexpr n_envs = std::size_t{4};
+	auto constexpr n_steps = 20;
+	auto const n_threads = GENERATE(std::size_t{2}, std::size_t{3});
+	// Fibers must always be resumed on the same thread
+	auto options = utility::default_coroutine_options();
+	options.backend = GENERATE(
+		utility::CoroutineBackend::thread, utility::CoroutineBackend::spin_thread, utility::CoroutineBackend::fiber);
+	auto const options_guard = utility::DefaultCoroutineOptionsGuard{options};
+
+	auto env = BranchingVectorEnv{
+		std::vector<BranchingVectorEnv::Environment>(n_envs),
+		[] { return get_model(); },
+		n_threads,
+	};
+	auto transition = env.reset();
+	for (auto step = 0; step < n_steps; ++step) {
+		auto actions = std::vector<BranchingVectorEnv::Action>{};
+		for (auto const& action_set : transition.action_sets) {
+			REQUIRE(action_set.has_value());
+			REQUIRE(action_set->size() > 0);
+			actions.push_back((*action_set)(0));
+		}
+		transition = env.step(actions);
+		REQUIRE(transition.rewards.size() == n_envs);
+		for (std::size_t i = 0; i < n_envs; ++i) {
+			REQUIRE(transition.rewards(i) >= 0);
+		}
+	}
+}
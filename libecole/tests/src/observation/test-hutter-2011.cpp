@@ -3,9 +3,12 @@
 #include <type_traits>
 
 #include <catch2/catch.hpp>
+#include <scip/scip.h>
 #include <xtensor/xview.hpp>
 
 #include "ecole/observation/hutter-2011.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/utils.hpp"
 
 #include "conftest.hpp"
 #include "observation/unit-tests.hpp"
@@ -127,3 +130,63 @@ TEST_CASE("Hutter2011 return correct observation", "[obs]") {
 		}
 	}
 }
+
+TEST_CASE("Hutter2011 approximate degrees are close to exact degrees", "[obs]") {
+	using Features = observation::Hutter2011Obs::Features;
+	auto get_feature = [](auto const& obs, auto feat) { return obs.features[static_cast<std::size_t>(feat)]; };
+
+	auto model = get_model();
+	auto const exact_obs = observation::Hutter2011{}.extract(model, false).value();
+
+	SECTION("Degrees smaller than the sketch size are exact") {
+		auto const n_var = static_cast<std::size_t>(get_feature(exact_obs, Features::nb_variables));
+		auto const approx_obs = observation::Hutter2011{true, n_var + 1}.extract(model, false).value();
+		REQUIRE(approx_obs.features == exact_obs.features);
+	}
+
+	SECTION("Degrees estimated with a small sketch are within the error") {
+		auto const approx_obs = observation::Hutter2011{true, 64}.extract(model, false).value();
+		for (auto const feat : {Features::node_degree_mean, Features::edge_density}) {
+			auto const exact = get_feature(exact_obs, feat);
+			REQUIRE(get_feature(approx_obs, feat) == Approx(exact).epsilon(0.3));
+		}
+		auto const nb_var = get_feature(approx_obs, Features::nb_variables);
+		REQUIRE(is_sorted(0., get_feature(approx_obs, Features::node_degree_min), nb_var));
+	}
+}
+
+TEST_CASE("Hutter2011 direct LP relaxation matches the relaxation of a copy", "[obs]") {
+	using Features = observation::Hutter2011Obs::Features;
+	auto get_feature = [](auto const& obs, auto feat) { return obs.features[static_cast<std::size_t>(feat)]; };
+
+	auto model = get_model();
+	auto const copy_obs = observation::Hutter2011{}.extract(model, false).value();
+	auto obs_func = observation::Hutter2011{false, 256, true};
+	obs_func.before_reset(model);
+	auto const direct_obs = obs_func.extract(model, false).value();
+
+	auto const lp_objective = get_feature(copy_obs, Features::lp_objective_value);
+	REQUIRE(get_feature(direct_obs, Features::lp_objective_value) == Approx(lp_objective));
+
+	// Scaling the objective changes the value of the LP relaxation, unless it is reused
+	auto const scale_objective = [](scip::Model& some_model) {
+		for (auto* const var : some_model.variables()) {
+			scip::call(SCIPchgVarObj, some_model.get_scip_ptr(), var, 2. * SCIPvarGetObj(var));
+		}
+	};
+
+	SECTION("Repeated extractions reuse the relaxation") {
+		scale_objective(model);
+		auto const fresh_obs = observation::Hutter2011{false, 256, true}.extract(model, false).value();
+		REQUIRE_FALSE(get_feature(fresh_obs, Features::lp_objective_value) == Approx(lp_objective));
+		auto const reused_obs = obs_func.extract(model, false).value();
+		REQUIRE(get_feature(reused_obs, Features::lp_objective_value) == Approx(lp_objective));
+	}
+
+	SECTION("Other models do not reuse the relaxation") {
+		auto other_model = model.copy_orig();
+		scale_objective(other_model);
+		auto const other_obs = obs_func.extract(other_model, false).value();
+		REQUIRE_FALSE(get_feature(other_obs, Features::lp_objective_value) == Approx(lp_objective));
+	}
+}
@@ -1,3 +1,5 @@
+#include <cstddef>
+
 #include <catch2/catch.hpp>
 #include <range/v3/view/enumerate.hpp>
 #include <range/v3/view/transform.hpp>
@@ -163,3 +165,56 @@ TEST_CASE("Khalil2016 return correct observation", "[obs]") {
 		}
 	}
 }
+
+TEST_CASE("Khalil2016 extracts in place in an existing observation", "[obs]") {
+	auto obs_func = observation::Khalil2016{};
+	auto model = get_model();
+	obs_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	auto obs = obs_func.extract(model, false).value();
+	auto const* const features_data = obs.features.data();
+	auto const expected = obs.features;
+
+	REQUIRE(obs_func.extract_into(model, false, obs));
+	REQUIRE(obs.features.data() == features_data);
+	REQUIRE(xt::all(xt::isclose(obs.features, expected, 0., 0., true)));
+}
+
+TEST_CASE("Khalil2016 compact observation only has the candidates rows", "[obs]") {
+	auto const pseudo = GENERATE(true, false);
+	auto obs_func = observation::Khalil2016{pseudo};
+	auto compact_func = observation::Khalil2016{pseudo, true};
+	auto model = get_model();
+	obs_func.before_reset(model);
+	compact_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	auto const obs = obs_func.extract(model, false).value();
+	auto const compact_obs = compact_func.extract(model, false).value();
+
+	auto const branch_cands = pseudo ? model.pseudo_branch_cands() : model.lp_branch_cands();
+	REQUIRE(compact_obs.candidates == obs.candidates);
+	REQUIRE(compact_obs.candidates.size() == branch_cands.size());
+	REQUIRE(compact_obs.features.shape(0) == branch_cands.size());
+	for (std::size_t i = 0; i < branch_cands.size(); ++i) {
+		auto const var_idx = compact_obs.candidates[i];
+		REQUIRE(var_idx == static_cast<std::size_t>(SCIPvarGetProbindex(branch_cands[i])));
+		auto const compact_row = xt::row(compact_obs.features, static_cast<std::ptrdiff_t>(i));
+		auto const row = xt::row(obs.features, static_cast<std::ptrdiff_t>(var_idx));
+		REQUIRE(xt::all(xt::isclose(compact_row, row, 0., 0., true)));
+	}
+}
+
+TEST_CASE("Khalil2016 computes the same features with multiple threads", "[obs]") {
+	auto const compact = GENERATE(true, false);
+	auto obs_func = observation::Khalil2016{false, compact};
+	auto parallel_func = observation::Khalil2016{false, compact, 4};
+	auto model = get_model();
+	obs_func.before_reset(model);
+	parallel_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	auto const obs = obs_func.extract(model, false).value();
+	auto const parallel_obs = parallel_func.extract(model, false).value();
+
+	REQUIRE(parallel_obs.candidates == obs.candidates);
+	REQUIRE(xt::all(xt::isclose(parallel_obs.features, obs.features, 0., 0., true)));
+}
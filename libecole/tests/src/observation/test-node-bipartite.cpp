@@ -1,9 +1,12 @@
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 #include <catch2/catch.hpp>
 #include <xtensor/xmath.hpp>
 #include <xtensor/xview.hpp>
 
+#include "ecole/dynamics/branching.hpp"
 #include "ecole/observation/node-bipartite.hpp"
 
 #include "conftest.hpp"
@@ -12,7 +15,8 @@
 using namespace ecole;
 
 TEST_CASE("NodeBipartite unit tests", "[unit][obs]") {
-	observation::unit_tests(observation::NodeBipartite{});
+	auto const incremental = GENERATE(true, false);
+	observation::unit_tests(observation::NodeBipartite{false, incremental});
 }
 
 TEST_CASE("NodeBipartite return correct observation", "[obs]") {
@@ -53,3 +57,91 @@ TEST_CASE("NodeBipartite return correct observation", "[obs]") {
 		REQUIRE_FALSE(xt::all(xt::isnan(obs.row_features)));
 	}
 }
+
+TEST_CASE("NodeBipartite kept between extractions matches full extraction", "[obs][slow]") {
+	auto const [cache, incremental, track_columns] = GENERATE(table<bool, bool, bool>({
+		{false, true, false},
+		{false, true, true},
+		{true, false, true},
+	}));
+	auto full_func = observation::NodeBipartite{};
+	auto incremental_func = observation::NodeBipartite{cache, incremental, track_columns};
+	auto dyn = dynamics::BranchingDynamics{};
+	// Cutting planes are kept to have rows added and removed from the LP, unless caching which does not support them
+	auto model = cache ? get_model() : scip::Model::from_file(problem_file);
+	full_func.before_reset(model);
+	incremental_func.before_reset(model);
+
+	auto constexpr max_steps = 20;
+	auto [done, action_set] = dyn.reset_dynamics(model);
+	for (auto step = 0; (step < max_steps) && !done; ++step) {
+		auto const full_obs = full_func.extract(model, false).value();
+		auto const incremental_obs = incremental_func.extract(model, false).value();
+		REQUIRE(incremental_obs.edge_features == full_obs.edge_features);
+		REQUIRE(incremental_obs.row_features == full_obs.row_features);
+		REQUIRE(xt::all(xt::isclose(incremental_obs.variable_features, full_obs.variable_features, 0., 0., true)));
+		std::tie(done, action_set) = dyn.step_dynamics(model, action_set.value()[0]);
+	}
+}
+
+TEST_CASE("NodeBipartite extracts in place in an existing observation", "[obs]") {
+	auto obs_func = observation::NodeBipartite{};
+	auto model = get_model();
+	obs_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	auto obs = obs_func.extract(model, false).value();
+	auto const* const variable_features_data = obs.variable_features.data();
+	auto const* const edge_values_data = obs.edge_features.values.data();
+	auto const expected = obs;
+
+	REQUIRE(obs_func.extract_into(model, false, obs));
+	REQUIRE(obs.variable_features.data() == variable_features_data);
+	REQUIRE(obs.edge_features.values.data() == edge_values_data);
+	REQUIRE(obs.edge_features == expected.edge_features);
+	REQUIRE(obs.row_features == expected.row_features);
+	REQUIRE(xt::all(xt::isclose(obs.variable_features, expected.variable_features, 0., 0., true)));
+}
+
+TEST_CASE("NodeBipartite32 matches NodeBipartite in single precision", "[obs]") {
+	auto model = get_model();
+	auto obs_func = observation::NodeBipartite{};
+	auto obs_func32 = observation::NodeBipartite32{};
+	obs_func.before_reset(model);
+	obs_func32.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	auto const obs = obs_func.extract(model, false).value();
+	auto const obs32 = obs_func32.extract(model, false).value();
+
+	STATIC_REQUIRE(std::is_same_v<decltype(obs32.variable_features)::value_type, float>);
+	STATIC_REQUIRE(std::is_same_v<decltype(obs32.edge_features.indices)::value_type, std::int32_t>);
+	REQUIRE(obs32.edge_features.shape == obs.edge_features.shape);
+	REQUIRE(obs32.edge_features.indices == xt::cast<std::int32_t>(obs.edge_features.indices));
+	REQUIRE(obs32.edge_features.values == xt::cast<float>(obs.edge_features.values));
+	REQUIRE(obs32.row_features == xt::cast<float>(obs.row_features));
+	REQUIRE(xt::all(xt::isclose(obs32.variable_features, xt::cast<float>(obs.variable_features), 0., 0., true)));
+}
+
+TEST_CASE("NodeBipartiteCsr edges match NodeBipartite edges", "[obs][slow]") {
+	auto const incremental = GENERATE(true, false);
+	auto coo_func = observation::NodeBipartite{};
+	auto csr_func = observation::NodeBipartiteCsr{false, incremental};
+	auto dyn = dynamics::BranchingDynamics{};
+	// Cutting planes are kept to have rows added and removed from the LP
+	auto model = scip::Model::from_file(problem_file);
+	coo_func.before_reset(model);
+	csr_func.before_reset(model);
+
+	auto constexpr max_steps = 10;
+	auto [done, action_set] = dyn.reset_dynamics(model);
+	for (auto step = 0; (step < max_steps) && !done; ++step) {
+		auto const coo_obs = coo_func.extract(model, false).value();
+		auto const csr_obs = csr_func.extract(model, false).value();
+		auto const expected = utility::to_csr(coo_obs.edge_features);
+		REQUIRE(csr_obs.edge_features.shape == expected.shape);
+		REQUIRE(csr_obs.edge_features.values == expected.values);
+		REQUIRE(csr_obs.edge_features.column_indices == xt::cast<std::int64_t>(expected.column_indices));
+		REQUIRE(csr_obs.edge_features.row_pointers == xt::cast<std::int64_t>(expected.row_pointers));
+		REQUIRE(csr_obs.row_features == coo_obs.row_features);
+		std::tie(done, action_set) = dyn.step_dynamics(model, action_set.value()[0]);
+	}
+}
@@ -1,7 +1,9 @@
 #include <cmath>
+#include <cstddef>
 
 #include <catch2/catch.hpp>
 #include <scip/scip.h>
+#include <xtensor/xview.hpp>
 
 #include "ecole/observation/pseudocosts.hpp"
 
@@ -33,3 +35,42 @@ TEST_CASE("Pseudocosts return pseudo costs array", "[obs]") {
 		REQUIRE(pseudocost > 0);
 	}
 }
+
+TEST_CASE("ExtendedPseudocosts unit tests", "[unit][obs]") {
+	observation::unit_tests(observation::ExtendedPseudocosts{});
+}
+
+TEST_CASE("ExtendedPseudocosts return pseudocosts statistics of candidates", "[obs]") {
+	using Features = observation::ExtendedPseudocostsObs::Features;
+	auto obs_func = observation::ExtendedPseudocosts{};
+	auto model = get_model();
+	obs_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	auto obs = obs_func.extract(model, false);
+
+	REQUIRE(obs.has_value());
+	auto const& features = obs.value().features;
+	auto const& candidates = obs.value().candidates;
+	auto const branch_cands = model.lp_branch_cands();
+	REQUIRE(features.shape(0) == branch_cands.size());
+	REQUIRE(features.shape(1) == observation::ExtendedPseudocostsObs::n_features);
+	REQUIRE(candidates.size() == branch_cands.size());
+
+	// The score is the one of the Pseudocosts observation
+	auto const costs = observation::Pseudocosts{}.extract(model, false).value();
+	for (std::size_t cand_idx = 0; cand_idx < candidates.size(); ++cand_idx) {
+		REQUIRE(candidates[cand_idx] == static_cast<std::size_t>(SCIPvarGetProbindex(branch_cands[cand_idx])));
+		auto const row = xt::row(features, cand_idx);
+		REQUIRE(row[static_cast<std::size_t>(Features::score)] == costs[candidates[cand_idx]]);
+		REQUIRE(row[static_cast<std::size_t>(Features::count_down)] >= 0);
+		REQUIRE(row[static_cast<std::size_t>(Features::count_up)] >= 0);
+		REQUIRE(row[static_cast<std::size_t>(Features::variance_down)] >= 0);
+		REQUIRE(row[static_cast<std::size_t>(Features::variance_up)] >= 0);
+	}
+
+	SECTION("Extract in place in the same observation") {
+		auto const* const data = obs.value().features.data();
+		REQUIRE(obs_func.extract_into(model, false, obs.value()));
+		REQUIRE(obs.value().features.data() == data);
+	}
+}
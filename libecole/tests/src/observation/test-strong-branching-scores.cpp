@@ -1,8 +1,17 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
 #include <catch2/catch.hpp>
+#include <scip/scipdefplugins.h>
+#include <scip/struct_branch.h>
 #include <xtensor/xindex_view.hpp>
 #include <xtensor/xmath.hpp>
 
 #include "ecole/observation/strong-branching-scores.hpp"
+#include "ecole/scip/strong-branching.hpp"
+#include "ecole/scip/utils.hpp"
 
 #include "conftest.hpp"
 #include "observation/unit-tests.hpp"
@@ -29,3 +38,110 @@ TEST_CASE("StrongBranchingScores return correct branchig scores", "[obs]") {
 	REQUIRE(not_nan_scores.size() > 0);
 	REQUIRE(xt::all(not_nan_scores >= 0));
 }
+
+TEST_CASE("StrongBranchingScores extracts in place in an existing buffer", "[obs]") {
+	auto obs_func = observation::StrongBranchingScores{};
+	auto model = get_model();
+	obs_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+
+	SECTION("Write scores in a buffer with one element per variable") {
+		auto scores = xt::xtensor<double, 1>::from_shape({model.variables().size()});
+		REQUIRE(obs_func.extract_into(model, false, {scores.data(), scores.size()}));
+		REQUIRE(xt::any(!xt::isnan(scores)));
+	}
+
+	SECTION("Reject buffers of the wrong size") {
+		auto scores = xt::xtensor<double, 1>::from_shape({model.variables().size() + 1});
+		REQUIRE_THROWS_AS(obs_func.extract_into(model, false, {scores.data(), scores.size()}), std::invalid_argument);
+	}
+}
+
+/** Scores computed by running the vanillafullstrong branching rule configured to only compute scores. */
+auto vanillafullstrong_scores(scip::Model& model, bool pseudo_candidates) -> xt::xtensor<double, 1> {
+	model.set_param("branching/vanillafullstrong/integralcands", pseudo_candidates);
+	model.set_param("branching/vanillafullstrong/scoreall", true);
+	model.set_param("branching/vanillafullstrong/collectscores", true);
+	model.set_param("branching/vanillafullstrong/donotbranch", true);
+	model.set_param("branching/vanillafullstrong/idempotent", true);
+
+	auto* const scip = model.get_scip_ptr();
+	auto* const branchrule = SCIPfindBranchrule(scip, "vanillafullstrong");
+	SCIP_RESULT result;
+	scip::call(branchrule->branchexeclp, scip, branchrule, false, &result);
+	SCIP_VAR** cands = nullptr;
+	SCIP_Real* cands_scores = nullptr;
+	int n_cands = 0;
+	SCIPgetVanillafullstrongData(scip, &cands, &cands_scores, &n_cands, nullptr, nullptr);
+
+	auto scores = xt::xtensor<double, 1>::from_shape({model.variables().size()});
+	scores.fill(std::nan(""));
+	for (int i = 0; i < n_cands; ++i) {
+		scores[static_cast<std::size_t>(SCIPvarGetProbindex(cands[i]))] = cands_scores[i];
+	}
+	return scores;
+}
+
+TEST_CASE("StrongBranchingScores match the scores of the vanillafullstrong branching rule", "[obs]") {
+	bool pseudo_candidates = GENERATE(true, false);
+	auto obs_func = observation::StrongBranchingScores{pseudo_candidates};
+	auto model = get_model();
+	obs_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+
+	auto const scores = obs_func.extract(model, false).value();
+	auto const expected = vanillafullstrong_scores(model, pseudo_candidates);
+	REQUIRE(xt::all(xt::isclose(scores, expected, 1e-6, 1e-9, true)));
+}
+
+TEST_CASE("StrongBranchingScores can score a subset of candidates", "[obs]") {
+	auto constexpr max_candidates = std::size_t{2};
+	bool const sample_candidates = GENERATE(true, false);
+	auto obs_func = observation::StrongBranchingScores{false, max_candidates, sample_candidates, 100};
+	auto model = get_model();
+	obs_func.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+
+	auto const scores = obs_func.extract(model, false).value();
+	auto const n_scored = std::count_if(scores.begin(), scores.end(), [](auto score) { return !std::isnan(score); });
+	REQUIRE(static_cast<std::size_t>(n_scored) == std::min(max_candidates, model.lp_branch_cands().size()));
+	auto const not_nan_scores = xt::filter(scores, !xt::isnan(scores));
+	REQUIRE(xt::all(not_nan_scores >= 0));
+}
+
+TEST_CASE("StrongBranchingScores on LP copies do not depend on the number of threads", "[obs]") {
+	bool pseudo_candidates = GENERATE(true, false);
+	auto model = get_model();
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	auto const extract_with = [&model, pseudo_candidates](std::size_t n_threads) {
+		auto obs_func = observation::StrongBranchingScores{pseudo_candidates, {}, false, 100, n_threads};
+		obs_func.before_reset(model);
+		return obs_func.extract(model, false).value();
+	};
+
+	auto const serial_scores = extract_with(1);
+	auto const parallel_scores = extract_with(4);
+	REQUIRE(xt::any(!xt::isnan(serial_scores)));
+	// Exactly equal, NaN included
+	REQUIRE(xt::all(xt::isclose(serial_scores, parallel_scores, 0., 0., true)));
+	auto const not_nan_scores = xt::filter(parallel_scores, !xt::isnan(parallel_scores));
+	REQUIRE(xt::all(not_nan_scores >= 0));
+}
+
+TEST_CASE("Strong branching on LP copies matches SCIP strong branching", "[obs]") {
+	auto const n_threads = GENERATE(std::size_t{1}, std::size_t{4});
+	auto model = get_model();
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	auto* const scip = model.get_scip_ptr();
+	auto const cands = model.lp_branch_cands();
+
+	auto const parallel_results = scip::strong_branch_parallel(scip, cands, n_threads);
+	auto const serial_results = scip::strong_branch(scip, cands);
+	REQUIRE(serial_results.size() == cands.size());
+	REQUIRE(parallel_results.size() == serial_results.size());
+	for (std::size_t i = 0; i < serial_results.size(); ++i) {
+		REQUIRE(parallel_results[i].var == serial_results[i].var);
+		// SCIP reuses LP information between candidates, which can slightly change the children LP solutions
+		REQUIRE(parallel_results[i].score == Approx(serial_results[i].score).epsilon(1e-6).margin(1e-9));
+	}
+}
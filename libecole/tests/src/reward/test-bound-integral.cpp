@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
 #include <catch2/catch.hpp>
+#include <scip/scip.h>
 
 #include "ecole/reward/bound-integral.hpp"
 
@@ -48,3 +53,41 @@ TEST_CASE("DualInPrimalDualIntegraltegral returns the difference in dual integra
 		REQUIRE(reward_func.extract(model) >= 0);
 	}
 }
+
+TEST_CASE("BoundIntegral with a time quantum integrates the same bounds", "[reward]") {
+	auto constexpr time_quantum = 0.01;
+	auto reward_func = reward::PrimalDualIntegral{true, {}, time_quantum};
+	auto model = get_model();
+	reward_func.before_reset(model);
+	model.solve();
+	auto const integral = reward_func.extract(model);
+	REQUIRE(integral >= 0);
+	// A second extraction only integrates the time in between
+	REQUIRE(reward_func.extract(model) <= integral);
+}
+
+TEST_CASE("BoundIntegral with a time quantum is close to the exact integral", "[reward][slow]") {
+	// Clip the bounds around the optimal value so that the integrand is bounded and decreasing
+	auto optimum_model = get_model();
+	optimum_model.solve();
+	auto const optimum = SCIPgetPrimalbound(optimum_model.get_scip_ptr());
+	auto const half_width = std::max(1., std::abs(optimum));
+	auto const bound_function = [&](scip::Model& /*model*/) -> std::tuple<Reward, Reward> {
+		return {optimum + half_width, optimum - half_width};
+	};
+
+	auto constexpr time_quantum = 0.05;
+	auto exact_func = reward::PrimalDualIntegral{true, bound_function};
+	auto quantum_func = reward::PrimalDualIntegral{true, bound_function, time_quantum};
+	auto model = get_model();
+	exact_func.before_reset(model);
+	quantum_func.before_reset(model);
+	model.solve();
+	auto const exact = exact_func.extract(model);
+	auto const quantum = quantum_func.extract(model);
+
+	// Within a group, the integrand is off by at most its decrease over the group, for less than a quantum and the
+	// resolution of the coarse clock, taken as another quantum.
+	auto const tolerance = 2 * time_quantum * (2 * half_width);
+	REQUIRE(quantum == Approx(exact).margin(tolerance));
+}
@@ -0,0 +1,106 @@
+#include <cmath>
+#include <stdexcept>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/reward/expression.hpp"
+#include "ecole/reward/lp-iterations.hpp"
+#include "ecole/reward/n-nodes.hpp"
+
+#include "conftest.hpp"
+#include "reward/unit-tests.hpp"
+
+using namespace ecole;
+
+namespace {
+
+/** Extract the reward of a formula once the root node is processed. */
+auto extract_at_root(reward::Expression expression) {
+	auto model = get_model();
+	expression.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	return expression.extract(model);
+}
+
+}  // namespace
+
+TEST_CASE("Expression unit tests", "[unit][reward]") {
+	reward::unit_tests(reward::Expression{"-1 * LpIterations() + 0.1 * NNodes()"});
+}
+
+TEST_CASE("Expression computes constant formulas", "[reward]") {
+	auto model = get_model();
+	auto const reward_of = [&model](char const* formula) {
+		auto expression = reward::Expression{formula};
+		expression.before_reset(model);
+		return expression.extract(model);
+	};
+
+	REQUIRE(reward::Expression{}.extract(model) == 0);
+	REQUIRE(reward_of("1 + 2 * 3") == 7);
+	REQUIRE(reward_of("(1 + 2) * 3") == 9);
+	REQUIRE(reward_of("10 - 2 - 3") == 5);
+	REQUIRE(reward_of("8 / 2 / 2") == 2);
+	REQUIRE(reward_of("-2 ** 2") == -4);
+	REQUIRE(reward_of("2 ** 3 ** 2") == 512);
+	REQUIRE(reward_of("2 ** -1") == 0.5);
+	REQUIRE(reward_of("abs(-3) + log10(100) + (16).sqrt()") == 9);
+	REQUIRE(reward_of("min(3, 1, 2) + max(3, 1e1)") == 11);
+	REQUIRE(std::isinf(reward_of("1 / 0")));
+}
+
+TEST_CASE("Expression computes formulas of reward functions", "[reward]") {
+	auto model = get_model();
+	auto lp_iterations = reward::LpIterations{};
+	auto n_nodes = reward::NNodes{};
+	lp_iterations.before_reset(model);
+	n_nodes.before_reset(model);
+	advance_to_stage(model, SCIP_STAGE_SOLVING);
+	auto const expected = -1 * lp_iterations.extract(model) + 0.1 * n_nodes.extract(model);
+
+	REQUIRE(extract_at_root(reward::Expression{"-1 * LpIterations() + 0.1 * NNodes()"}) == Approx(expected));
+
+	SECTION("Functions appearing multiple times are extracted once") {
+		REQUIRE(extract_at_root(reward::Expression{"LpIterations() - LpIterations()"}) == 0);
+		REQUIRE(extract_at_root(reward::Expression{"LpIterations() * 0 + NNodes()"}) == 1);
+	}
+
+	SECTION("Cumulative sums are reset") {
+		auto expression = reward::Expression{"NNodes().cumsum() + cumsum(1)"};
+		expression.before_reset(model);
+		REQUIRE(expression.extract(model) == 2);
+		REQUIRE(expression.extract(model) == 3);
+		// The nodes are counted anew after a reset
+		expression.before_reset(model);
+		REQUIRE(expression.extract(model) == 2);
+	}
+}
+
+TEST_CASE("Expression builds plans incrementally", "[reward]") {
+	auto builder = reward::Expression::Builder{};
+
+	SECTION("Build a valid plan") {
+		auto const index = builder.add_function(reward::NNodes{});
+		builder.push_function(index);
+		builder.push_constant(2);
+		builder.push_operator(reward::Expression::Operator::power);
+		REQUIRE(extract_at_root(builder.build("NNodes() ** 2")) == 1);
+	}
+
+	SECTION("Reject operators without operands") {
+		builder.push_constant(2);
+		REQUIRE_THROWS_AS(builder.push_operator(reward::Expression::Operator::add), std::invalid_argument);
+	}
+
+	SECTION("Reject plans without a single result") {
+		builder.push_constant(1);
+		builder.push_constant(2);
+		REQUIRE_THROWS_AS(builder.build("1 2"), std::invalid_argument);
+	}
+}
+
+TEST_CASE("Expression rejects malformed formulas", "[reward]") {
+	auto const formula = GENERATE(
+		"", "1 +", "(1", "1 2", "Unknown()", "LpIterations(wall=True)", "SolvingTime(wall=1)", "exp()", "1 .unknown()");
+	REQUIRE_THROWS_AS(reward::Expression{formula}, std::invalid_argument);
+}
@@ -0,0 +1,48 @@
+#include <catch2/catch.hpp>
+#include <scip/scip.h>
+
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/statistics.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+
+TEST_CASE("Statistics are cached during a step", "[scip]") {
+	auto model = get_model();
+	auto* const scip = model.get_scip_ptr();
+	auto& statistics = model.statistics();
+	REQUIRE_FALSE(statistics.in_step());
+
+	SECTION("Read the solver outside of a step") {
+		REQUIRE(statistics.n_lp_iterations(scip) == 0);
+		model.solve();
+		REQUIRE(statistics.n_lp_iterations(scip) == SCIPgetNLPIterations(scip));
+		REQUIRE(statistics.n_total_nodes(scip) == SCIPgetNTotalNodes(scip));
+	}
+
+	SECTION("Return the same values during a step") {
+		{
+			auto const step = scip::StatisticsStep{statistics};
+			REQUIRE(statistics.in_step());
+			auto const time = statistics.time(true);
+			REQUIRE(statistics.n_lp_iterations(scip) == 0);
+			model.solve();
+			REQUIRE(statistics.n_lp_iterations(scip) == 0);
+			REQUIRE(statistics.time(true) == time);
+		}
+		REQUIRE_FALSE(statistics.in_step());
+		REQUIRE(statistics.n_lp_iterations(scip) == SCIPgetNLPIterations(scip));
+		REQUIRE(statistics.n_lp_iterations(scip) > 0);
+	}
+
+	SECTION("Read the solver again after an invalidation") {
+		auto const step = scip::StatisticsStep{statistics};
+		REQUIRE(statistics.n_lp_iterations(scip) == 0);
+		model.solve();
+		statistics.invalidate();
+		REQUIRE(statistics.in_step());
+		REQUIRE(statistics.n_lp_iterations(scip) == SCIPgetNLPIterations(scip));
+		REQUIRE(statistics.n_lp_iterations(scip) > 0);
+	}
+}
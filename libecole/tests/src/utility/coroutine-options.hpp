@@ -0,0 +1,24 @@
+#pragma once
+
+#include "ecole/utility/coroutine.hpp"
+
+namespace ecole::utility {
+
+/** Set the process wide default coroutine options, restoring the previous ones when destroyed. */
+class DefaultCoroutineOptionsGuard {
+public:
+	explicit DefaultCoroutineOptionsGuard(CoroutineOptions const& options) : m_original{default_coroutine_options()} {
+		set_default_coroutine_options(options);
+	}
+	DefaultCoroutineOptionsGuard(DefaultCoroutineOptionsGuard const&) = delete;
+	DefaultCoroutineOptionsGuard(DefaultCoroutineOptionsGuard&&) = delete;
+	~DefaultCoroutineOptionsGuard() { set_default_coroutine_options(m_original); }
+
+	auto operator=(DefaultCoroutineOptionsGuard const&) -> DefaultCoroutineOptionsGuard& = delete;
+	auto operator=(DefaultCoroutineOptionsGuard&&) -> DefaultCoroutineOptionsGuard& = delete;
+
+private:
+	CoroutineOptions m_original;
+};
+
+}  // namespace ecole::utility
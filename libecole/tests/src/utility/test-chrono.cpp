@@ -9,3 +9,9 @@ TEST_CASE("cpu_clock is monotonic", "[utility]") {
 	auto const after = utility::cpu_clock::now();
 	REQUIRE(before <= after);
 }
+
+TEST_CASE("coarse_clock is monotonic", "[utility]") {
+	auto const before = utility::coarse_clock::now();
+	auto const after = utility::coarse_clock::now();
+	REQUIRE(before <= after);
+}
@@ -1,19 +1,70 @@
-#include <catch2/catch.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <variant>
+#include <vector>
+
+#include <catch2/catch.hpp>
 
 #include "ecole/none.hpp"
 #include "ecole/scip/scimpl.hpp"
 #include "ecole/utility/coroutine.hpp"
 
+#include "utility/coroutine-options.hpp"
+
 using namespace ecole;
 
+namespace {
+
+auto options_for_all_backends() {
+	auto options = utility::CoroutineOptions{};
+	options.backend = GENERATE(
+		utility::CoroutineBackend::thread, utility::CoroutineBackend::spin_thread, utility::CoroutineBackend::fiber);
+	options.use_thread_pool = GENERATE(true, false);
+	return options;
+}
+
+/** Sorted durations of round trips (resume, yield, and wait) with the executor, in nanoseconds. */
+auto measure_round_trips(utility::CoroutineOptions const& options, std::size_t n_round_trips) {
+	using Coroutine = utility::Coroutine<NoneType, NoneType>;
+	using Executor = Coroutine::Executor;
+
+	auto co = Coroutine{options, [](Executor& executor) {
+		while (!Executor::is_stop(executor.yield(None))) {
+		}
+	}};
+	co.wait();
+	auto latencies = std::vector<double>(n_round_trips);
+	for (auto& latency : latencies) {
+		auto const before = std::chrono::steady_clock::now();
+		co.resume(None);
+		co.wait();
+		auto const after = std::chrono::steady_clock::now();
+		latency = std::chrono::duration<double, std::nano>(after - before).count();
+	}
+	std::sort(latencies.begin(), latencies.end());
+	return latencies;
+}
+
+auto quantile(std::vector<double> const& sorted, double q) {
+	return sorted[static_cast<std::size_t>(q * static_cast<double>(sorted.size() - 1))];
+}
+
+}  // namespace
+
 TEST_CASE("Coroutine manage ressources", "[utility]") {
 	using Coroutine = utility::Coroutine<NoneType, NoneType>;
 	using Executor = Coroutine::Executor;
+	auto const options = options_for_all_backends();
 
 	SECTION("Coroutine teminate immediatly") {
-		auto co = Coroutine{[](Executor const& /*executor*/) {}};
+		auto co = Coroutine{options, [](Executor const& /*executor*/) {}};
 
 		SECTION("Being waited on") {
 			auto ret = co.wait();
@@ -22,7 +73,7 @@ TEST_CASE("Coroutine manage ressources", "[utility]") {
 	}
 
 	SECTION("Coroutine is killed in execution") {
-		auto co = Coroutine{[](Executor& executor) {
+		auto co = Coroutine{options, [](Executor& executor) {
 			auto message = executor.yield(None);
 			do {
 				if (Executor::is_stop(message)) {
@@ -42,9 +93,10 @@ TEST_CASE("Coroutine manage ressources", "[utility]") {
 TEST_CASE("Coroutine can return values", "[utility]") {
 	using Coroutine = utility::Coroutine<int, NoneType>;
 	using Executor = Coroutine::Executor;
+	auto const options = options_for_all_backends();
 	auto const max = GENERATE(0, 1, 5);
 
-	auto co = Coroutine{[max](Executor& executor) {
+	auto co = Coroutine{options, [max](Executor& executor) {
 		for (int i = 0; i < max; ++i) {
 			auto message = executor.yield(i);
 			if (Executor::is_stop(message)) {
@@ -65,9 +117,10 @@ TEST_CASE("Coroutine can return values", "[utility]") {
 TEST_CASE("Coroutine can send messages", "[utility]") {
 	using Coroutine = utility::Coroutine<int, int>;
 	using Executor = Coroutine::Executor;
+	auto const options = options_for_all_backends();
 	auto const max = GENERATE(0, 1, 5);
 
-	auto co = Coroutine{[max](Executor& executor) {
+	auto co = Coroutine{options, [max](Executor& executor) {
 		int last_message = 0;
 		while (true) {
 			auto message = executor.yield(last_message);
@@ -86,3 +139,88 @@ TEST_CASE("Coroutine can send messages", "[utility]") {
 	REQUIRE(ret.has_value());
 	REQUIRE(ret.value() == message);
 }
+
+TEST_CASE("Thread coroutines can be used from different threads", "[utility]") {
+	using Coroutine = utility::Coroutine<int, NoneType>;
+	using Executor = Coroutine::Executor;
+	auto options = utility::CoroutineOptions{};
+	options.backend = GENERATE(utility::CoroutineBackend::thread, utility::CoroutineBackend::spin_thread);
+	options.use_thread_pool = GENERATE(true, false);
+	constexpr auto max = 10;
+
+	auto co = Coroutine{options, [](Executor& executor) {
+		for (int i = 0; i < max; ++i) {
+			if (Executor::is_stop(executor.yield(i))) {
+				break;
+			}
+		}
+	}};
+
+	for (int i = 0; i < max; ++i) {
+		auto ret = Coroutine::MaybeReturn{};
+		std::thread{[&] {
+			ret = co.wait();
+			co.resume(None);
+		}}.join();
+		REQUIRE(ret == i);
+	}
+	REQUIRE_FALSE(co.wait().has_value());
+}
+
+TEST_CASE("Coroutine rethrows executor exceptions", "[utility]") {
+	using Coroutine = utility::Coroutine<int, NoneType>;
+	using Executor = Coroutine::Executor;
+	auto const options = options_for_all_backends();
+
+	auto co = Coroutine{options, [](Executor& executor) {
+		executor.yield(0);
+		throw std::runtime_error{"Executor error"};
+	}};
+
+	REQUIRE(co.wait().has_value());
+	co.resume(None);
+	REQUIRE_THROWS_AS(co.wait(), std::runtime_error);
+}
+
+TEST_CASE("Coroutine uses the default options", "[utility]") {
+	using Coroutine = utility::Coroutine<int, NoneType>;
+	using Executor = Coroutine::Executor;
+	auto const options = options_for_all_backends();
+	auto const options_guard = utility::DefaultCoroutineOptionsGuard{options};
+	REQUIRE(utility::default_coroutine_options().backend == options.backend);
+
+	auto co = Coroutine{[](Executor& executor) { executor.yield(1); }};
+	REQUIRE(co.wait() == 1);
+	co.resume(None);
+	REQUIRE_FALSE(co.wait().has_value());
+}
+
+TEST_CASE("Latency histogram of thread synchronizers", "[utility][.benchmark]") {
+	constexpr auto n_round_trips = std::size_t{20000};
+	auto const mutex_latencies = measure_round_trips({utility::CoroutineBackend::thread}, n_round_trips);
+	auto const spin_latencies = measure_round_trips({utility::CoroutineBackend::spin_thread}, n_round_trips);
+
+	// Histogram with power of two buckets, in nanoseconds
+	auto report = std::ostringstream{};
+	report << std::setw(19) << "latency (ns)" << std::setw(10) << "mutex" << std::setw(10) << "spin" << '\n';
+	auto count_below = [](auto const& sorted, std::size_t bound) {
+		return std::lower_bound(sorted.begin(), sorted.end(), static_cast<double>(bound)) - sorted.begin();
+	};
+	auto const max_latency = std::max(mutex_latencies.back(), spin_latencies.back());
+	for (std::size_t low = 0, high = 64; static_cast<double>(low) <= max_latency; low = high, high *= 2) {  // NOLINT
+		report << std::setw(8) << low << " - " << std::setw(8) << high << std::setw(10)
+					 << count_below(mutex_latencies, high) - count_below(mutex_latencies, low) << std::setw(10)
+					 << count_below(spin_latencies, high) - count_below(spin_latencies, low) << '\n';
+	}
+	for (auto const q : {0.5, 0.9, 0.99}) {  // NOLINT(readability-magic-numbers)
+		report << std::setw(19) << "p" + std::to_string(static_cast<int>(q * 100)) << std::setw(10)
+					 << static_cast<std::size_t>(quantile(mutex_latencies, q)) << std::setw(10)
+					 << static_cast<std::size_t>(quantile(spin_latencies, q)) << '\n';
+	}
+	WARN(report.str());
+
+	// Spinning is only expected to help when both threads can run in parallel
+	if (std::thread::hardware_concurrency() > 1) {
+		CHECK(quantile(spin_latencies, 0.5) <= quantile(mutex_latencies, 0.5));  // NOLINT(readability-magic-numbers)
+	}
+}
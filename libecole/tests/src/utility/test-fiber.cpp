@@ -0,0 +1,33 @@
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/utility/fiber.hpp"
+
+using namespace ecole;
+
+TEST_CASE("Fiber switches execution context", "[utility]") {
+	auto trace = std::vector<int>{};
+	auto fiber = std::unique_ptr<utility::Fiber>{};
+	fiber = std::make_unique<utility::Fiber>([&] {
+		trace.push_back(1);
+		fiber->suspend();
+		trace.push_back(3);
+	});
+
+	REQUIRE(trace.empty());
+	fiber->resume();
+	trace.push_back(2);
+	REQUIRE_FALSE(fiber->is_finished());
+	fiber->resume();
+	REQUIRE(fiber->is_finished());
+	REQUIRE(trace == std::vector{1, 2, 3});
+}
+
+TEST_CASE("Fiber can be destroyed while suspended", "[utility]") {
+	auto fiber = std::unique_ptr<utility::Fiber>{};
+	fiber = std::make_unique<utility::Fiber>([&] { fiber->suspend(); });
+	fiber->resume();
+	REQUIRE_FALSE(fiber->is_finished());
+	fiber.reset();
+}
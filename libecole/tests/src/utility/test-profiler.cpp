@@ -0,0 +1,81 @@
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/utility/profiler.hpp"
+
+using namespace ecole;
+
+namespace {
+
+/** Spend time in a scope, so that it lasts at least a microsecond. */
+auto busy_scope(char const* name) {
+	auto const scope = utility::ProfileScope{name, utility::ProfileCategory::observation};
+	std::this_thread::sleep_for(std::chrono::milliseconds{1});
+}
+
+template <typename T> struct SomeTemplate {};
+
+auto chrome_trace() {
+	auto out = std::ostringstream{};
+	utility::Profiler::write_chrome_trace(out);
+	return out.str();
+}
+
+auto flame_graph() {
+	auto out = std::ostringstream{};
+	utility::Profiler::write_flame_graph(out);
+	return out.str();
+}
+
+}  // namespace
+
+TEST_CASE("Profiler records scopes only when enabled", "[utility]") {
+	utility::Profiler::clear();
+	REQUIRE_FALSE(utility::Profiler::is_enabled());
+	busy_scope("disabled");
+
+	utility::Profiler::enable();
+	REQUIRE(utility::Profiler::is_enabled());
+	busy_scope("enabled");
+	utility::Profiler::disable();
+	busy_scope("disabled");
+
+	auto const trace = chrome_trace();
+	REQUIRE(trace.find(R"("name":"enabled","cat":"observation")") != std::string::npos);
+	REQUIRE(trace.find("disabled") == std::string::npos);
+
+	utility::Profiler::clear();
+	REQUIRE(chrome_trace().find("enabled") == std::string::npos);
+}
+
+TEST_CASE("Profiler writes nested scopes as folded stacks", "[utility]") {
+	utility::Profiler::clear();
+	utility::Profiler::enable();
+	{
+		auto const scope = utility::ProfileScope{"outer", utility::ProfileCategory::reward};
+		busy_scope(utility::Profiler::intern("inner name"));
+	}
+	std::thread{[] { busy_scope("other_thread"); }}.join();
+	utility::Profiler::disable();
+
+	auto const stacks = flame_graph();
+	REQUIRE(stacks.find("outer;inner_name ") != std::string::npos);
+	REQUIRE(stacks.find("other_thread ") != std::string::npos);
+	REQUIRE(stacks.find(";other_thread") == std::string::npos);
+	utility::Profiler::clear();
+}
+
+TEST_CASE("Profiler interns equal names once", "[utility]") {
+	auto const name = std::string{"some name"};
+	REQUIRE(utility::Profiler::intern(name) == utility::Profiler::intern("some name"));
+}
+
+TEST_CASE("Profiler names types without their namespaces", "[utility]") {
+	REQUIRE(std::string{utility::profile_name<utility::Profiler>()} == "Profiler");
+	REQUIRE(utility::profile_name<utility::Profiler>() == utility::Profiler::intern("Profiler"));
+	REQUIRE(std::string{utility::profile_name<SomeTemplate<utility::Profiler>>()} == "SomeTemplate<Profiler>");
+}
@@ -1,4 +1,10 @@
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
 #include <catch2/catch.hpp>
+#include <xtensor/xview.hpp>
 
 #include "ecole/utility/sparse-matrix.hpp"
 
@@ -25,3 +31,45 @@ TEST_CASE("Sparse matrix unit unit tests", "[unit][utility]") {
 		REQUIRE(matrix_copy == matrix);
 	}
 }
+
+TEST_CASE("Compressed sparse row matrix unit tests", "[unit][utility]") {
+	// Non zeros are not sorted by row to test the conversion
+	auto const coo = utility::coo_matrix<double>{
+		{2., 4., 7., 1.},              // NOLINT(readability-magic-numbers)
+		{{1, 0, 2, 0}, {1, 1, 0, 2}},  // NOLINT(readability-magic-numbers)
+		{3, 3},                        // NOLINT(readability-magic-numbers)
+	};
+	auto const matrix = utility::to_csr(coo);
+
+	SECTION("Conversion from coordinate format") {
+		REQUIRE(matrix.shape == coo.shape);
+		REQUIRE(matrix.nnz() == coo.nnz());
+		REQUIRE(matrix.row_pointers == xt::xtensor<std::size_t, 1>{0, 2, 3, 4});
+		REQUIRE(matrix.column_indices == xt::xtensor<std::size_t, 1>{1, 2, 1, 0});
+		REQUIRE(matrix.values == xt::xtensor<double, 1>{4., 1., 2., 7.});  // NOLINT(readability-magic-numbers)
+	}
+
+	SECTION("Conversion to coordinate format") {
+		auto const coo_sorted = utility::to_coo(matrix);
+		REQUIRE(utility::to_csr(coo_sorted) == matrix);
+		REQUIRE(xt::view(coo_sorted.indices, 0, xt::all()) == xt::xtensor<std::size_t, 1>{0, 0, 1, 2});
+	}
+
+	SECTION("To and from tuple") {
+		auto t = matrix.to_tuple();
+		REQUIRE((std::get<0>(t) == matrix.values));
+		REQUIRE((std::get<2>(t) == matrix.row_pointers));
+		auto const matrix_copy = utility::csr_matrix<double>::from_tuple(std::move(t));
+		REQUIRE(matrix_copy == matrix);
+	}
+}
+
+TEST_CASE("Check that sparse matrix indices fit in their type", "[unit][utility]") {
+	constexpr auto max_int32 = static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max());
+	REQUIRE_NOTHROW(utility::check_index_range<std::int32_t>({max_int32, max_int32}, max_int32));
+	REQUIRE_NOTHROW(utility::check_index_range<std::size_t>({max_int32 + 1, max_int32 + 1}, max_int32 + 1));
+	REQUIRE_THROWS_AS(utility::check_index_range<std::int32_t>({max_int32 + 1, 1}, 1), std::overflow_error);
+	REQUIRE_THROWS_AS(utility::check_index_range<std::int32_t>({1, max_int32 + 1}, 1), std::overflow_error);
+	// Row pointers of compressed sparse row matrices go up to the number of non zeros
+	REQUIRE_THROWS_AS(utility::check_index_range<std::int32_t>({1, 1}, max_int32 + 1), std::overflow_error);
+}
@@ -0,0 +1,109 @@
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "ecole/utility/thread-pool.hpp"
+
+using namespace ecole;
+
+TEST_CASE("ThreadPool run tasks", "[utility]") {
+	auto const size = GENERATE(0, 1, 4);
+	auto pool = utility::ThreadPool{static_cast<std::size_t>(size)};
+	REQUIRE(pool.size() == static_cast<std::size_t>(size));
+
+	SECTION("Return values") {
+		auto future = pool.submit([] { return 3; });
+		REQUIRE(future.get() == 3);
+	}
+
+	SECTION("Propagate exceptions") {
+		auto future = pool.submit([] { throw std::runtime_error{"Task error"}; });
+		REQUIRE_THROWS_AS(future.get(), std::runtime_error);
+	}
+
+	SECTION("Do not make tasks wait on each other") {
+		auto signal = std::promise<void>{};
+		auto blocked = pool.submit([waited = signal.get_future()]() mutable { waited.wait(); });
+		auto unblocking = pool.submit([&signal] { signal.set_value(); });
+		unblocking.get();
+		blocked.get();
+	}
+
+	SECTION("Reuse workers") {
+		auto const first_id = pool.submit([] { return std::this_thread::get_id(); }).get();
+		auto const second_id = pool.submit([] { return std::this_thread::get_id(); }).get();
+		// With a single idle worker, both tasks must run on the same thread
+		if (size == 1) {
+			REQUIRE(first_id == second_id);
+		}
+	}
+
+	SECTION("Resize") {
+		pool.resize(2);
+		REQUIRE(pool.size() == 2);
+		REQUIRE(pool.submit([] { return 1; }).get() == 1);
+	}
+}
+
+TEST_CASE("ThreadPool start workers", "[utility]") {
+	using Start = utility::ThreadPool::Start;
+
+	SECTION("Eagerly") {
+		auto pool = utility::ThreadPool{2, Start::eager};
+		REQUIRE(pool.n_workers() == 2);
+	}
+
+	SECTION("Lazily") {
+		auto pool = utility::ThreadPool{2, Start::lazy};
+		REQUIRE(pool.n_workers() == 0);
+		pool.resize(4);
+		REQUIRE(pool.n_workers() == 0);
+		REQUIRE(pool.submit([] { return 1; }).get() == 1);
+		REQUIRE(pool.n_workers() == 1);
+		REQUIRE(pool.submit([] { return 1; }).get() == 1);
+		REQUIRE(pool.n_workers() == 1);
+	}
+}
+
+#ifdef __linux__
+TEST_CASE("ThreadPool pin workers", "[utility]") {
+	auto pool = utility::ThreadPool{1};
+	pool.pin({0});
+	REQUIRE(pool.submit([] { return sched_getcpu(); }).get() == 0);
+	pool.pin({});
+}
+#endif
+
+TEST_CASE("Parallel for runs all tasks", "[utility]") {
+	auto const n_threads = GENERATE(std::size_t{1}, std::size_t{3}, std::size_t{16});
+	auto pool = utility::ThreadPool{n_threads - 1};
+	auto constexpr n_tasks = std::size_t{10};
+
+	SECTION("Call the function once per index") {
+		auto counts = std::vector<int>(n_tasks, 0);
+		utility::parallel_for(pool, n_threads, n_tasks, [&counts](std::size_t i) { counts[i]++; });
+		REQUIRE(counts == std::vector<int>(n_tasks, 1));
+	}
+
+	SECTION("Wait for all tasks and propagate exceptions") {
+		auto n_called = std::atomic<std::size_t>{0};
+		// The last index is the last one of its chunk, so all other indices are still run
+		auto const func = [&n_called](std::size_t i) {
+			n_called++;
+			if (i == n_tasks - 1) {
+				throw std::runtime_error{"Task error"};
+			}
+		};
+		REQUIRE_THROWS_AS(utility::parallel_for(pool, n_threads, n_tasks, func), std::runtime_error);
+		REQUIRE(n_called == n_tasks);
+	}
+}
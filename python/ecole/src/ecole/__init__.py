@@ -11,5 +11,6 @@ import ecole.scip
 import ecole.instance
 import ecole.dynamics
 import ecole.environment
+import ecole.profiler
 
 __version__ = "{v.major}.{v.minor}.{v.patch}".format(v=ecole.version.get_ecole_lib_version())
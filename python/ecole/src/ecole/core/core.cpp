@@ -92,4 +92,6 @@ PYBIND11_MODULE(core, m) {
 	reward::bind_submodule(m.def_submodule("reward"));
 	information::bind_submodule(m.def_submodule("information"));
 	dynamics::bind_submodule(m.def_submodule("dynamics"));
+	environment::bind_submodule(m.def_submodule("environment"));
+	utility::bind_submodule(m.def_submodule("profiler"));
 }
@@ -38,4 +38,12 @@ namespace dynamics {
 void bind_submodule(pybind11::module_ const& m);
 }
 
+namespace environment {
+void bind_submodule(pybind11::module_ const& m);
+}
+
+namespace utility {
+void bind_submodule(pybind11::module_ const& m);
+}
+
 }  // namespace ecole
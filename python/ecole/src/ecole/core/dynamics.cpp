@@ -42,6 +42,29 @@ template <typename Class, typename... ClassArgs> struct dynamics_class : public
 		return *this;
 	}
 
+	/** Bind step_dynamics_async */
+	template <typename... Args> auto def_step_dynamics_async(Args&&... args) -> auto& {
+		this->def(
+			"step_dynamics_async",
+			&Class::step_dynamics_async,
+			py::arg("model"),
+			py::arg("action"),
+			py::call_guard<py::gil_scoped_release>(),
+			std::forward<Args>(args)...);
+		return *this;
+	}
+
+	/** Bind step_dynamics_wait */
+	template <typename... Args> auto def_step_dynamics_wait(Args&&... args) -> auto& {
+		this->def(
+			"step_dynamics_wait",
+			&Class::step_dynamics_wait,
+			py::arg("model"),
+			py::call_guard<py::gil_scoped_release>(),
+			std::forward<Args>(args)...);
+		return *this;
+	}
+
 	/** Bind set_dynamics_random_state */
 	template <typename... Args> auto def_set_dynamics_random_state(Args&&... args) -> auto& {
 		this->def(
@@ -119,6 +142,35 @@ void bind_submodule(pybind11::module_ const& m) {
 						(``SCIPvarGetProbindex``).
 						Variables ordering in the ``action_set`` is arbitrary.
 					)")
+			.def_step_dynamics_async(R"(
+				Branch and resume solving in the background.
+
+				Same as :py:meth:`step_dynamics` but returns without waiting for the next branching decision,
+				which must be received with :py:meth:`step_dynamics_wait`.
+				The model must not be used in between.
+
+				Parameters
+				----------
+					model:
+						The state of the Markov Decision Process. Passed by the environment.
+					action:
+						The index the LP column of the variable to branch on, or ``ecole.Default``.
+			)")
+			.def_step_dynamics_wait(R"(
+				Wait for solving resumed by :py:meth:`step_dynamics_async` to reach the next branching.
+
+				Parameters
+				----------
+					model:
+						The state of the Markov Decision Process. Passed by the environment.
+
+				Returns
+				-------
+					done:
+						Whether the instance is solved.
+					action_set:
+						List of indices of branching candidate variables, as in :py:meth:`step_dynamics`.
+			)")
 			.def_set_dynamics_random_state(R"(
 				Set seeds on the :py:class:`~ecole.scip.Model`.
 
@@ -131,7 +183,11 @@ void bind_submodule(pybind11::module_ const& m) {
 					rng:
 						The source of randomness. Passed by the environment.
 			)")
-			.def(py::init<bool>(), py::arg("pseudo_candidates") = false, R"(
+			.def(
+				py::init<bool, bool>(),
+				py::arg("pseudo_candidates") = false,
+				py::arg("reuse_strong_branching") = false,
+				R"(
 				Create new dynamics.
 
 				Parameters
@@ -139,6 +195,12 @@ void bind_submodule(pybind11::module_ const& m) {
 				pseudo_candidates:
 					Whether the action set contains pseudo branching variable candidates (``SCIPgetPseudoBranchCands``)
 					or LP branching variable candidates (``SCIPgetPseudoBranchCands``).
+				reuse_strong_branching:
+					Whether branching on a variable just scored by strong branching (for instance by
+					:py:class:`~ecole.observation.StrongBranchingScores`) reuses its result, as SCIP strong branching
+					rules do.
+					The children lower bounds are set from the strong branching LPs, and a variable with an infeasible
+					child has its bound tightened (or the node cut off) instead of being branched on.
 			)");
 	}
 
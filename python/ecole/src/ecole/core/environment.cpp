@@ -0,0 +1,238 @@
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <xtensor-python/pytensor.hpp>
+
+#include "ecole/dynamics/branching.hpp"
+#include "ecole/environment/vector.hpp"
+#include "ecole/random.hpp"
+#include "ecole/scip/model.hpp"
+
+#include "core.hpp"
+
+namespace ecole::environment {
+
+namespace py = pybind11;
+
+namespace {
+
+/**
+ * A Python object that can be copied and destroyed from any thread.
+ *
+ * The GIL is acquired whenever the reference count of the object is changed.
+ */
+class GilObject {
+public:
+	GilObject() noexcept = default;
+	explicit GilObject(py::object obj) noexcept : m_obj{std::move(obj)} {}
+	GilObject(GilObject const& other) {
+		auto const gil = py::gil_scoped_acquire{};
+		m_obj = other.m_obj;
+	}
+	GilObject(GilObject&&) noexcept = default;
+	~GilObject() { reset(); }
+
+	auto operator=(GilObject const& other) -> GilObject& {
+		auto const gil = py::gil_scoped_acquire{};
+		m_obj = other.m_obj;
+		return *this;
+	}
+	auto operator=(GilObject&& other) noexcept -> GilObject& {
+		reset();
+		m_obj = std::move(other.m_obj);
+		return *this;
+	}
+
+	/** Access the object, the GIL must be held. */
+	[[nodiscard]] auto get() const noexcept -> py::object const& { return m_obj; }
+
+private:
+	py::object m_obj;
+
+	auto reset() noexcept -> void {
+		if (m_obj) {
+			auto const gil = py::gil_scoped_acquire{};
+			m_obj = py::object{};
+		}
+	}
+};
+
+/** Acquire the GIL to call a Python data function, possibly from a worker thread. */
+class PyGilFunction {
+public:
+	explicit PyGilFunction(py::object data_func) noexcept : m_data_function{std::move(data_func)} {}
+
+	auto before_reset(scip::Model& model) -> void {
+		auto const gil = py::gil_scoped_acquire{};
+		m_data_function.get().attr("before_reset")(&model);
+	}
+
+	[[nodiscard]] auto data_function() const noexcept -> GilObject const& { return m_data_function; }
+
+protected:
+	auto call_extract(scip::Model& model, bool done) const -> py::object {
+		return m_data_function.get().attr("extract")(&model, done);
+	}
+
+private:
+	GilObject m_data_function;
+};
+
+class PyGilObservationFunction : public PyGilFunction {
+public:
+	using PyGilFunction::PyGilFunction;
+
+	auto extract(scip::Model& model, bool done) -> GilObject {
+		auto const gil = py::gil_scoped_acquire{};
+		return GilObject{call_extract(model, done)};
+	}
+};
+
+class PyGilRewardFunction : public PyGilFunction {
+public:
+	using PyGilFunction::PyGilFunction;
+
+	auto extract(scip::Model& model, bool done) -> Reward {
+		auto const gil = py::gil_scoped_acquire{};
+		return call_extract(model, done).cast<Reward>();
+	}
+};
+
+class PyGilInformationFunction : public PyGilFunction {
+public:
+	using PyGilFunction::PyGilFunction;
+
+	auto extract(scip::Model& model, bool done) -> std::map<std::string, GilObject> {
+		auto const gil = py::gil_scoped_acquire{};
+		auto information = std::map<std::string, GilObject>{};
+		auto const py_information = call_extract(model, done);
+		// Information functions such as ecole.information.Nothing return None
+		if (!py_information.is_none()) {
+			for (auto [key, value] : py_information.cast<py::dict>()) {
+				information.emplace(key.cast<std::string>(), py::reinterpret_borrow<py::object>(value));
+			}
+		}
+		return information;
+	}
+};
+
+using PyVectorBranching = VectorEnvironment<
+	dynamics::BranchingDynamics,
+	PyGilObservationFunction,
+	PyGilRewardFunction,
+	PyGilInformationFunction>;
+
+/** Create a C++ environment with the same components as a Python environment. */
+auto make_branching(py::handle py_env) -> PyVectorBranching::Environment {
+	auto py_dynamics = py_env.attr("dynamics");
+	if (!py::type::of(py_dynamics).is(py::type::of<dynamics::BranchingDynamics>())) {
+		throw py::type_error{"Only environments using exactly BranchingDynamics can be vectorized."};
+	}
+	auto env = PyVectorBranching::Environment{
+		PyGilObservationFunction{py_env.attr("observation_function")},
+		PyGilRewardFunction{py_env.attr("reward_function")},
+		PyGilInformationFunction{py_env.attr("information_function")},
+		py_env.attr("scip_params").cast<std::map<std::string, scip::Param>>(),
+		py_dynamics.cast<dynamics::BranchingDynamics const&>(),
+	};
+	env.rng() = py_env.attr("rng").cast<RandomGenerator const&>();
+	return env;
+}
+
+/** Read instances from a Python iterator, yielding either models or file paths. */
+auto make_instance_source(py::iterable const& instances) -> PyVectorBranching::InstanceSource {
+	return [iterator = GilObject{py::iter(instances)}]() {
+		auto const gil = py::gil_scoped_acquire{};
+		auto const instance = py::reinterpret_steal<py::object>(PyIter_Next(iterator.get().ptr()));
+		if (!instance) {
+			if (PyErr_Occurred() != nullptr) {
+				throw py::error_already_set{};
+			}
+			throw py::stop_iteration{"No more instances to reset the environments."};
+		}
+		if (py::isinstance<scip::Model>(instance)) {
+			return instance.cast<scip::Model const&>().copy_orig();
+		}
+		return scip::Model::from_file(py::str(instance).cast<std::string>());
+	};
+}
+
+/** Convert a batched transition to a tuple of Python objects, the GIL must be held. */
+auto to_python(PyVectorBranching::Transition&& transition) -> py::tuple {
+	auto observations = py::list{};
+	for (auto const& obs : transition.observations) {
+		observations.append(obs.has_value() ? obs->get() : py::none{});
+	}
+	auto informations = py::list{};
+	for (auto const& info : transition.informations) {
+		auto py_info = py::dict{};
+		for (auto const& [key, value] : info) {
+			py_info[py::str(key)] = value.get();
+		}
+		informations.append(std::move(py_info));
+	}
+	return py::make_tuple(
+		std::move(observations),
+		py::cast(std::move(transition.action_sets)),
+		py::cast(std::move(transition.rewards)),
+		py::cast(std::move(transition.dones)),
+		std::move(informations));
+}
+
+}  // namespace
+
+void bind_submodule(py::module_ const& m) {
+	m.doc() = "Environments implemented in C++.";
+
+	py::class_<PyVectorBranching>(m, "VectorBranching", R"(
+		Multiple branching environments transitioned in parallel.
+
+		The environments are reset and stepped in C++ threads with the GIL released.
+		Python data functions acquire the GIL when they are called, so only the components implemented in C++,
+		such as the dynamics and Ecole observation functions, run concurrently.
+	)")
+		.def(
+			py::init([](py::iterable const& environments, py::iterable const& instances, std::size_t n_threads) {
+				auto envs = std::vector<PyVectorBranching::Environment>{};
+				for (auto py_env : environments) {
+					envs.push_back(make_branching(py_env));
+				}
+				return std::make_unique<PyVectorBranching>(std::move(envs), make_instance_source(instances), n_threads);
+			}),
+			py::arg("environments"),
+			py::arg("instances"),
+			py::arg("n_threads") = std::thread::hardware_concurrency())
+		.def("__len__", &PyVectorBranching::size)
+		.def_property_readonly("n_threads", &PyVectorBranching::n_threads)
+		.def("seed", &PyVectorBranching::seed, py::arg("value"), "Seed all environments with seeds derived from value.")
+		.def(
+			"reset",
+			[](PyVectorBranching& self) {
+				auto transition = [&self] {
+					auto const release = py::gil_scoped_release{};
+					return self.reset();
+				}();
+				return to_python(std::move(transition));
+			},
+			"Reset all environments and return batched observations, action sets, reward offsets, dones, and infos.")
+		.def(
+			"step",
+			[](PyVectorBranching& self, std::vector<PyVectorBranching::Action> const& actions) {
+				auto transition = [&self, &actions] {
+					auto const release = py::gil_scoped_release{};
+					return self.step(actions);
+				}();
+				return to_python(std::move(transition));
+			},
+			py::arg("actions"),
+			"Step all environments and automatically reset the ones that reached a terminal state.");
+}
+
+}  // namespace ecole::environment
@@ -1,8 +1,13 @@
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <xtensor-python/pytensor.hpp>
@@ -16,6 +21,8 @@
 #include "ecole/observation/strong-branching-scores.hpp"
 #include "ecole/python/auto-class.hpp"
 #include "ecole/scip/model.hpp"
+#include "ecole/utility/function-traits.hpp"
+#include "ecole/utility/profiler.hpp"
 #include "ecole/utility/sparse-matrix.hpp"
 
 #include "core.hpp"
@@ -36,50 +43,133 @@ template <typename PyClass, typename... Args> auto def_before_reset(PyClass pycl
 		std::forward<Args>(args)...);
 }
 
+/**
+ * Name of the Python class, used to name its events in the Profiler.
+ */
+template <typename PyClass> auto profile_name(PyClass const& pyclass) -> char const* {
+	return utility::Profiler::intern(pyclass.attr("__name__").template cast<std::string>());
+}
+
 /**
  * Helper function to bind the `extract` method of observation functions.
+ *
+ * The extraction, and the conversion of the observation to Python, are recorded separately by the Profiler.
  */
 template <typename PyClass, typename... Args> auto def_extract(PyClass pyclass, Args&&... args) {
+	using ObsFunc = typename PyClass::type;
 	return pyclass.def(
 		"extract",
-		&PyClass::type::extract,
+		[name = profile_name(pyclass)](ObsFunc& obs_func, scip::Model& model, bool done) {
+			auto obs = [&] {
+				auto const release = py::gil_scoped_release{};
+				auto const scope = utility::ProfileScope{name, utility::ProfileCategory::observation};
+				return obs_func.extract(model, done);
+			}();
+			auto const scope = utility::ProfileScope{"python_conversion", utility::ProfileCategory::python};
+			return py::cast(std::move(obs));
+		},
 		py::arg("model"),
 		py::arg("done"),
-		py::call_guard<py::gil_scoped_release>(),
 		std::forward<Args>(args)...);
 }
 
 /**
- * Observation module bindings definitions.
+ * Helper function to bind the `extract_into` method of observation functions.
  */
-void bind_submodule(py::module_ const& m) {
-	m.doc() = "Observation classes for Ecole.";
-
-	xt::import_numpy();
-
-	m.attr("Nothing") = py::type::of<Nothing>();
+template <typename PyClass, typename... Args> auto def_extract_into(PyClass pyclass, Args&&... args) {
+	using ObsFunc = typename PyClass::type;
+	using Observation = utility::arg_t<3, decltype(&ObsFunc::extract_into)>;
+	return pyclass.def(
+		"extract_into",
+		[name = profile_name(pyclass)](ObsFunc& obs_func, scip::Model& model, bool done, Observation obs) {
+			auto const scope = utility::ProfileScope{name, utility::ProfileCategory::observation};
+			return obs_func.extract_into(model, done, obs);
+		},
+		py::arg("model"),
+		py::arg("done"),
+		py::arg("obs"),
+		py::call_guard<py::gil_scoped_release>(),
+		std::forward<Args>(args)...);
+}
 
-	using coo_matrix = decltype(NodeBipartiteObs::edge_features);
-	ecole::python::auto_class<coo_matrix>(m, "coo_matrix", R"(
+/**
+ * Helper function to bind a sparse matrix in the coordinate format.
+ */
+template <typename CooMatrix> auto bind_coo_matrix(py::module_ const& m, char const* name) {
+	return ecole::python::auto_class<CooMatrix>(m, name, R"(
 		Sparse matrix in the coordinate format.
 
 		Similar to Scipy's ``scipy.sparse.coo_matrix`` or PyTorch ``torch.sparse``.
 	)")
 		.def_auto_copy()
 		.def_auto_pickle("values", "indices", "shape")
-		.def_readwrite_xtensor("values", &coo_matrix::values, "A vector of non zero values in the matrix")
-		.def_readwrite_xtensor("indices", &coo_matrix::indices, R"(
+		.def_readwrite_xtensor("values", &CooMatrix::values, "A vector of non zero values in the matrix")
+		.def_readwrite_xtensor("indices", &CooMatrix::indices, R"(
 			A matrix holding the indices of non zero coefficient in the sparse matrix.
 
 			There are as many columns as there are non zero coefficients, and each row is a
 			dimension in the sparse matrix.
 		)")
-		.def_readwrite("shape", &coo_matrix::shape, "The dimension of the sparse matrix, as if it was dense.")
-		.def_property_readonly("nnz", &coo_matrix::nnz);
+		.def_readwrite("shape", &CooMatrix::shape, "The dimension of the sparse matrix, as if it was dense.")
+		.def_property_readonly("nnz", &CooMatrix::nnz);
+}
 
-	// Node bipartite observation
-	auto node_bipartite_obs =
-		ecole::python::auto_class<NodeBipartiteObs>(m, "NodeBipartiteObs", R"(
+/**
+ * Helper function to bind a sparse matrix in the compressed sparse row format.
+ *
+ * Conversions to Scipy and PyTorch share the memory of the matrix, which must therefore outlive them.
+ */
+template <typename CsrMatrix> auto bind_csr_matrix(py::module_ const& m, char const* name) {
+	return ecole::python::auto_class<CsrMatrix>(m, name, R"(
+		Sparse matrix in the compressed sparse row format.
+
+		Same layout as Scipy's ``scipy.sparse.csr_matrix`` and PyTorch ``torch.sparse_csr_tensor``, to which it can be
+		converted without copy when indices are signed integers.
+	)")
+		.def_auto_copy()
+		.def_auto_pickle("values", "column_indices", "row_pointers", "shape")
+		.def_readwrite_xtensor("values", &CsrMatrix::values, "A vector of non zero values in the matrix")
+		.def_readwrite_xtensor("column_indices", &CsrMatrix::column_indices, "The column index of every non zero value.")
+		.def_readwrite_xtensor("row_pointers", &CsrMatrix::row_pointers, R"(
+			Where the non zero values of every row start.
+
+			The values of row ``i`` are in the range ``row_pointers[i]:row_pointers[i+1]``, hence there is one more
+			element than there are rows in the matrix.
+		)")
+		.def_readwrite("shape", &CsrMatrix::shape, "The dimension of the sparse matrix, as if it was dense.")
+		.def_property_readonly("nnz", &CsrMatrix::nnz)
+		.def(
+			"to_scipy",
+			[](py::object const& self) {
+				auto const csr_matrix = py::module_::import("scipy.sparse").attr("csr_matrix");
+				auto data = py::make_tuple(self.attr("values"), self.attr("column_indices"), self.attr("row_pointers"));
+				return csr_matrix(std::move(data), py::arg("shape") = self.attr("shape"), py::arg("copy") = false);
+			},
+			"Create a ``scipy.sparse.csr_matrix`` sharing the memory of the matrix.")
+		.def(
+			"to_torch",
+			[](py::object const& self) {
+				auto const torch = py::module_::import("torch");
+				auto const from_numpy = torch.attr("from_numpy");
+				return torch.attr("sparse_csr_tensor")(
+					from_numpy(self.attr("row_pointers")),
+					from_numpy(self.attr("column_indices")),
+					from_numpy(self.attr("values")),
+					py::arg("size") = self.attr("shape"));
+			},
+			"Create a ``torch.sparse_csr_tensor`` sharing the memory of the matrix.");
+}
+
+/**
+ * Helper function to bind a NodeBipartite observation function and its observation.
+ *
+ * @return The class of the observation.
+ */
+template <typename ObsFunc>
+auto bind_node_bipartite(py::module_ const& m, char const* obs_name, char const* func_name, char const* func_doc)
+	-> py::object {
+	using Observation = typename ObsFunc::Observation;
+	auto node_bipartite_obs = ecole::python::auto_class<Observation>(m, obs_name, R"(
 		Bipartite graph observation for branch-and-bound nodes.
 
 		The optimization problem is represented as an heterogenous bipartite graph.
@@ -90,24 +180,162 @@ void bind_submodule(py::module_ const& m) {
 
 		Each variable and constraint node is associated with a vector of features.
 		Each edge is associated with the coefficient of the variable in the constraint.
-	)")
-			.def_auto_copy()
-			.def_auto_pickle("variable_features", "row_features", "edge_features")
-			.def_readwrite_xtensor("variable_features", &NodeBipartiteObs::variable_features, R"rst(
-					A matrix where each row represents a variable, and each column a feature of the variable.
-
-					Variables are ordered according to their position in the original problem (``SCIPvarGetProbindex``),
-					hence they can be indexed by the :py:class:`~ecole.environment.Branching` environment ``action_set``.
-				)rst")
-			.def_readwrite_xtensor(
-				"row_features",
-				&NodeBipartiteObs::row_features,
-				"A matrix where each row is represents a constraint, and each column a feature of the constraints.")
-			.def_readwrite(
-				"edge_features",
-				&NodeBipartiteObs::edge_features,
-				"The constraint matrix of the optimization problem, with rows for contraints and "
-				"columns for variables.");
+	)");
+	node_bipartite_obs.def(py::init<>())
+		.def_auto_copy()
+		.def_auto_pickle("variable_features", "row_features", "edge_features")
+		.def_readwrite_xtensor("variable_features", &Observation::variable_features, R"rst(
+				A matrix where each row represents a variable, and each column a feature of the variable.
+
+				Variables are ordered according to their position in the original problem (``SCIPvarGetProbindex``),
+				hence they can be indexed by the :py:class:`~ecole.environment.Branching` environment ``action_set``.
+			)rst")
+		.def_readwrite_xtensor(
+			"row_features",
+			&Observation::row_features,
+			"A matrix where each row is represents a constraint, and each column a feature of the constraints.")
+		.def_readwrite(
+			"edge_features",
+			&Observation::edge_features,
+			"The constraint matrix of the optimization problem, with rows for contraints and "
+			"columns for variables.");
+
+	auto node_bipartite = py::class_<ObsFunc>(m, func_name, func_doc);
+	node_bipartite.def(
+		py::init<bool, bool, bool>(),
+		py::arg("cache") = false,
+		py::arg("incremental") = false,
+		py::arg("track_columns") = false,
+		R"(
+		Constructor for NodeBipartite.
+
+		Parameters
+		----------
+		cache :
+			Whether or not to cache static features within an episode.
+			Currently, this is only safe if cutting planes are disabled.
+		incremental :
+			Whether or not to maintain the observation from one node to the next, only recomputing the edges and
+			row features of the LP rows that were added, removed, or modified in between.
+			Rows that did not change keep their position in the observation.
+			This is safe with cutting planes and takes precedence over ``cache``.
+		track_columns :
+			Whether or not to only recompute the dynamic features of the variables whose bounds, LP solution value,
+			basis status, or row dual values changed since the previous extraction.
+			Only applies with ``cache`` or ``incremental``, when the observation is kept between extractions.
+	)");
+	def_before_reset(node_bipartite, "Cache some feature not expected to change during an episode.");
+	def_extract(node_bipartite, "Extract a new observation.");
+	def_extract_into(node_bipartite, R"(
+		Extract the observation in place in an existing observation.
+
+		The arrays of the observation are only reallocated when their shape changes, so reusing the same observation
+		during an episode avoids allocating memory on every step.
+		Arrays previously accessed from the observation are views of its memory, and are invalid after a call that
+		changed their shape.
+		Return whether an observation was extracted.
+	)");
+
+	return node_bipartite_obs;
+}
+
+/**
+ * Helper function to bind a MilpBipartite observation function and its observation.
+ *
+ * @return The class of the observation.
+ */
+template <typename ObsFunc>
+auto bind_milp_bipartite(py::module_ const& m, char const* obs_name, char const* func_name, char const* func_doc)
+	-> py::object {
+	using Observation = typename ObsFunc::Observation;
+	auto milp_bipartite_obs = ecole::python::auto_class<Observation>(m, obs_name, R"(
+		Bipartite graph observation that represents the most recent MILP during presolving.
+
+		The optimization problem is represented as an heterogenous bipartite graph.
+		On one side, a node is associated with one variable, on the other side a node is
+		associated with one constraint.
+		There exist an edge between a variable and a constraint if the variable exists in the
+		constraint with a non-zero coefficient.
+
+		Each variable and constraint node is associated with a vector of features.
+		Each edge is associated with the coefficient of the variable in the constraint.
+	)");
+	milp_bipartite_obs.def_auto_copy()
+		.def_auto_pickle("variable_features", "constraint_features", "edge_features")
+		.def_readwrite_xtensor("variable_features", &Observation::variable_features, R"rst(
+				A matrix where each row represents a variable, and each column a feature of the variable.
+
+				Variables are ordered according to their position in the original problem (``SCIPvarGetProbindex``),
+				hence they can be indexed by the :py:class:`~ecole.environment.Branching` environment ``action_set``.
+			)rst")
+		.def_readwrite_xtensor(
+			"constraint_features",
+			&Observation::constraint_features,
+			"A matrix where each row is represents a constraint, and each column a feature of the constraints.")
+		.def_readwrite(
+			"edge_features",
+			&Observation::edge_features,
+			"The constraint matrix of the optimization problem, with rows for contraints and columns for variables.");
+
+	auto milp_bipartite = py::class_<ObsFunc>(m, func_name, func_doc);
+	milp_bipartite.def(py::init<bool>(), py::arg("normalize") = false, R"(
+		Constructor for MilpBipartite.
+
+		Parameters
+		----------
+		normalize :
+			Should the features be normalized?
+			This is recommended for some application such as deep learning models.
+	)");
+	def_before_reset(milp_bipartite, R"(Do nothing.)");
+	def_extract(milp_bipartite, "Extract a new observation.");
+
+	return milp_bipartite_obs;
+}
+
+/**
+ * Observation module bindings definitions.
+ */
+void bind_submodule(py::module_ const& m) {
+	m.doc() = "Observation classes for Ecole.";
+
+	xt::import_numpy();
+
+	m.attr("Nothing") = py::type::of<Nothing>();
+
+	bind_coo_matrix<utility::coo_matrix<double>>(m, "coo_matrix");
+	bind_coo_matrix<utility::coo_matrix<float, std::int32_t>>(m, "coo_matrix32");
+	bind_csr_matrix<utility::csr_matrix<double, std::int64_t>>(m, "csr_matrix");
+	bind_csr_matrix<utility::csr_matrix<float, std::int32_t>>(m, "csr_matrix32");
+
+	// Node bipartite observation
+	auto node_bipartite_obs = bind_node_bipartite<NodeBipartite>(m, "NodeBipartiteObs", "NodeBipartite", R"(
+		Bipartite graph observation function on branch-and bound node.
+
+		This observation function extract structured :py:class:`NodeBipartiteObs`.
+	)");
+	auto node_bipartite_obs32 = bind_node_bipartite<NodeBipartite32>(m, "NodeBipartiteObs32", "NodeBipartite32", R"(
+		Bipartite graph observation function on branch-and bound node, using 32 bits types.
+
+		This observation function extract structured :py:class:`NodeBipartiteObs32`, identical to
+		:py:class:`NodeBipartiteObs` except that features are stored in single precision and indices in 32 bits
+		integers, using half the memory.
+	)");
+	auto node_bipartite_csr_obs =
+		bind_node_bipartite<NodeBipartiteCsr>(m, "NodeBipartiteCsrObs", "NodeBipartiteCsr", R"(
+		Bipartite graph observation function on branch-and bound node, with edges in the compressed sparse row format.
+
+		This observation function extract structured :py:class:`NodeBipartiteCsrObs`, identical to
+		:py:class:`NodeBipartiteObs` except that edges are stored in a :py:class:`csr_matrix`.
+	)");
+	auto node_bipartite_csr_obs32 =
+		bind_node_bipartite<NodeBipartiteCsr32>(m, "NodeBipartiteCsrObs32", "NodeBipartiteCsr32", R"(
+		Bipartite graph observation function on branch-and bound node, with edges in the compressed sparse row format
+		and using 32 bits types.
+
+		This observation function extract structured :py:class:`NodeBipartiteCsrObs32`, identical to
+		:py:class:`NodeBipartiteObs32` except that edges are stored in a :py:class:`csr_matrix32`.
+	)");
 
 	py::enum_<NodeBipartiteObs::VariableFeatures>(node_bipartite_obs, "VariableFeatures")
 		.value("objective", NodeBipartiteObs::VariableFeatures::objective)
@@ -137,53 +365,40 @@ void bind_submodule(py::module_ const& m) {
 		.value("dual_solution_value", NodeBipartiteObs::RowFeatures::dual_solution_value)
 		.value("scaled_age", NodeBipartiteObs::RowFeatures::scaled_age);
 
-	auto node_bipartite = py::class_<NodeBipartite>(m, "NodeBipartite", R"(
-		Bipartite graph observation function on branch-and bound node.
+	for (auto const& obs_class : {node_bipartite_obs32, node_bipartite_csr_obs, node_bipartite_csr_obs32}) {
+		obs_class.attr("VariableFeatures") = node_bipartite_obs.attr("VariableFeatures");
+		obs_class.attr("RowFeatures") = node_bipartite_obs.attr("RowFeatures");
+	}
 
-		This observation function extract structured :py:class:`NodeBipartiteObs`.
-	)");
-	node_bipartite.def(py::init<bool>(), py::arg("cache") = false, R"(
-		Constructor for NodeBipartite.
+	// MILP bipartite observation
+	auto milp_bipartite_obs = bind_milp_bipartite<MilpBipartite>(m, "MilpBipartiteObs", "MilpBipartite", R"(
+		Bipartite graph observation function for the sub-MILP at the latest branch-and-bound node.
 
-		Parameters
-		----------
-		cache :
-			Whether or not to cache static features within an episode.
-			Currently, this is only safe if cutting planes are disabled.
+		This observation function extract structured :py:class:`MilpBipartiteObs`.
 	)");
-	def_before_reset(node_bipartite, "Cache some feature not expected to change during an episode.");
-	def_extract(node_bipartite, "Extract a new :py:class:`NodeBipartiteObs`.");
+	auto milp_bipartite_obs32 = bind_milp_bipartite<MilpBipartite32>(m, "MilpBipartiteObs32", "MilpBipartite32", R"(
+		Bipartite graph observation function for the sub-MILP at the latest branch-and-bound node, using 32 bits types.
 
-	// MILP bipartite observation
-	auto milp_bipartite_obs =
-		ecole::python::auto_class<MilpBipartiteObs>(m, "MilpBipartiteObs", R"(
-		Bipartite graph observation that represents the most recent MILP during presolving.
+		This observation function extract structured :py:class:`MilpBipartiteObs32`, identical to
+		:py:class:`MilpBipartiteObs` except that features are stored in single precision and indices in 32 bits
+		integers, using half the memory.
+	)");
+	auto milp_bipartite_csr_obs =
+		bind_milp_bipartite<MilpBipartiteCsr>(m, "MilpBipartiteCsrObs", "MilpBipartiteCsr", R"(
+		Bipartite graph observation function for the sub-MILP at the latest branch-and-bound node, with edges in the
+		compressed sparse row format.
 
-		The optimization problem is represented as an heterogenous bipartite graph.
-		On one side, a node is associated with one variable, on the other side a node is
-		associated with one constraint.
-		There exist an edge between a variable and a constraint if the variable exists in the
-		constraint with a non-zero coefficient.
+		This observation function extract structured :py:class:`MilpBipartiteCsrObs`, identical to
+		:py:class:`MilpBipartiteObs` except that edges are stored in a :py:class:`csr_matrix`.
+	)");
+	auto milp_bipartite_csr_obs32 =
+		bind_milp_bipartite<MilpBipartiteCsr32>(m, "MilpBipartiteCsrObs32", "MilpBipartiteCsr32", R"(
+		Bipartite graph observation function for the sub-MILP at the latest branch-and-bound node, with edges in the
+		compressed sparse row format and using 32 bits types.
 
-		Each variable and constraint node is associated with a vector of features.
-		Each edge is associated with the coefficient of the variable in the constraint.
-	)")
-			.def_auto_copy()
-			.def_auto_pickle("variable_features", "constraint_features", "edge_features")
-			.def_readwrite_xtensor("variable_features", &MilpBipartiteObs::variable_features, R"rst(
-					A matrix where each row represents a variable, and each column a feature of the variable.
-
-					Variables are ordered according to their position in the original problem (``SCIPvarGetProbindex``),
-					hence they can be indexed by the :py:class:`~ecole.environment.Branching` environment ``action_set``.
-				)rst")
-			.def_readwrite_xtensor(
-				"constraint_features",
-				&MilpBipartiteObs::constraint_features,
-				"A matrix where each row is represents a constraint, and each column a feature of the constraints.")
-			.def_readwrite(
-				"edge_features",
-				&MilpBipartiteObs::edge_features,
-				"The constraint matrix of the optimization problem, with rows for contraints and columns for variables.");
+		This observation function extract structured :py:class:`MilpBipartiteCsrObs32`, identical to
+		:py:class:`MilpBipartiteObs32` except that edges are stored in a :py:class:`csr_matrix32`.
+	)");
 
 	py::enum_<MilpBipartiteObs::VariableFeatures>(milp_bipartite_obs, "VariableFeatures")
 		.value("objective", MilpBipartiteObs::VariableFeatures::objective)
@@ -199,22 +414,10 @@ void bind_submodule(py::module_ const& m) {
 	py::enum_<MilpBipartiteObs::ConstraintFeatures>(milp_bipartite_obs, "ConstraintFeatures")
 		.value("bias", MilpBipartiteObs::ConstraintFeatures::bias);
 
-	auto milp_bipartite = py::class_<MilpBipartite>(m, "MilpBipartite", R"(
-		Bipartite graph observation function for the sub-MILP at the latest branch-and-bound node.
-
-		This observation function extract structured :py:class:`MilpBipartiteObs`.
-	)");
-	milp_bipartite.def(py::init<bool>(), py::arg("normalize") = false, R"(
-		Constructor for MilpBipartite.
-
-		Parameters
-		----------
-		normalize :
-			Should the features be normalized?
-			This is recommended for some application such as deep learning models.
-	)");
-	def_before_reset(milp_bipartite, R"(Do nothing.)");
-	def_extract(milp_bipartite, "Extract a new :py:class:`MilpBipartiteObs`.");
+	for (auto const& obs_class : {milp_bipartite_obs32, milp_bipartite_csr_obs, milp_bipartite_csr_obs32}) {
+		obs_class.attr("VariableFeatures") = milp_bipartite_obs.attr("VariableFeatures");
+		obs_class.attr("ConstraintFeatures") = milp_bipartite_obs.attr("ConstraintFeatures");
+	}
 
 	// Strong branching observation
 	auto strong_branching_scores = py::class_<StrongBranchingScores>(m, "StrongBranchingScores", R"(
@@ -231,7 +434,14 @@ void bind_submodule(py::module_ const& m) {
 		hence they can be indexed by the :py:class:`~ecole.environment.Branching` environment ``action_set``.
 		Variables for which a strong branching score is not applicable are filled with ``NaN``.
 	)");
-	strong_branching_scores.def(py::init<bool>(), py::arg("pseudo_candidates") = false, R"(
+	strong_branching_scores.def(
+		py::init<bool, std::optional<std::size_t>, bool, int, std::optional<std::size_t>>(),
+		py::arg("pseudo_candidates") = false,
+		py::arg("max_candidates") = py::none(),
+		py::arg("sample_candidates") = false,
+		py::arg("lp_iteration_limit") = std::numeric_limits<int>::max(),
+		py::arg("n_threads") = py::none(),
+		R"(
 		Constructor for StrongBranchingScores.
 
 		Parameters
@@ -239,9 +449,47 @@ void bind_submodule(py::module_ const& m) {
 		pseudo_candidates :
 			The parameter determines if strong branching scores are computed for
 			pseudo candidate variables (when true) or LP candidate variables (when false).
+		max_candidates :
+			The maximum number of candidates scored at every node, or all of them if None.
+			The other candidates are given a ``NaN`` score.
+		sample_candidates :
+			Whether the candidates scored are sampled uniformly when there are more than ``max_candidates``,
+			rather than being the ones with the best pseudocost score.
+		lp_iteration_limit :
+			The maximum number of LP iterations for solving each child LP.
+		n_threads :
+			If given, the candidates are scored concurrently on copies of the node LP, using at most this many
+			threads.
+			The scores do not depend on the number of threads, but can differ slightly from the ones computed
+			by SCIP when None.
 	)");
-	def_before_reset(strong_branching_scores, R"(Do nothing.)");
+	def_before_reset(strong_branching_scores, R"(Seed the candidate sampling from the seed of the model.)");
 	def_extract(strong_branching_scores, "Extract an array containing strong branching scores.");
+	strong_branching_scores.def(
+		"extract_into",
+		[](StrongBranchingScores& self, scip::Model& model, bool done, py::array& out) {
+			// Checked explicitly since the scores are written through a raw pointer
+			if ((out.ndim() != 1) || !py::array_t<double, py::array::c_style>::check_(out)) {
+				throw py::value_error{"The output must be a one dimensional C contiguous array of float64."};
+			}
+			if (!out.writeable()) {
+				throw py::value_error{"The output array must be writeable."};
+			}
+			auto* const data = static_cast<double*>(out.mutable_data());
+			auto const buffer = nonstd::span<double>{data, static_cast<std::size_t>(out.size())};
+			auto const release = py::gil_scoped_release{};
+			return self.extract_into(model, done, buffer);
+		},
+		py::arg("model"),
+		py::arg("done"),
+		py::arg("out").noconvert(),
+		R"(
+		Extract the strong branching scores in place in an existing array.
+
+		The array must be a writeable C contiguous float64 array with one element per variable, otherwise a
+		``ValueError`` is raised.
+		Return whether an observation was extracted.
+	)");
 
 	// Pseudocosts observation
 	auto pseudocosts = py::class_<Pseudocosts>(m, "Pseudocosts", R"(
@@ -264,12 +512,67 @@ void bind_submodule(py::module_ const& m) {
 	def_before_reset(pseudocosts, R"(Do nothing.)");
 	def_extract(pseudocosts, "Extract an array containing pseudocosts.");
 
+	// ExtendedPseudocosts observation
+	auto extended_pseudocosts_obs = ecole::python::auto_class<ExtendedPseudocostsObs>(m, "ExtendedPseudocostsObs", R"(
+		Pseudocosts and their statistics for the LP branching candidates.
+
+		The observation is a matrix where rows represent the branching candidates and columns represent pseudocost
+		features of these candidates.
+	)");
+	extended_pseudocosts_obs.def(py::init<>())
+		.def_auto_copy()
+		.def_auto_pickle("features", "candidates")
+		.def_readwrite_xtensor("features", &ExtendedPseudocostsObs::features, R"rst(
+			A matrix where each row represents a candidate, and each column a feature of the candidate.
+
+			Candidates are in the order of :py:attr:`ExtendedPseudocostsObs.candidates`.
+			The columns are given by :py:class:`ExtendedPseudocostsObs.Features`.
+		)rst")
+		.def_readwrite_xtensor("candidates", &ExtendedPseudocostsObs::candidates, R"rst(
+			The index of the branching candidates in the problem.
+
+			They are in the same order as the :py:class:`~ecole.environment.Branching` environment ``action_set``.
+		)rst")
+		.def_readonly_static("n_features", &ExtendedPseudocostsObs::n_features);
+
+	py::enum_<ExtendedPseudocostsObs::Features>(extended_pseudocosts_obs, "Features")
+		.value("pseudocost_down", ExtendedPseudocostsObs::Features::pseudocost_down)
+		.value("pseudocost_up", ExtendedPseudocostsObs::Features::pseudocost_up)
+		.value("count_down", ExtendedPseudocostsObs::Features::count_down)
+		.value("count_up", ExtendedPseudocostsObs::Features::count_up)
+		.value("variance_down", ExtendedPseudocostsObs::Features::variance_down)
+		.value("variance_up", ExtendedPseudocostsObs::Features::variance_up)
+		.value("confidence_down", ExtendedPseudocostsObs::Features::confidence_down)
+		.value("confidence_up", ExtendedPseudocostsObs::Features::confidence_up)
+		.value("score", ExtendedPseudocostsObs::Features::score);
+
+	auto extended_pseudocosts = py::class_<ExtendedPseudocosts>(m, "ExtendedPseudocosts", R"(
+		Pseudocosts statistics observation function on branch-and-bound nodes.
+
+		This observation extracts, in a single pass over the LP branching candidates, their predicted up and down
+		pseudocosts, the number of pseudocost updates, the variance and one-sided 95% confidence bound of the pseudocosts,
+		and the pseudocost score given by :py:class:`Pseudocosts`.
+		It is a cheaper alternative to :py:class:`Khalil2016` when only pseudocost information is needed.
+
+		This observation function extract structured :py:class:`ExtendedPseudocostsObs`.
+	)");
+	extended_pseudocosts.def(py::init<>());
+	def_before_reset(extended_pseudocosts, R"(Do nothing.)");
+	def_extract(extended_pseudocosts, "Extract the observation matrix.");
+	def_extract_into(extended_pseudocosts, R"(
+		Extract the observation in place in an existing :py:class:`ExtendedPseudocostsObs`.
+
+		The features are only reallocated when the number of candidates changes, so reusing the same observation
+		during an episode avoids allocating memory on most steps.
+		Return whether an observation was extracted.
+	)");
+
 	// Khalil observation
 	auto khalil2016_obs = ecole::python::auto_class<Khalil2016Obs>(m, "Khalil2016Obs", R"(
 		Branching candidates features from Khalil et al. (2016).
 
-		The observation is a matrix where rows represent all variables and columns represent features related
-		to these variables.
+		The observation is a matrix where rows represent all variables, or only the branching candidates in compact
+		mode, and columns represent features related to these variables.
 		See [Khalil2016]_ for a complete reference on this observation function.
 
 		.. [Khalil2016]
@@ -278,19 +581,26 @@ void bind_submodule(py::module_ const& m) {
 			<https://dl.acm.org/doi/10.5555/3015812.3015920>`_"
 			*Thirtieth AAAI Conference on Artificial Intelligence*. 2016.
 	)");
-	khalil2016_obs.def_auto_copy()
-		.def_auto_pickle("features")
+	khalil2016_obs.def(py::init<>())
+		.def_auto_copy()
+		.def_auto_pickle("features", "candidates")
 		.def_readwrite_xtensor("features", &Khalil2016Obs::features, R"rst(
 			A matrix where each row represents a variable, and each column a feature of the variable.
 
 			Variables are ordered according to their position in the original problem (``SCIPvarGetProbindex``),
 			hence they can be indexed by the :py:class:`~ecole.environment.Branching` environment ``action_set``.
 			Variables for which the features are not applicable are filled with ``NaN``.
+			In compact mode, there is only one row per candidate, in the order of :py:attr:`Khalil2016Obs.candidates`.
 
 			The first :py:attr:`Khalil2016Obs.n_static_features` features columns are static (they do not
 			change through the solving process), and the remaining :py:attr:`Khalil2016Obs.n_dynamic_features`
 			are dynamic.
 		)rst")
+		.def_readwrite_xtensor("candidates", &Khalil2016Obs::candidates, R"rst(
+			The index of the branching candidates in the problem.
+
+			They are in the same order as the :py:class:`~ecole.environment.Branching` environment ``action_set``.
+		)rst")
 		.def_readonly_static("n_static_features", &Khalil2016Obs::n_static_features)
 		.def_readonly_static("n_dynamic_features", &Khalil2016Obs::n_dynamic_features);
 
@@ -373,7 +683,12 @@ void bind_submodule(py::module_ const& m) {
 
 		This observation function extract structured :py:class:`Khalil2016Obs`.
 	)");
-	khalil2016.def(py::init<bool>(), py::arg("pseudo_candidates") = false, R"(
+	khalil2016.def(
+		py::init<bool, bool, std::size_t>(),
+		py::arg("pseudo_candidates") = false,
+		py::arg("compact") = false,
+		py::arg("n_threads") = 1,
+		R"(
 		Create new observation.
 
 		Parameters
@@ -381,9 +696,22 @@ void bind_submodule(py::module_ const& m) {
 		pseudo_candidates:
 				Whether the pseudo branching variable candidates (``SCIPgetPseudoBranchCands``)
 				or LP branching variable candidates (``SCIPgetPseudoBranchCands``) are observed.
+		compact:
+				Whether the features matrix only has one row per candidate, rather than one row per variable.
+				Memory then scales with the number of candidates rather than the size of the problem.
+		n_threads:
+				Number of threads computing the features of the candidates in parallel.
+				The solver data is copied beforehand so that the solver is never called concurrently.
 	)");
 	def_before_reset(khalil2016, R"(Reset static features cache.)");
 	def_extract(khalil2016, "Extract the observation matrix.");
+	def_extract_into(khalil2016, R"(
+		Extract the observation in place in an existing :py:class:`Khalil2016Obs`.
+
+		The features are only reallocated when their number of rows changes, so reusing the same observation
+		during an episode avoids allocating memory on every step.
+		Return whether an observation was extracted.
+	)");
 
 	// Hutter2011 observation
 	auto hutter_obs = ecole::python::auto_class<Hutter2011Obs>(m, "Hutter2011Obs", R"(
@@ -442,9 +770,36 @@ void bind_submodule(py::module_ const& m) {
 
 		This observation function extracts a structured :py:class:`Hutter2011Obs`.
 	)");
-	hutter.def(py::init<>());
-	def_before_reset(hutter, R"(Do nothing.)");
-	def_extract(hutter, "Extract the observation matrix.");
+	hutter.def(
+		py::init<bool, std::size_t, bool>(),
+		py::arg("approximate_degrees") = false,
+		py::arg("degree_sketch_size") = 256,
+		py::arg("direct_lp_relaxation") = false,
+		R"(
+		Create new observation.
+
+		Parameters
+		----------
+		approximate_degrees:
+				Whether to estimate the node degrees of the variable graph rather than computing them exactly.
+				The exact computation is quadratic in the size of the constraints, which is too slow on problems
+				with dense constraints, while the estimation is linear.
+		degree_sketch_size:
+				The number of hashes kept to estimate the size of a neighborhood.
+				Degrees smaller than the sketch size are exact, larger ones have a relative standard error of about
+				``1 / sqrt(degree_sketch_size - 2)``.
+		direct_lp_relaxation:
+				Whether to solve the LP relaxation directly with the LP interface, rather than solving a copy of the
+				model where all variables are continuous.
+				This skips the copy and the presolving of the model.
+	)");
+	def_before_reset(hutter, R"(Forget the LP relaxation of the previous model.)");
+	def_extract(hutter, R"(
+		Extract the observation matrix.
+
+		The LP relaxation is only solved on the first call for a given model, and reused until the number of
+		variables or constraints changes.
+	)");
 }
 
 }  // namespace ecole::observation
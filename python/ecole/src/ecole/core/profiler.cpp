@@ -0,0 +1,53 @@
+#include <filesystem>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl/filesystem.h>
+
+#include "ecole/utility/profiler.hpp"
+
+#include "core.hpp"
+
+namespace ecole::utility {
+
+namespace py = pybind11;
+
+void bind_submodule(py::module_ const& m) {
+	m.doc() = R"(
+		Profiling of the phases of environment transitions.
+
+		When enabled, the time spent handing control between Ecole and SCIP, solving in SCIP, extracting every
+		observation, reward, and information, and converting observations to Python is recorded for every thread.
+	)";
+
+	m.def("enable", &Profiler::enable, "Start recording events.");
+	m.def("disable", &Profiler::disable, "Stop recording events, keeping the ones already recorded.");
+	m.def("is_enabled", &Profiler::is_enabled, "Whether events are recorded.");
+	m.def("clear", &Profiler::clear, "Delete all recorded events.");
+	m.def("set_buffer_capacity", &Profiler::set_buffer_capacity, py::arg("capacity"), R"(
+		Change the number of events kept for each thread.
+
+		When the buffer of a thread is full, its oldest events are overwritten.
+		Only applies to threads that did not record any event yet.
+	)");
+	m.def(
+		"write_chrome_trace",
+		[](std::filesystem::path const& filename) { Profiler::write_chrome_trace(filename); },
+		py::arg("filename"),
+		R"(
+			Write all recorded events in the Chrome trace event format.
+
+			The file can be opened with ``chrome://tracing`` or https://ui.perfetto.dev.
+		)");
+	m.def(
+		"write_flame_graph",
+		[](std::filesystem::path const& filename) { Profiler::write_flame_graph(filename); },
+		py::arg("filename"),
+		R"(
+			Write the time in microseconds spent in every stack of events as folded stacks.
+
+			Nested events are excluded from the time of the stack containing them.
+			The file can be rendered with tools such as ``flamegraph.pl`` or https://www.speedscope.app.
+		)");
+}
+
+}  // namespace ecole::utility
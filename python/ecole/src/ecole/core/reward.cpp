@@ -1,5 +1,11 @@
+#include <cstddef>
 #include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <utility>
+#include <variant>
 
 #include <pybind11/eval.h>
 #include <pybind11/functional.h>
@@ -7,11 +13,14 @@
 
 #include "ecole/reward/bound-integral.hpp"
 #include "ecole/reward/constant.hpp"
+#include "ecole/reward/expression.hpp"
 #include "ecole/reward/is-done.hpp"
 #include "ecole/reward/lp-iterations.hpp"
 #include "ecole/reward/n-nodes.hpp"
 #include "ecole/reward/solving-time.hpp"
 #include "ecole/scip/model.hpp"
+#include "ecole/utility/function-traits.hpp"
+#include "ecole/utility/profiler.hpp"
 
 #include "core.hpp"
 
@@ -19,6 +28,16 @@ namespace py = pybind11;
 
 namespace ecole::reward {
 
+/**
+ * The operator of an Expression computing the same operation as an Arithmetic or Cumulative object.
+ */
+struct ExpressionOperation {
+	/** The operator applied, or none for the identity, as with unary ``+``. */
+	std::optional<Expression::Operator> op;
+	/** Whether the operands are in reverse order, as with reflected operators such as ``__rsub__``. */
+	bool reversed = false;
+};
+
 /**
  * Proxy class for doing arithmetic on reward functions.
  *
@@ -27,38 +46,67 @@ namespace ecole::reward {
  */
 class Arithmetic {
 public:
-	Arithmetic(py::object operation, py::list const& functions, py::str repr);
+	Arithmetic(
+		py::object operation,
+		py::list const& functions,
+		py::str repr,
+		std::optional<ExpressionOperation> expression_operation = {});
 	void before_reset(py::object const& model);
 	Reward extract(py::object const& model, bool done);
 	[[nodiscard]] py::str toString() const;
 
+	[[nodiscard]] auto operands() const noexcept -> py::list const& { return functions; }
+	/** The equivalent operation in an Expression, if any. */
+	[[nodiscard]] auto expression_operation() const noexcept -> std::optional<ExpressionOperation> {
+		return expression_op;
+	}
+
 private:
 	py::object operation;
 	py::list functions;
 	py::str repr;
+	std::optional<ExpressionOperation> expression_op;
 };
 
 class Cumulative {
 public:
-	Cumulative(py::object function, py::object reduce_func, Reward init_cumul_, py::str repr);
+	Cumulative(
+		py::object function,
+		py::object reduce_func,
+		Reward init_cumul_,
+		py::str repr,
+		std::optional<ExpressionOperation> expression_operation = {});
 	void before_reset(py::object const& model);
 	Reward extract(py::object const& model, bool done);
 	[[nodiscard]] py::str toString() const;
 
+	[[nodiscard]] auto operand() const noexcept -> py::object const& { return function; }
+	/** The equivalent operation in an Expression, if any. */
+	[[nodiscard]] auto expression_operation() const noexcept -> std::optional<ExpressionOperation> {
+		return expression_op;
+	}
+
 private:
 	py::object reduce_func;
 	py::object function;
 	Reward init_cumul;
 	Reward cumul;
 	py::str repr;
+	std::optional<ExpressionOperation> expression_op;
 };
 
+/**
+ * Compile a tree of reward functions, built with the operators of reward functions, into an Expression.
+ */
+auto compile_expression(py::object const& reward_function) -> Expression;
+
 /**
  * Helper function to bind common methods.
  */
 template <typename PyClass, typename... Args> void def_before_reset(PyClass /*pyclass*/, Args&&... /*args*/);
 template <typename PyClass, typename... Args> void def_extract(PyClass /*pyclass*/, Args&&... /*args*/);
 template <typename PyClass> void def_operators(PyClass /*pyclass*/);
+auto math_operation(std::string_view name) -> std::optional<ExpressionOperation>;
 
 /**
  * Reward module bindings definitions.
@@ -179,9 +227,10 @@ void bind_submodule(py::module_ const& m) {
 		it includes time spent in :py:meth:`~ecole.environment.Environment.reset` and time spent waiting on the agent.
 	)");
 	dualintegral.def(
-		py::init<bool, DualIntegral::BoundFunction>(),
+		py::init<bool, DualIntegral::BoundFunction, double>(),
 		py::arg("wall") = false,
 		py::arg("bound_function") = DualIntegral::BoundFunction{},
+		py::arg("time_quantum") = 0.,
 
 		R"(
 		Create a DualIntegral reward function.
@@ -194,7 +243,11 @@ void bind_submodule(py::module_ const& m) {
 			A function which takes an ecole model and returns a tuple of an initial dual bound and the offset
 			to compute the dual bound with respect to.  Values should be ordered as (offset, initial_dual_bound).
 			The default function returns (0, 1e20) if the problem is a maximization and (0, -1e20) otherwise.
-
+		time_quantum :
+			If positive, the time in seconds under which consecutive bound changes are grouped, so that the clock
+			is read at most once per quantum during solving.
+			Bound changes are then accounted for from the first change of each group, so that only the changes
+			within a group are attributed to its latest bounds.
 	)");
 	def_operators(dualintegral);
 	def_before_reset(dualintegral, "Reset the internal clock counter and the event handler.");
@@ -212,9 +265,10 @@ void bind_submodule(py::module_ const& m) {
 		it includes time spent in :py:meth:`~ecole.environment.Environment.reset` and time spent waiting on the agent.
 	)");
 	primalintegral.def(
-		py::init<bool, PrimalIntegral::BoundFunction>(),
+		py::init<bool, PrimalIntegral::BoundFunction, double>(),
 		py::arg("wall") = false,
 		py::arg("bound_function") = PrimalIntegral::BoundFunction{},
+		py::arg("time_quantum") = 0.,
 		R"(
 		Create a PrimalIntegral reward function.
 
@@ -226,6 +280,11 @@ void bind_submodule(py::module_ const& m) {
 			A function which takes an ecole model and returns a tuple of an initial primal bound and the offset
 			to compute the primal bound with respect to. Values should be ordered as (offset, initial_primal_bound).
 			The default function returns (0, -1e20) if the problem is a maximization and (0, 1e20) otherwise.
+		time_quantum :
+			If positive, the time in seconds under which consecutive bound changes are grouped, so that the clock
+			is read at most once per quantum during solving.
+			Bound changes are then accounted for from the first change of each group, so that only the changes
+			within a group are attributed to its latest bounds.
 	)");
 	def_operators(primalintegral);
 	def_before_reset(primalintegral, "Reset the internal clock counter and the event handler.");
@@ -243,9 +302,10 @@ void bind_submodule(py::module_ const& m) {
 		it includes time spent in :py:meth:`~ecole.environment.Environment.reset` and time spent waiting on the agent.
 	)");
 	primaldualintegral.def(
-		py::init<bool, PrimalDualIntegral::BoundFunction>(),
+		py::init<bool, PrimalDualIntegral::BoundFunction, double>(),
 		py::arg("wall") = false,
 		py::arg("bound_function") = PrimalDualIntegral::BoundFunction{},
+		py::arg("time_quantum") = 0.,
 		R"(
 		Create a PrimalDualIntegral reward function.
 
@@ -257,6 +317,11 @@ void bind_submodule(py::module_ const& m) {
 			A function which takes an ecole model and returns a tuple of an initial primal bound and dual bound.
 			Values should be ordered as (initial_primal_bound, initial_dual_bound). The default function returns
 			(-1e20, 1e20) if the problem is a maximization and (1e20, -1e20) otherwise.
+		time_quantum :
+			If positive, the time in seconds under which consecutive bound changes are grouped, so that the clock
+			is read at most once per quantum during solving.
+			Bound changes are then accounted for from the first change of each group, so that only the changes
+			within a group are attributed to its latest bounds.
 	)");
 	def_operators(primaldualintegral);
 	def_before_reset(primaldualintegral, "Reset the internal clock counter and the event handler.");
@@ -265,14 +330,164 @@ void bind_submodule(py::module_ const& m) {
 
 		The difference is computed based on the primal-dual integral between sequential calls.
 		)");
+
+	auto expression = py::class_<Expression>(m, "Expression", R"(
+		Reward function computing a formula over the built-in reward functions.
+
+		The formula is compiled once into a flat evaluation plan.
+		Extracting the reward runs every reward function of the formula once, then the plan, in a single call that
+		does not hold the GIL.
+		The same reward function appearing multiple times in the formula is only extracted once.
+		Operations follow floating point arithmetic, for instance a division by zero is infinite rather than an error.
+	)");
+	expression  //
+		.def(py::init<>(), "Create the expression of the constant zero.")
+		.def(py::init<std::string_view>(), py::arg("formula"), R"(
+			Compile a formula given as a string.
+
+			Parameters
+			----------
+			formula :
+				A formula made of numbers, reward functions called without arguments or with the ``wall`` argument
+				(``IsDone()``, ``LpIterations()``, ``NNodes()``, ``SolvingTime()``, ``DualIntegral()``,
+				``PrimalIntegral()``, ``PrimalDualIntegral()``), the operators ``+``, ``-``, ``*``, ``/``, ``**``,
+				the functions ``abs``, ``exp``, ``log``, ``log2``, ``log10``, ``sqrt``, ``floor``, ``ceil``, and
+				``cumsum``, also available as methods, as well as ``min`` and ``max``.
+				For instance ``"-1 * LpIterations() + 0.1 * NNodes()"`` or ``"SolvingTime(wall=True).cumsum()"``.
+		)")
+		.def(py::init(&compile_expression), py::arg("reward_function"), R"(
+			Compile a reward function built with the operators of reward functions.
+
+			For instance ``Expression(-1 * LpIterations() + 0.1 * NNodes())``.
+			The reward functions are copied, and their parameters, such as ``bound_function``, are kept.
+
+			A reward function object appearing multiple times is extracted once, and its reward reused for every
+			occurrence.
+			This differs from the operators, which extract it again for every occurrence, so that with
+			``r = LpIterations()``, ``r - r`` returns the LP iterations of the transition (the second extraction
+			returning zero) whereas ``Expression(r - r)`` returns zero.
+
+			Parameters
+			----------
+			reward_function :
+				A built-in reward function, or the result of the operators ``+``, ``-``, ``*``, ``/``, ``**``,
+				unary ``+`` and ``-``, ``abs``, ``math.floor``, ``math.ceil``, and of the methods ``exp``, ``log``,
+				``log2``, ``log10``, ``sqrt``, and ``cumsum``, applied on reward functions and numbers.
+		)")
+		.def_property_readonly("formula", &Expression::formula, "The text of the formula.")
+		.def("__repr__", [](Expression const& self) { return py::str("Expression({!r})").format(self.formula()); });
+	def_operators(expression);
+	def_before_reset(
+		expression, py::call_guard<py::gil_scoped_release>(), "Reset all reward functions and cumulative sums.");
+	def_extract(
+		expression,
+		py::call_guard<py::gil_scoped_release>(),
+		"Extract all reward functions and compute the formula, without holding the GIL.");
+}
+
+/**************************************
+ *  Definition of compile_expression  *
+ **************************************/
+
+namespace {
+
+using FunctionIndices = std::map<PyObject*, std::size_t>;
+
+/** Copy a built-in reward function into a function of an Expression, if it is one. */
+template <std::size_t I = 0> auto to_expression_function(py::handle const& reward_function)
+	-> std::optional<Expression::Function> {
+	if constexpr (I < std::variant_size_v<Expression::Function>) {
+		using Function = std::variant_alternative_t<I, Expression::Function>;
+		if (py::isinstance<Function>(reward_function)) {
+			return reward_function.cast<Function>();
+		}
+		return to_expression_function<I + 1>(reward_function);
+	} else {
+		return {};
+	}
+}
+
+auto push_operation(
+	Expression::Builder& builder,
+	FunctionIndices& indices,
+	std::optional<ExpressionOperation> operation,
+	py::list const& operands,
+	py::handle const& reward_function) -> void;
+
+/**
+ * Push the plan of a reward function, adding the same Python object only once.
+ *
+ * Unlike the operators, which extract a reward function again for each of its occurrences, the function is then
+ * extracted once per step and its reward reused.
+ */
+auto push_reward_function(Expression::Builder& builder, FunctionIndices& indices, py::handle const& reward_function)
+	-> void {
+	if (py::isinstance<Arithmetic>(reward_function)) {
+		auto const& arithmetic = reward_function.cast<Arithmetic const&>();
+		push_operation(builder, indices, arithmetic.expression_operation(), arithmetic.operands(), reward_function);
+	} else if (py::isinstance<Cumulative>(reward_function)) {
+		auto const& cumulative = reward_function.cast<Cumulative const&>();
+		auto operands = py::list{};
+		operands.append(cumulative.operand());
+		push_operation(builder, indices, cumulative.expression_operation(), operands, reward_function);
+	} else if (py::isinstance<Constant>(reward_function)) {
+		builder.push_constant(reward_function.cast<Constant const&>().value());
+	} else if (auto const iter = indices.find(reward_function.ptr()); iter != indices.end()) {
+		builder.push_function(iter->second);
+	} else if (auto function = to_expression_function(reward_function); function.has_value()) {
+		auto const index = builder.add_function(std::move(function).value());
+		indices.emplace(reward_function.ptr(), index);
+		builder.push_function(index);
+	} else {
+		auto const message = py::str("Cannot compile {} in a reward Expression.").format(reward_function);
+		throw py::type_error{message.cast<std::string>()};
+	}
+}
+
+auto push_operation(
+	Expression::Builder& builder,
+	FunctionIndices& indices,
+	std::optional<ExpressionOperation> operation,
+	py::list const& operands,
+	py::handle const& reward_function) -> void {
+	auto const arity = operation.has_value() && operation->op.has_value() ? Expression::arity(*operation->op) : 1;
+	if (!operation.has_value() || (operands.size() != arity)) {
+		auto const message = py::str("Cannot compile the operation {} in a reward Expression.").format(reward_function);
+		throw py::type_error{message.cast<std::string>()};
+	}
+	if (operation->reversed) {
+		for (auto i = operands.size(); i > 0; --i) {
+			push_reward_function(builder, indices, py::object{operands[i - 1]});
+		}
+	} else {
+		for (auto const operand : operands) {
+			push_reward_function(builder, indices, operand);
+		}
+	}
+	if (operation->op.has_value()) {
+		builder.push_operator(*operation->op);
+	}
+}
+
+}  // namespace
+
+auto compile_expression(py::object const& reward_function) -> Expression {
+	auto builder = Expression::Builder{};
+	auto indices = FunctionIndices{};
+	push_reward_function(builder, indices, reward_function);
+	return builder.build(py::str(reward_function).cast<std::string>());
 }
 
 /******************************
  *  Definition of Arithmetic  *
  ******************************/
 
-Arithmetic::Arithmetic(py::object operation_, py::list const& functions_, py::str repr_) :
-	operation(std::move(operation_)), repr(std::move(repr_)) {
+Arithmetic::Arithmetic(
+	py::object operation_,
+	py::list const& functions_,
+	py::str repr_,
+	std::optional<ExpressionOperation> expression_operation_) :
+	operation(std::move(operation_)), repr(std::move(repr_)), expression_op(expression_operation_) {
 	auto const Numbers = py::module_::import("numbers").attr("Number");
 	for (auto func : functions_) {
 		if (py::isinstance(func, Numbers)) {
@@ -305,12 +520,18 @@ py::str Arithmetic::toString() const {
  *  Definition of Cumulative  *
  ******************************/
 
-Cumulative::Cumulative(py::object function_, py::object reduce_func_, Reward init_cumul_, py::str repr_) :
+Cumulative::Cumulative(
+	py::object function_,
+	py::object reduce_func_,
+	Reward init_cumul_,
+	py::str repr_,
+	std::optional<ExpressionOperation> expression_operation_) :
 	reduce_func(std::move(reduce_func_)),
 	function(std::move(function_)),
 	init_cumul(init_cumul_),
 	cumul(init_cumul_),
-	repr(std::move(repr_)) {}
+	repr(std::move(repr_)),
+	expression_op(expression_operation_) {}
 
 void Cumulative::before_reset(py::object const& model) {
 	cumul = init_cumul;
@@ -336,8 +557,33 @@ template <typename PyClass, typename... Args> void def_before_reset(PyClass pycl
 }
 
 template <typename PyClass, typename... Args> void def_extract(PyClass pyclass, Args&&... args) {
+	using RewardFunction = typename PyClass::type;
+	// Either a scip::Model or, for rewards wrapping other reward functions, a Python object
+	using Model = utility::arg_t<1, decltype(&RewardFunction::extract)>;
+	auto const* const name = utility::Profiler::intern(pyclass.attr("__name__").template cast<std::string>());
 	pyclass.def(
-		"extract", &PyClass::type::extract, py::arg("model"), py::arg("done") = false, std::forward<Args>(args)...);
+		"extract",
+		[name](RewardFunction& reward_func, Model model, bool done) {
+			auto const scope = utility::ProfileScope{name, utility::ProfileCategory::reward};
+			return reward_func.extract(model, done);
+		},
+		py::arg("model"),
+		py::arg("done") = false,
+		std::forward<Args>(args)...);
+}
+
+auto math_operation(std::string_view name) -> std::optional<ExpressionOperation> {
+	static auto const operators = std::map<std::string_view, Expression::Operator>{
+		{"exp", Expression::Operator::exp},
+		{"log", Expression::Operator::log},
+		{"log2", Expression::Operator::log2},
+		{"log10", Expression::Operator::log10},
+		{"sqrt", Expression::Operator::sqrt},
+	};
+	if (auto const iter = operators.find(name); iter != operators.end()) {
+		return ExpressionOperation{iter->second};
+	}
+	return {};
 }
 
 template <typename PyClass> void def_operators(PyClass pyclass) {
@@ -348,60 +594,66 @@ template <typename PyClass> void def_operators(PyClass pyclass) {
 	// Return a function that wraps rewards functions inside an ArithmeticReward.
 	// The Arithmetic reward function is a reward function class that will call the wrapped
 	// reward functions and merge there rewards with the relevant operation (sum, prod, ...)
-	auto const arith_meth = [](auto operation, auto repr) {
-		return [operation, repr](py::args const& args) { return Arithmetic{operation, args, repr}; };
+	// Operations that have an equivalent in Expression are tagged with it, so that they can be compiled.
+	auto const arith_meth = [](auto operation, auto repr, std::optional<ExpressionOperation> expression_op = {}) {
+		return [operation, repr, expression_op](py::args const& args) {
+			return Arithmetic{operation, args, repr, expression_op};
+		};
 	};
+	using Op = Expression::Operator;
 
 	pyclass
 		// Binary operators
-		.def("__add__", arith_meth(py::eval("lambda x, y: x + y"), "({} + {})"))
-		.def("__sub__", arith_meth(py::eval("lambda x, y: x - y"), "({} - {})"))
-		.def("__mul__", arith_meth(py::eval("lambda x, y: x * y"), "({} * {})"))
+		.def("__add__", arith_meth(py::eval("lambda x, y: x + y"), "({} + {})", ExpressionOperation{Op::add}))
+		.def("__sub__", arith_meth(py::eval("lambda x, y: x - y"), "({} - {})", ExpressionOperation{Op::subtract}))
+		.def("__mul__", arith_meth(py::eval("lambda x, y: x * y"), "({} * {})", ExpressionOperation{Op::multiply}))
 		.def("__matmul__", arith_meth(py::eval("lambda x, y: x @ y"), "({} @ {})"))
-		.def("__truediv__", arith_meth(py::eval("lambda x, y: x / y"), "({} / {})"))
+		.def("__truediv__", arith_meth(py::eval("lambda x, y: x / y"), "({} / {})", ExpressionOperation{Op::divide}))
 		.def("__floordiv__", arith_meth(py::eval("lambda x, y: x // y"), "({} // {})"))
 		.def("__mod__", arith_meth(py::eval("lambda x, y: x % y"), "({} % {})"))
 		.def("__divmod__", arith_meth(builtins.attr("divmod"), "divmod({}, {})"))
-		.def("__pow__", arith_meth(builtins.attr("pow"), "({} ** {})"))
+		.def("__pow__", arith_meth(builtins.attr("pow"), "({} ** {})", ExpressionOperation{Op::power}))
 		.def("__lshift__", arith_meth(py::eval("lambda x, y: x << y"), "({} << {})"))
 		.def("__rshift__", arith_meth(py::eval("lambda x, y: x >> y"), "({} >> {})"))
 		.def("__and__", arith_meth(py::eval("lambda x, y: x & y"), "({} & {})"))
 		.def("__xor__", arith_meth(py::eval("lambda x, y: x ^ y"), "({} ^ {})"))
 		.def("__or__", arith_meth(py::eval("lambda x, y: x | y"), "({} | {})"))
 		// Reversed binary operators
-		.def("__radd__", arith_meth(py::eval("lambda x, y: y + x"), "({1} + {0})"))
-		.def("__rsub__", arith_meth(py::eval("lambda x, y: y - x"), "({1} - {0})"))
-		.def("__rmul__", arith_meth(py::eval("lambda x, y: y * x"), "({1} * {0})"))
+		.def("__radd__", arith_meth(py::eval("lambda x, y: y + x"), "({1} + {0})", ExpressionOperation{Op::add, true}))
+		.def("__rsub__", arith_meth(py::eval("lambda x, y: y - x"), "({1} - {0})", ExpressionOperation{Op::subtract, true}))
+		.def("__rmul__", arith_meth(py::eval("lambda x, y: y * x"), "({1} * {0})", ExpressionOperation{Op::multiply, true}))
 		.def("__rmatmul__", arith_meth(py::eval("lambda x, y: y @ x"), "({1} @ {0})"))
-		.def("__rtruediv__", arith_meth(py::eval("lambda x, y: y / x"), "({1} / {0})"))
+		.def(
+			"__rtruediv__",
+			arith_meth(py::eval("lambda x, y: y / x"), "({1} / {0})", ExpressionOperation{Op::divide, true}))
 		.def("__rfloordiv__", arith_meth(py::eval("lambda x, y: y // x"), "({1} // {0})"))
 		.def("__rmod__", arith_meth(py::eval("lambda x, y: y % x"), "({1} % {0})"))
 		.def("__rdivmod__", arith_meth(py::eval("lambda x, y: divmod(y, x)"), "divmod({1}, {0})"))
-		.def("__rpow__", arith_meth(py::eval("lambda x, y: y ** x"), "({1} ** {0})"))
+		.def("__rpow__", arith_meth(py::eval("lambda x, y: y ** x"), "({1} ** {0})", ExpressionOperation{Op::power, true}))
 		.def("__rlshift__", arith_meth(py::eval("lambda x, y: y << x"), "({1} << {0})"))
 		.def("__rrshift__", arith_meth(py::eval("lambda x, y: y >> x"), "({1} >> {0})"))
 		.def("__rand__", arith_meth(py::eval("lambda x, y: y & x"), "({1} & {0})"))
 		.def("__rxor__", arith_meth(py::eval("lambda x, y: y ^ x"), "({1} ^ {0})"))
 		.def("__ror__", arith_meth(py::eval("lambda x, y: y | x"), "({1} | {0})"))
 		// Unary operator
-		.def("__neg__", arith_meth(py::eval("lambda x: -x"), "(-{})"))
-		.def("__pos__", arith_meth(py::eval("lambda x: +x"), "(+{})"))
-		.def("__abs__", arith_meth(builtins.attr("abs"), "(abs({}))"))
+		.def("__neg__", arith_meth(py::eval("lambda x: -x"), "(-{})", ExpressionOperation{Op::negate}))
+		.def("__pos__", arith_meth(py::eval("lambda x: +x"), "(+{})", ExpressionOperation{}))
+		.def("__abs__", arith_meth(builtins.attr("abs"), "(abs({}))", ExpressionOperation{Op::absolute}))
 		.def("__invert__", arith_meth(py::eval("lambda x: ~x"), "(~{})"))
 		.def("__int__", arith_meth(builtins.attr("int"), "int({})"))
 		.def("__float__", arith_meth(builtins.attr("float"), "float({})"))
 		.def("__complex__", arith_meth(builtins.attr("complex"), "complex({})"))
 		.def("__round__", arith_meth(builtins.attr("round"), "round({})"))
 		.def("__trunc__", arith_meth(math.attr("trunc"), "math.trunc({})"))
-		.def("__floor__", arith_meth(math.attr("floor"), "math.floor({})"))
-		.def("__ceil__", arith_meth(math.attr("ceil"), "math.ceil({})"));
+		.def("__floor__", arith_meth(math.attr("floor"), "math.floor({})", ExpressionOperation{Op::floor}))
+		.def("__ceil__", arith_meth(math.attr("ceil"), "math.ceil({})", ExpressionOperation{Op::ceil}));
 	// Custom Math methods
 	// clang-format off
 	for (const auto *const name : {
 		"exp", "log", "log2", "log10", "sqrt", "sin", "cos", "tan", "asin", "acos", "atan",
 		"sinh", "cosh", "tanh", "asinh", "acosh", "atanh", "isfinite", "isinf", "isnan"
 	}) {
-		pyclass.def(name, arith_meth(math.attr(name), std::string{"{}."} + name + "()"));
+		pyclass.def(name, arith_meth(math.attr(name), std::string{"{}."} + name + "()", math_operation(name)));
 	}
 	// clang-format on
 	pyclass.def("apply", [](py::object const& self, py::object func) {
@@ -409,7 +661,8 @@ template <typename PyClass> void def_operators(PyClass pyclass) {
 	});
 	// Cumulative methods
 	pyclass.def("cumsum", [](py::object self) {
-		return Cumulative{std::move(self), py::eval("lambda x, y: x + y"), 0., "{}.cumsum()"};
+		return Cumulative{
+			std::move(self), py::eval("lambda x, y: x + y"), 0., "{}.cumsum()", ExpressionOperation{Op::cumsum}};
 	});
 }
 
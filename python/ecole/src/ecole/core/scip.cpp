@@ -182,6 +182,19 @@ void bind_submodule(py::module_ m) {
 		.def_property_readonly("primal_bound", &Model::primal_bound)
 		.def_property_readonly("dual_bound", &Model::dual_bound)
 
+		.def(
+			"begin_statistics_step",
+			[](Model& self) { self.statistics().begin_step(); },
+			"Cache solver statistics shared by data functions, such as LP iterations and time, until the step ends.")
+		.def(
+			"end_statistics_step",
+			[](Model& self) { self.statistics().end_step(); },
+			"Stop caching solver statistics and read them from the solver again on every call.")
+		.def(
+			"invalidate_statistics",
+			[](Model& self) { self.statistics().invalidate(); },
+			"Forget the cached solver statistics, after the model may have been modified during the step.")
+
 		.def(
 			"solve_iter",
 			[](Model& self, py::args const& py_args) {
@@ -195,7 +208,9 @@ void bind_submodule(py::module_ m) {
 				// Call the function
 				return self.solve_iter(args);
 			})
-		.def("solve_iter_continue", &Model::solve_iter_continue);
+		.def("solve_iter_continue", &Model::solve_iter_continue)
+		.def("solve_iter_resume", &Model::solve_iter_resume, py::arg("result"), py::call_guard<py::gil_scoped_release>())
+		.def("solve_iter_wait", &Model::solve_iter_wait, py::call_guard<py::gil_scoped_release>());
 }
 
 }  // namespace ecole::scip
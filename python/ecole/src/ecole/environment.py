@@ -54,6 +54,7 @@ class Environment:
         self.model = None
         self.dynamics = self.__Dynamics__(**dynamics_kwargs)
         self.can_transition = False
+        self.pending_step = None
         self.rng = ecole.spawn_random_generator()
 
     def reset(self, instance, *dynamics_args, **dynamics_kwargs):
@@ -100,6 +101,7 @@ class Environment:
 
         """
         self.can_transition = True
+        self.pending_step = None
         try:
             if isinstance(instance, ecole.core.scip.Model):
                 self.model = instance.copy_orig()
@@ -121,12 +123,7 @@ class Environment:
             self.can_transition = not done
 
             # Extract additional information to be returned by reset
-            reward_offset = self.reward_function.extract(self.model, done)
-            if not done:
-                observation = self.observation_function.extract(self.model, done)
-            else:
-                observation = None
-            information = self.information_function.extract(self.model, done)
+            reward_offset, observation, information = self._extract(done)
 
             return observation, action_set, reward_offset, done, information
         except Exception as e:
@@ -172,25 +169,68 @@ class Environment:
             insights about the environment.
 
         """
-        if not self.can_transition:
-            raise ecole.MarkovError("Environment need to be reset.")
+        self._check_can_step()
 
         try:
             # Transition the environment to the next state
             done, action_set = self.dynamics.step_dynamics(
                 self.model, action, *dynamics_args, **dynamics_kwargs
             )
-            self.can_transition = not done
+            return self._complete_step(done, action_set)
+        except Exception as e:
+            self.can_transition = False
+            raise e
 
-            # Extract additional information to be returned by step
-            reward = self.reward_function.extract(self.model, done)
-            if not done:
-                observation = self.observation_function.extract(self.model, done)
+    def step_async(self, action, *dynamics_args, **dynamics_kwargs) -> None:
+        """Start a transition without waiting for it to complete.
+
+        When the dynamics support it (*e.g.* :py:class:`~ecole.dynamics.BranchingDynamics`), the
+        solver keeps working in the background with the GIL released, so that the caller can do
+        other work, such as computing the actions of other environments.
+        Otherwise, the whole transition is computed in :meth:`recv`.
+        The environment must not be used until :meth:`recv` is called.
+
+        Parameters
+        ----------
+        action:
+            The action to take, as in :meth:`step`.
+        dynamics_args:
+            Extra arguments are forwarded as is to the underlying :py:class:`~ecole.typing.Dynamics`.
+        dynamics_kwargs:
+            Extra arguments are forwarded as is to the underlying :py:class:`~ecole.typing.Dynamics`.
+
+        """
+        self._check_can_step()
+
+        try:
+            if hasattr(type(self.dynamics), "step_dynamics_async"):
+                self.dynamics.step_dynamics_async(
+                    self.model, action, *dynamics_args, **dynamics_kwargs
+                )
+                self.pending_step = lambda: self.dynamics.step_dynamics_wait(self.model)
             else:
-                observation = None
-            information = self.information_function.extract(self.model, done)
+                self.pending_step = lambda: self.dynamics.step_dynamics(
+                    self.model, action, *dynamics_args, **dynamics_kwargs
+                )
+        except Exception as e:
+            self.can_transition = False
+            raise e
 
-            return observation, action_set, reward, done, information
+    def recv(self):
+        """Complete the transition started with :meth:`step_async`.
+
+        Returns
+        -------
+        The same values as :meth:`step`.
+
+        """
+        if self.pending_step is None:
+            raise ecole.MarkovError("No transition started with step_async.")
+
+        pending_step, self.pending_step = self.pending_step, None
+        try:
+            done, action_set = pending_step()
+            return self._complete_step(done, action_set)
         except Exception as e:
             self.can_transition = False
             raise e
@@ -207,6 +247,36 @@ class Environment:
         """
         self.rng.seed(value)
 
+    def _check_can_step(self) -> None:
+        if not self.can_transition:
+            raise ecole.MarkovError("Environment need to be reset.")
+        if self.pending_step is not None:
+            raise ecole.MarkovError("Environment is waiting for a call to recv.")
+
+    def _complete_step(self, done, action_set):
+        self.can_transition = not done
+
+        # Extract additional information to be returned by step
+        reward, observation, information = self._extract(done)
+
+        return observation, action_set, reward, done, information
+
+    def _extract(self, done):
+        # Solver statistics are read at most once per data function, since any of them may modify the model
+        self.model.begin_statistics_step()
+        try:
+            reward = self.reward_function.extract(self.model, done)
+            self.model.invalidate_statistics()
+            if not done:
+                observation = self.observation_function.extract(self.model, done)
+            else:
+                observation = None
+            self.model.invalidate_statistics()
+            information = self.information_function.extract(self.model, done)
+        finally:
+            self.model.end_statistics_step()
+        return reward, observation, information
+
 
 class Branching(Environment):
     __Dynamics__ = ecole.dynamics.BranchingDynamics
@@ -220,3 +290,95 @@ class Configuring(Environment):
 class PrimalSearch(Environment):
     __Dynamics__ = ecole.dynamics.PrimalSearchDynamics
     __DefaultObservationFunction__ = ecole.observation.NodeBipartite
+
+
+class VectorEnvironment:
+    """Multiple environments reset and stepped together in parallel.
+
+    The environments are transitioned in C++ threads with the GIL released, and the results are
+    returned as batches.
+    Environments that reach a terminal state are automatically reset on the next instance.
+    Only :py:class:`Branching` environments are currently supported.
+    """
+
+    def __init__(self, environments, instances, n_threads=None) -> None:
+        """Create a new vector environment.
+
+        Parameters
+        ----------
+        environments:
+            The environments to transition in parallel.
+            Their data functions are used concurrently and must not be shared between environments.
+            Functions implemented in Python acquire the GIL and are therefore not run in parallel.
+        instances:
+            An iterable of instances, as accepted by :py:meth:`Environment.reset`, used to start
+            every new episode.
+        n_threads:
+            The maximum number of threads used, by default the number of hardware threads.
+
+        """
+        environments = list(environments)
+        for env in environments:
+            if type(env.dynamics) is not ecole.dynamics.BranchingDynamics:
+                raise TypeError("Only environments using BranchingDynamics can be vectorized.")
+        kwargs = {} if n_threads is None else {"n_threads": n_threads}
+        self.environments = ecole.core.environment.VectorBranching(
+            environments, instances, **kwargs
+        )
+
+    def __len__(self) -> int:
+        """Return the number of environments."""
+        return len(self.environments)
+
+    def reset(self):
+        """Start a new episode in every environment.
+
+        Environments whose initial state is terminal are reset again on the next instance.
+
+        Returns
+        -------
+        observations:
+            The list of observations, one per environment.
+        action_sets:
+            The list of action sets, one per environment.
+        reward_offsets:
+            A numpy array of reward offsets.
+        dones:
+            A numpy array of done flags, all false.
+        infos:
+            The list of information dictionaries, one per environment.
+
+        """
+        return self.environments.reset()
+
+    def step(self, actions):
+        """Transition every environment with its action.
+
+        Environments that reach a terminal state are automatically reset.
+        For them, the observation and action set are the ones of the new episode, while the reward,
+        done flag, and information are the ones of the terminal transition.
+
+        Parameters
+        ----------
+        actions:
+            One action per environment.
+
+        Returns
+        -------
+        observations:
+            The list of observations, one per environment.
+        action_sets:
+            The list of action sets, one per environment.
+        rewards:
+            A numpy array of rewards.
+        dones:
+            A numpy array of done flags.
+        infos:
+            The list of information dictionaries, one per environment.
+
+        """
+        return self.environments.step(actions)
+
+    def seed(self, value: int) -> None:
+        """Seed every environment with a different seed derived from the value."""
+        self.environments.seed(value)
@@ -0,0 +1 @@
+from ecole.core.profiler import *
@@ -1,5 +1,6 @@
 """Unit tests for Ecole Environment."""
 
+import itertools
 import unittest.mock as mock
 import pytest
 
@@ -43,6 +44,30 @@ def test_step_error(model):
         env.step("some action")
 
 
+def test_step_async(model):
+    """Step in two parts with dynamics without asynchronous support."""
+    env = MockEnvironment()
+    env.reset(model)
+    env.step_async("some action")
+    with pytest.raises(ecole.MarkovError):
+        env.step("other action")
+    _, _, _, _, _ = env.recv()
+    env.dynamics.step_dynamics.assert_called_with(env.model, "some action")
+    with pytest.raises(ecole.MarkovError):
+        env.recv()
+
+
+@pytest.mark.slow
+def test_branching_step_async(model):
+    """Solve an instance with asynchronous steps."""
+    env = ecole.environment.Branching(observation_function=None)
+    _, action_set, _, done, _ = env.reset(model)
+    while not done:
+        env.step_async(action_set[0])
+        _, action_set, _, done, _ = env.recv()
+    assert env.model.is_solved
+
+
 def test_seed():
     """Random generator is consumed."""
     env = MockEnvironment()
@@ -55,3 +80,28 @@ def test_scip_params(model):
     env = MockEnvironment(scip_params={"concurrent/paramsetprefix": "testname"})
     env.reset(model)
     assert env.model.get_param("concurrent/paramsetprefix") == "testname"
+
+
+def test_vector_environment(model):
+    """Environments are reset and stepped together."""
+    n_envs = 3
+    envs = [ecole.environment.Branching(observation_function=None) for _ in range(n_envs)]
+    vector_env = ecole.environment.VectorEnvironment(envs, itertools.repeat(model), n_threads=2)
+    assert len(vector_env) == n_envs
+
+    observations, action_sets, reward_offsets, dones, infos = vector_env.reset()
+    assert len(observations) == len(action_sets) == len(infos) == n_envs
+    assert reward_offsets.shape == dones.shape == (n_envs,)
+    assert not dones.any()
+
+    for _ in range(10):
+        actions = [action_set[0] for action_set in action_sets]
+        observations, action_sets, rewards, dones, infos = vector_env.step(actions)
+        # Finished episodes are automatically reset
+        assert all(action_set is not None for action_set in action_sets)
+
+
+def test_vector_environment_wrong_dynamics():
+    """Only branching environments are supported."""
+    with pytest.raises(TypeError):
+        ecole.environment.VectorEnvironment([MockEnvironment()], [])
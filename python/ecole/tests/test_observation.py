@@ -27,12 +27,23 @@ def pytest_generate_tests(metafunc):
         all_observation_functions = (
             ecole.observation.Nothing(),
             ecole.observation.NodeBipartite(),
+            ecole.observation.NodeBipartite32(),
+            ecole.observation.NodeBipartiteCsr(),
             ecole.observation.MilpBipartite(),
+            ecole.observation.MilpBipartite32(),
+            ecole.observation.MilpBipartiteCsr32(),
             ecole.observation.StrongBranchingScores(True),
             ecole.observation.StrongBranchingScores(False),
+            ecole.observation.StrongBranchingScores(max_candidates=2, lp_iteration_limit=100),
+            ecole.observation.StrongBranchingScores(n_threads=2),
             ecole.observation.Pseudocosts(),
+            ecole.observation.ExtendedPseudocosts(),
             ecole.observation.Khalil2016(),
+            ecole.observation.Khalil2016(compact=True),
+            ecole.observation.Khalil2016(n_threads=2),
             ecole.observation.Hutter2011(),
+            ecole.observation.Hutter2011(approximate_degrees=True),
+            ecole.observation.Hutter2011(direct_lp_relaxation=True),
         )
         metafunc.parametrize("observation_function", all_observation_functions)
 
@@ -101,6 +112,59 @@ def test_NodeBipartite_observation(model):
     assert len(obs.RowFeatures.__members__) == obs.row_features.shape[1]
 
 
+def test_NodeBipartite_extract_into(model):
+    """Extracting in place writes in the memory of the existing observation."""
+    obs_func = ecole.observation.NodeBipartite()
+    obs = make_obs(obs_func, model)
+    variable_features = obs.variable_features
+    assert obs_func.extract_into(model, False, obs)
+    assert np.shares_memory(variable_features, obs.variable_features)
+
+
+def test_NodeBipartite32_observation(model):
+    """Observation of NodeBipartite32 holds single precision values and 32 bits indices."""
+    obs = make_obs(ecole.observation.NodeBipartite32(), model)
+    assert isinstance(obs, ecole.observation.NodeBipartiteObs32)
+    assert_array(obs.variable_features, ndim=2, dtype=np.float32)
+    assert_array(obs.row_features, ndim=2, dtype=np.float32)
+    assert_array(obs.edge_features.values, dtype=np.float32)
+    assert_array(obs.edge_features.indices, ndim=2, dtype=np.int32)
+    assert obs.VariableFeatures is ecole.observation.NodeBipartiteObs.VariableFeatures
+
+
+def test_NodeBipartiteCsr_observation(model):
+    """Observation of NodeBipartiteCsr has edges in the compressed sparse row format."""
+    obs = make_obs(ecole.observation.NodeBipartiteCsr(), model)
+    assert isinstance(obs, ecole.observation.NodeBipartiteCsrObs)
+    assert isinstance(obs.edge_features, ecole.observation.csr_matrix)
+    assert_array(obs.edge_features.values)
+    assert_array(obs.edge_features.column_indices, dtype=np.int64)
+    assert_array(obs.edge_features.row_pointers, dtype=np.int64)
+    assert obs.edge_features.row_pointers.size == obs.row_features.shape[0] + 1
+    assert obs.edge_features.row_pointers[-1] == obs.edge_features.nnz
+
+
+def test_csr_matrix_to_scipy(model):
+    """Conversion to Scipy shares the memory of the edges."""
+    pytest.importorskip("scipy")
+    edges = make_obs(ecole.observation.NodeBipartiteCsr32(), model).edge_features
+    matrix = edges.to_scipy()
+    assert matrix.shape == tuple(edges.shape)
+    assert np.shares_memory(matrix.data, edges.values)
+    assert np.shares_memory(matrix.indices, edges.column_indices)
+    assert np.shares_memory(matrix.indptr, edges.row_pointers)
+
+
+def test_csr_matrix_to_torch(model):
+    """Conversion to PyTorch creates a sparse CSR tensor."""
+    torch = pytest.importorskip("torch")
+    edges = make_obs(ecole.observation.NodeBipartiteCsr32(), model).edge_features
+    tensor = edges.to_torch()
+    assert tensor.layout == torch.sparse_csr
+    assert tuple(tensor.shape) == tuple(edges.shape)
+    assert np.array_equal(tensor.values().numpy(), edges.values)
+
+
 def test_MilpBipartite_observation(model):
     """Observation of MilpBipartite is a type with array attributes."""
     obs = make_obs(ecole.observation.MilpBipartite(), model, stage=ecole.scip.Stage.Problem)
@@ -115,18 +179,61 @@ def test_MilpBipartite_observation(model):
     assert len(obs.ConstraintFeatures.__members__) == obs.constraint_features.shape[1]
 
 
+def test_MilpBipartite32_observation(model):
+    """Observation of MilpBipartite32 holds single precision values and 32 bits indices."""
+    obs = make_obs(ecole.observation.MilpBipartite32(), model, stage=ecole.scip.Stage.Problem)
+    assert isinstance(obs, ecole.observation.MilpBipartiteObs32)
+    assert_array(obs.variable_features, ndim=2, dtype=np.float32)
+    assert_array(obs.constraint_features, ndim=2, dtype=np.float32)
+    assert_array(obs.edge_features.values, dtype=np.float32)
+    assert_array(obs.edge_features.indices, ndim=2, dtype=np.int32)
+
+
 def test_StrongBranchingScores_observation(model):
     """Observation of StrongBranchingScores is a numpy array."""
     obs = make_obs(ecole.observation.StrongBranchingScores(), model)
     assert_array(obs)
 
 
+def test_StrongBranchingScores_extract_into(model):
+    """Extracting in place writes the scores in the given array."""
+    obs_func = ecole.observation.StrongBranchingScores()
+    scores = make_obs(obs_func, model)
+    out = np.empty_like(scores)
+    assert obs_func.extract_into(model, False, out)
+    assert (np.isnan(out) == np.isnan(scores)).all()
+
+
+def test_StrongBranchingScores_extract_into_invalid(model):
+    """Extracting in place rejects arrays that cannot be written as a contiguous buffer."""
+    obs_func = ecole.observation.StrongBranchingScores()
+    scores = make_obs(obs_func, model)
+    strided = np.empty(2 * scores.size)[::2]
+    with pytest.raises(ValueError):
+        obs_func.extract_into(model, False, strided)
+    read_only = np.empty_like(scores)
+    read_only.flags.writeable = False
+    with pytest.raises(ValueError):
+        obs_func.extract_into(model, False, read_only)
+    with pytest.raises(ValueError):
+        obs_func.extract_into(model, False, np.empty(scores.size, dtype=np.float32))
+
+
 def test_Pseudocosts_observation(model):
     """Observation of Pseudocosts is a numpy array."""
     obs = make_obs(ecole.observation.Pseudocosts(), model)
     assert_array(obs)
 
 
+def test_ExtendedPseudocosts_observation(model):
+    """Observation of ExtendedPseudocosts has one row of features per candidate."""
+    obs = make_obs(ecole.observation.ExtendedPseudocosts(), model)
+    assert_array(obs.features, ndim=2)
+    assert_array(obs.candidates, dtype=np.uint64)
+    assert obs.features.shape[0] == obs.candidates.size
+    assert len(obs.Features.__members__) == obs.features.shape[1]
+
+
 def test_Khalil2016_observation(model):
     """Observation of Khalil2016 is a numpy matrix."""
     obs = make_obs(ecole.observation.Khalil2016(), model)
@@ -136,6 +243,15 @@ def test_Khalil2016_observation(model):
     assert len(obs.Features.__members__) == obs.features.shape[1]
 
 
+def test_Khalil2016_compact_observation(model):
+    """Compact observation of Khalil2016 has one row per candidate."""
+    obs = make_obs(ecole.observation.Khalil2016(compact=True), model)
+    assert_array(obs.features, ndim=2)
+    assert_array(obs.candidates, dtype=np.uint64)
+    assert obs.features.shape[0] == obs.candidates.size
+    assert not np.isnan(obs.features).any()
+
+
 def test_Hutter2011_observation(model):
     """Observation of Hutter2011 is a numpy vector."""
     obs = make_obs(ecole.observation.Hutter2011(), model, stage=ecole.scip.Stage.Problem)
@@ -0,0 +1,61 @@
+"""Test Ecole profiler in Python."""
+
+import json
+
+import pytest
+
+import ecole
+
+
+@pytest.fixture
+def profiler():
+    """Return the profiler module, cleared and disabled after the test."""
+    ecole.profiler.clear()
+    yield ecole.profiler
+    ecole.profiler.disable()
+    ecole.profiler.clear()
+
+
+def run_episode(model):
+    """Run a few steps of a branching environment."""
+    env = ecole.environment.Branching(
+        observation_function=ecole.observation.NodeBipartite(), reward_function=-ecole.reward.LpIterations()
+    )
+    _, action_set, _, done, _ = env.reset(model)
+    for _ in range(3):
+        if done:
+            break
+        _, action_set, _, done, _ = env.step(action_set[0])
+
+
+def test_disabled_by_default(profiler, model, tmp_path):
+    """No event is recorded unless enabled."""
+    assert not profiler.is_enabled()
+    run_episode(model)
+    profiler.write_chrome_trace(tmp_path / "trace.json")
+    assert json.loads((tmp_path / "trace.json").read_text())["traceEvents"] == []
+
+
+def test_chrome_trace(profiler, model, tmp_path):
+    """Transition phases are exported as a valid Chrome trace."""
+    profiler.enable()
+    assert profiler.is_enabled()
+    run_episode(model)
+    profiler.disable()
+    profiler.write_chrome_trace(tmp_path / "trace.json")
+    events = json.loads((tmp_path / "trace.json").read_text())["traceEvents"]
+    names = {event["name"] for event in events}
+    assert {"NodeBipartite", "LpIterations", "python_conversion", "solving", "coroutine_handoff"} <= names
+    assert all(event["dur"] >= 0 for event in events)
+
+
+def test_flame_graph(profiler, model, tmp_path):
+    """Transition phases are exported as folded stacks."""
+    profiler.enable()
+    run_episode(model)
+    profiler.disable()
+    profiler.write_flame_graph(tmp_path / "stacks.txt")
+    for line in (tmp_path / "stacks.txt").read_text().splitlines():
+        stack, microseconds = line.rsplit(" ", 1)
+        assert stack != ""
+        assert int(microseconds) > 0
@@ -29,6 +29,8 @@ def pytest_generate_tests(metafunc):
             ecole.reward.PrimalIntegral(bound_function=lambda x: (0.0, 0.0)),
             ecole.reward.DualIntegral(bound_function=lambda x: (0.0, 0.0)),
             ecole.reward.PrimalDualIntegral(bound_function=lambda x: (0.0, 0.0)),
+            ecole.reward.PrimalDualIntegral(bound_function=lambda x: (0.0, 0.0), time_quantum=0.01),
+            ecole.reward.Expression("-1 * LpIterations() + 0.1 * NNodes()"),
         )
         metafunc.parametrize("reward_function", all_reward_functions)
 
@@ -141,3 +143,62 @@ def test_primal_dual_integral_lambda(model):
     reward = reward_function.extract(model)
 
     assert reward >= 0
+
+
+@pytest.mark.parametrize(
+    "formula",
+    [
+        lambda rf: -1 * rf.LpIterations() + 0.1 * rf.NNodes(),
+        lambda rf: (rf.NNodes() - 3) / 2,
+        lambda rf: 2 ** abs(rf.NNodes()),
+        lambda rf: rf.LpIterations().sqrt() + rf.IsDone(),
+        lambda rf: rf.NNodes().cumsum() + rf.Constant(2),
+        lambda rf: +rf.NNodes() - rf.LpIterations(),
+    ],
+)
+def test_expression_compile(formula, model, model_copy):
+    """Expressions compiled from distinct reward functions compute the same rewards."""
+    reward_function = formula(ecole.reward)
+    expression = ecole.reward.Expression(formula(ecole.reward))
+    for func, mod in [(reward_function, model), (expression, model_copy)]:
+        func.before_reset(mod)
+        pytest.helpers.advance_to_stage(mod, ecole.scip.Stage.Solving)
+    assert expression.extract(model_copy) == pytest.approx(reward_function.extract(model))
+    assert expression.extract(model_copy) == pytest.approx(reward_function.extract(model))
+
+
+def test_expression_compile_shared_function(model, model_copy):
+    """A compiled reward function appearing twice is extracted once, unlike with operators."""
+    reward_function = ecole.reward.LpIterations()
+    operators = reward_function - reward_function
+    expression = ecole.reward.Expression(reward_function - reward_function)
+    for func, mod in [(operators, model), (expression, model_copy)]:
+        func.before_reset(mod)
+        mod.solve()
+    assert operators.extract(model) > 0
+    assert expression.extract(model_copy) == 0
+
+
+def test_expression_formula(model, model_copy):
+    """Expressions compiled from strings compute the same rewards as from operators."""
+    expression = ecole.reward.Expression("-1 * LpIterations() + 0.1 * NNodes().cumsum()")
+    compiled = ecole.reward.Expression(
+        -1 * ecole.reward.LpIterations() + 0.1 * ecole.reward.NNodes().cumsum()
+    )
+    assert expression.formula == "-1 * LpIterations() + 0.1 * NNodes().cumsum()"
+    for func, mod in [(expression, model), (compiled, model_copy)]:
+        func.before_reset(mod)
+        pytest.helpers.advance_to_stage(mod, ecole.scip.Stage.Solving)
+    assert expression.extract(model) == pytest.approx(compiled.extract(model_copy))
+
+
+def test_expression_errors():
+    """Malformed formulas and unsupported operations are rejected."""
+    with pytest.raises(ValueError):
+        ecole.reward.Expression("LpIterations() +")
+    with pytest.raises(ValueError):
+        ecole.reward.Expression("Unknown()")
+    with pytest.raises(TypeError):
+        ecole.reward.Expression(ecole.reward.LpIterations() % 2)
+    with pytest.raises(TypeError):
+        ecole.reward.Expression(ecole.reward.LpIterations().apply(lambda r: r))